@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+
+#
+# Copyright (c) 2024 Project CHIP Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Script that packs a directory of PAA certificates (e.g. as fetched by
+# fetch_paa_certs_from_dcl.py) into a single PAA bundle file, which can be
+# passed anywhere a PAA trust store path is accepted (e.g. chip-tool's
+# --paa-trust-store-path). The bundle stores the Subject Key Identifier of
+# every certificate, so that loading it does not require parsing certificates.
+# Since certificates are not validated again when the bundle is loaded, only
+# certificates that have the format required of a PAA are included.
+#
+# Bundle layout (all integers are little-endian), see FileAttestationTrustStore.h:
+#
+#     magic "PAAB" (4) | version (2) | reserved (2) | count (4)
+#     count x [ SKID (20) | DER offset from start of file (4) | DER length (4) ]
+#     DER certificates
+#
+# For usage please run:
+#     python ./credentials/generate_paa_bundle.py --help
+
+import logging
+import os
+import struct
+import sys
+
+import click
+from cryptography import x509
+from cryptography.hazmat.primitives import serialization
+from cryptography.hazmat.primitives.asymmetric import ec
+
+BUNDLE_MAGIC = b'PAAB'
+BUNDLE_VERSION = 1
+HEADER_FORMAT = '<4sHHI'
+ENTRY_FORMAT = '<20sII'
+SKID_LENGTH = 20
+# Same limit as kMaxDERCertLength in src/credentials/CHIPCert.h.
+MAX_DER_CERT_LENGTH = 600
+
+
+def load_paa(path):
+    """Returns (skid, der) for a PAA certificate file, or None if it should be skipped."""
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    try:
+        if path.endswith('.pem'):
+            cert = x509.load_pem_x509_certificate(data)
+        else:
+            cert = x509.load_der_x509_certificate(data)
+        skid = cert.extensions.get_extension_for_class(x509.SubjectKeyIdentifier).value.digest
+        basic_constraints = cert.extensions.get_extension_for_class(x509.BasicConstraints).value
+        key_usage = cert.extensions.get_extension_for_class(x509.KeyUsage).value
+        public_key = cert.public_key()
+    except (ValueError, x509.ExtensionNotFound) as e:
+        logging.warning(f'Skipping {path}: {e}')
+        return None
+
+    # Same checks as VerifyAttestationCertificateFormat() for AttestationCertType::kPAA.
+    if cert.version != x509.Version.v3:
+        logging.warning(f'Skipping {path}: not an X.509 v3 certificate')
+        return None
+    if not isinstance(public_key, ec.EllipticCurvePublicKey) or not isinstance(public_key.curve, ec.SECP256R1):
+        logging.warning(f'Skipping {path}: public key is not on curve P-256')
+        return None
+    if cert.signature_algorithm_oid != x509.SignatureAlgorithmOID.ECDSA_WITH_SHA256:
+        logging.warning(f'Skipping {path}: not signed with ecdsa-with-SHA256')
+        return None
+    if not basic_constraints.ca or basic_constraints.path_length not in (None, 1):
+        logging.warning(f'Skipping {path}: basic constraints are not those of a PAA')
+        return None
+    other_key_usages = (key_usage.content_commitment or key_usage.key_encipherment or key_usage.data_encipherment or
+                        key_usage.key_agreement)
+    if not (key_usage.key_cert_sign and key_usage.crl_sign) or other_key_usages:
+        logging.warning(f'Skipping {path}: key usage is not that of a PAA')
+        return None
+    if len(skid) != SKID_LENGTH:
+        logging.warning(f'Skipping {path}: unexpected SKID length {len(skid)}')
+        return None
+
+    der = cert.public_bytes(serialization.Encoding.DER)
+    if len(der) > MAX_DER_CERT_LENGTH:
+        logging.warning(f'Skipping {path}: certificate is {len(der)} bytes long')
+        return None
+
+    return skid, der
+
+
+def build_bundle(paas):
+    """Serializes a {skid: der} mapping into a PAA bundle."""
+    entries = sorted(paas.items())
+    offset = struct.calcsize(HEADER_FORMAT) + len(entries) * struct.calcsize(ENTRY_FORMAT)
+
+    header = struct.pack(HEADER_FORMAT, BUNDLE_MAGIC, BUNDLE_VERSION, 0, len(entries))
+    table = b''
+    for skid, der in entries:
+        table += struct.pack(ENTRY_FORMAT, skid, offset, len(der))
+        offset += len(der)
+
+    return header + table + b''.join(der for _, der in entries)
+
+
+@click.command()
+@click.help_option('-h', '--help')
+@click.option('--paa-trust-store-path', required=True, type=click.Path(exists=True, file_okay=False),
+              help='Directory holding the PAA certificates, in DER (.der) or PEM (.pem) format.')
+@click.option('--output', required=True, type=click.Path(dir_okay=False), help='Path of the PAA bundle to write.')
+@click.option('--log-level', default='INFO', show_default=True,
+              type=click.Choice(['DEBUG', 'INFO', 'WARNING', 'ERROR'], case_sensitive=False), help='Logging level.')
+def main(paa_trust_store_path: str, output: str, log_level: str):
+    logging.basicConfig(level=log_level.upper(), format='%(levelname)s: %(message)s')
+
+    paas = {}
+    for name in sorted(os.listdir(paa_trust_store_path)):
+        if not (name.endswith('.der') or name.endswith('.pem')):
+            continue
+
+        paa = load_paa(os.path.join(paa_trust_store_path, name))
+        if paa is None:
+            continue
+
+        skid, der = paa
+        if skid in paas:
+            # The same PAA is commonly present in both DER and PEM form.
+            if paas[skid] != der:
+                logging.warning(f'Skipping {name}: another certificate has SKID {skid.hex()}')
+            continue
+        paas[skid] = der
+
+    if not paas:
+        logging.error(f'No PAA certificates found in {paa_trust_store_path}')
+        sys.exit(1)
+
+    with open(output, 'wb') as f:
+        f.write(build_bundle(paas))
+
+    logging.info(f'Wrote {len(paas)} PAA certificates to {output}')
+
+
+if __name__ == '__main__':
+    main()
@@ -73,8 +73,8 @@ public:
                     "Path to the log file where the output is redirected.  Can be absolute or relative to the current working "
                     "directory.");
         AddArgument("paa-trust-store-path", &mPaaTrustStorePath,
-                    "Path to directory holding PAA certificate information.  Can be absolute or relative to the current working "
-                    "directory.");
+                    "Path to directory holding PAA certificate information, or to a PAA bundle generated by "
+                    "credentials/generate_paa_bundle.py.  Can be absolute or relative to the current working directory.");
         AddArgument("cd-trust-store-path", &mCDTrustStorePath,
                     "Path to directory holding CD certificate information.  Can be absolute or relative to the current working "
                     "directory.");
@@ -136,7 +136,7 @@ ALLOW: Dict[str, Set[str]] = {
     'src/app/clusters/media-playback-server/media-playback-delegate.h': {'list'},
     'src/app/clusters/target-navigator-server/target-navigator-delegate.h': {'list'},
 
-    'src/credentials/attestation_verifier/FileAttestationTrustStore.h': {'vector'},
+    'src/credentials/attestation_verifier/FileAttestationTrustStore.h': {'unordered_map', 'vector'},
     'src/credentials/attestation_verifier/FileAttestationTrustStore.cpp': {'string'},
     'src/credentials/attestation_verifier/TestDACRevocationDelegateImpl.cpp': {'fstream'},
 
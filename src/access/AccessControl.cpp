@@ -25,6 +25,8 @@
 
 #include <lib/core/Global.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Access {
 
@@ -90,6 +92,12 @@ constexpr bool IsValidGroupNodeId(NodeId aNodeId)
     return IsGroupId(aNodeId) && IsValidGroupId(GroupIdFromNodeId(aNodeId));
 }
 
+// Whether access control list decisions made for one subject descriptor apply to the other.
+bool IsSameSubject(const SubjectDescriptor & a, const SubjectDescriptor & b)
+{
+    return a.fabricIndex == b.fabricIndex && a.authMode == b.authMode && a.subject == b.subject && a.cats == b.cats;
+}
+
 #if CHIP_PROGRESS_LOGGING && CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 1
 
 char GetAuthModeStringForLogging(AuthMode authMode)
@@ -207,6 +215,7 @@ CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeRes
     {
         mDelegate           = delegate;
         mDeviceTypeResolver = &deviceTypeResolver;
+        OnEntriesModified();
     }
 
     return retval;
@@ -218,6 +227,9 @@ void AccessControl::Finish()
     ChipLogProgress(DataManagement, "AccessControl: finishing");
     mDelegate->Finish();
     mDelegate = nullptr;
+#if CHIP_CONFIG_ACCESS_CONTROL_ENTRY_INDEX
+    mEntryIndex.Release();
+#endif
 }
 
 CHIP_ERROR AccessControl::CreateEntry(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t * index,
@@ -235,6 +247,7 @@ CHIP_ERROR AccessControl::CreateEntry(const SubjectDescriptor * subjectDescripto
     VerifyOrReturnError(IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
 
     size_t i = 0;
+    OnEntriesModified();
     ReturnErrorOnFailure(mDelegate->CreateEntry(&i, entry, &fabric));
 
     if (index)
@@ -251,6 +264,7 @@ CHIP_ERROR AccessControl::UpdateEntry(const SubjectDescriptor * subjectDescripto
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
+    OnEntriesModified();
     ReturnErrorOnFailure(mDelegate->UpdateEntry(index, entry, &fabric));
     NotifyEntryChanged(subjectDescriptor, fabric, index, &entry, EntryListener::ChangeType::kUpdated);
     return CHIP_NO_ERROR;
@@ -265,6 +279,7 @@ CHIP_ERROR AccessControl::DeleteEntry(const SubjectDescriptor * subjectDescripto
     {
         p = &entry;
     }
+    OnEntriesModified();
     ReturnErrorOnFailure(mDelegate->DeleteEntry(index, &fabric));
     if (p && p->HasDefaultDelegate())
     {
@@ -349,8 +364,34 @@ CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, con
     return result;
 }
 
+CHIP_ERROR AccessControl::Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                Privilege requestPrivilege, AccessDecisionCache & cache)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    if (cache.mAccessControl != this || cache.mEntriesGeneration != mEntriesGeneration ||
+        !IsSameSubject(cache.mSubjectDescriptor, subjectDescriptor))
+    {
+        cache.Clear();
+        cache.mAccessControl     = this;
+        cache.mEntriesGeneration = mEntriesGeneration;
+        cache.mSubjectDescriptor = subjectDescriptor;
+    }
+
+    CHIP_ERROR result = CheckACL(subjectDescriptor, requestPath, requestPrivilege, &cache);
+
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+    if (result == CHIP_NO_ERROR)
+    {
+        result = CheckARL(subjectDescriptor, requestPath, requestPrivilege);
+    }
+#endif
+
+    return result;
+}
+
 CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
-                                   Privilege requestPrivilege)
+                                   Privilege requestPrivilege, AccessDecisionCache * cache)
 {
 #if CHIP_PROGRESS_LOGGING && CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 1
     {
@@ -387,6 +428,36 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
         }
     }
 
+    if (cache == nullptr)
+    {
+        return CheckACLEntries(subjectDescriptor, requestPath, requestPrivilege);
+    }
+
+    for (size_t i = 0; i < cache->mCount; ++i)
+    {
+        const AccessDecisionCache::Decision & decision = cache->mDecisions[i];
+        if (decision.cluster == requestPath.cluster && decision.endpoint == requestPath.endpoint &&
+            decision.privilege == requestPrivilege)
+        {
+            return decision.allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+        }
+    }
+
+    CHIP_ERROR result = CheckACLEntries(subjectDescriptor, requestPath, requestPrivilege);
+    // Errors other than denial are not decisions, let them be retried.
+    if (result == CHIP_NO_ERROR || result == CHIP_ERROR_ACCESS_DENIED)
+    {
+        const bool allowed              = (result == CHIP_NO_ERROR);
+        cache->mDecisions[cache->mNext] = { requestPath.cluster, requestPath.endpoint, requestPrivilege, allowed };
+        cache->mNext                    = (cache->mNext + 1) % ArraySize(cache->mDecisions);
+        cache->mCount                   = std::min(cache->mCount + 1, ArraySize(cache->mDecisions));
+    }
+    return result;
+}
+
+CHIP_ERROR AccessControl::CheckACLEntries(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                          Privilege requestPrivilege)
+{
     // Operational PASE not supported for v1.0, so PASE implies commissioning, which has highest privilege.
     // Currently, subject descriptor is only PASE if this node is the responder (aka commissionee);
     // if this node is the initiator (aka commissioner) then the subject descriptor remains blank.
@@ -398,6 +469,31 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
         return CHIP_NO_ERROR;
     }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_ENTRY_INDEX
+    if (mEntryIndex.IsStale())
+    {
+        CHIP_ERROR err = mEntryIndex.Build(*this);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "AccessControl: index unavailable %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+
+    if (mEntryIndex.IsReady())
+    {
+        if (mEntryIndex.Check(subjectDescriptor, requestPath, requestPrivilege, *mDeviceTypeResolver))
+        {
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            ChipLogProgress(DataManagement, "AccessControl: allowed");
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            return CHIP_NO_ERROR;
+        }
+
+        ChipLogProgress(DataManagement, "AccessControl: denied");
+        return CHIP_ERROR_ACCESS_DENIED;
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_ENTRY_INDEX
+
     EntryIterator iterator;
     ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
 
@@ -709,6 +805,242 @@ void AccessControl::NotifyEntryChanged(const SubjectDescriptor * subjectDescript
     }
 }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_ENTRY_INDEX
+void AccessControl::EntryIndex::Release()
+{
+    mEntries.Free();
+    mSubjects.Free();
+    mTargets.Free();
+    mEntryCount   = 0;
+    mSubjectCount = 0;
+    mTargetCount  = 0;
+    mState        = State::kStale;
+}
+
+bool AccessControl::EntryIndex::SubjectLess(const IndexedSubject & a, const IndexedSubject & b)
+{
+    if (a.fabricIndex != b.fabricIndex)
+    {
+        return a.fabricIndex < b.fabricIndex;
+    }
+    if (a.authMode != b.authMode)
+    {
+        return a.authMode < b.authMode;
+    }
+    return a.subject < b.subject;
+}
+
+CHIP_ERROR AccessControl::EntryIndex::Build(const AccessControl & accessControl)
+{
+    Release();
+
+    CHIP_ERROR err = Fill(accessControl);
+    if (err != CHIP_NO_ERROR)
+    {
+        Release();
+        mState = State::kUnusable;
+        return err;
+    }
+
+    std::sort(mSubjects.Get(), mSubjects.Get() + mSubjectCount, SubjectLess);
+
+    mState = State::kReady;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AccessControl::EntryIndex::Fill(const AccessControl & accessControl)
+{
+    size_t entryCount   = 0;
+    size_t subjectCount = 0;
+    size_t targetCount  = 0;
+
+    // First pass sizes the arrays.
+    {
+        EntryIterator iterator;
+        ReturnErrorOnFailure(accessControl.Entries(iterator));
+
+        Entry entry;
+        while (iterator.Next(entry) == CHIP_NO_ERROR)
+        {
+            size_t count = 0;
+            ReturnErrorOnFailure(entry.GetSubjectCount(count));
+            subjectCount += (count > 0) ? count : 1;
+            ReturnErrorOnFailure(entry.GetTargetCount(count));
+            targetCount += count;
+            ++entryCount;
+        }
+    }
+
+    VerifyOrReturnError(entryCount <= UINT16_MAX && targetCount <= UINT16_MAX, CHIP_ERROR_NO_MEMORY);
+
+    if (entryCount == 0)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    VerifyOrReturnError(mEntries.Alloc(entryCount), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(mSubjects.Alloc(subjectCount), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(targetCount == 0 || mTargets.Alloc(targetCount), CHIP_ERROR_NO_MEMORY);
+
+    // Second pass copies the entries, rejecting those CheckACL would treat as an error.
+    EntryIterator iterator;
+    ReturnErrorOnFailure(accessControl.Entries(iterator));
+
+    Entry entry;
+    while (iterator.Next(entry) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(mEntryCount < entryCount, CHIP_ERROR_INCORRECT_STATE);
+        const auto entryIndex = static_cast<uint16_t>(mEntryCount);
+
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        AuthMode authMode       = AuthMode::kNone;
+        IndexedEntry & indexed  = mEntries[mEntryCount++];
+        ReturnErrorOnFailure(entry.GetFabricIndex(fabricIndex));
+        ReturnErrorOnFailure(entry.GetAuthMode(authMode));
+        ReturnErrorOnFailure(entry.GetPrivilege(indexed.privilege));
+        // Operational PASE not supported for v1.0.
+        VerifyOrReturnError(authMode == AuthMode::kCase || authMode == AuthMode::kGroup, CHIP_ERROR_INCORRECT_STATE);
+
+        size_t count = 0;
+        ReturnErrorOnFailure(entry.GetSubjectCount(count));
+        VerifyOrReturnError(mSubjectCount + ((count > 0) ? count : 1) <= subjectCount, CHIP_ERROR_INCORRECT_STATE);
+        for (size_t i = 0; i < count; ++i)
+        {
+            NodeId subject = kUndefinedNodeId;
+            ReturnErrorOnFailure(entry.GetSubject(i, subject));
+            if (IsOperationalNodeId(subject) || IsCASEAuthTag(subject))
+            {
+                VerifyOrReturnError(authMode == AuthMode::kCase, CHIP_ERROR_INCORRECT_STATE);
+            }
+            else
+            {
+                // Operational PASE not supported for v1.0.
+                VerifyOrReturnError(IsGroupId(subject) && authMode == AuthMode::kGroup, CHIP_ERROR_INCORRECT_STATE);
+            }
+            mSubjects[mSubjectCount++] = { subject, fabricIndex, authMode, entryIndex };
+        }
+        if (count == 0)
+        {
+            mSubjects[mSubjectCount++] = { kUndefinedNodeId, fabricIndex, authMode, entryIndex };
+        }
+
+        ReturnErrorOnFailure(entry.GetTargetCount(count));
+        VerifyOrReturnError(mTargetCount + count <= targetCount, CHIP_ERROR_INCORRECT_STATE);
+        indexed.targetStart = static_cast<uint16_t>(mTargetCount);
+        indexed.targetCount = static_cast<uint16_t>(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            Entry::Target target;
+            ReturnErrorOnFailure(entry.GetTarget(i, target));
+            mTargets[mTargetCount++] = { target.flags, target.cluster, target.endpoint, target.deviceType };
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool AccessControl::EntryIndex::Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                      Privilege requestPrivilege, DeviceTypeResolver & deviceTypeResolver) const
+{
+    // Entries without subjects grant access to any subject with the same auth mode.
+    if (CheckSubjects(subjectDescriptor, kUndefinedNodeId, kUndefinedNodeId, requestPath, requestPrivilege, deviceTypeResolver))
+    {
+        return true;
+    }
+
+    const NodeId subject = subjectDescriptor.subject;
+    if ((subjectDescriptor.authMode == AuthMode::kCase && IsOperationalNodeId(subject)) ||
+        (subjectDescriptor.authMode == AuthMode::kGroup && IsGroupId(subject)))
+    {
+        if (CheckSubjects(subjectDescriptor, subject, subject, requestPath, requestPrivilege, deviceTypeResolver))
+        {
+            return true;
+        }
+    }
+
+    if (subjectDescriptor.authMode == AuthMode::kCase)
+    {
+        // A CAT subject matches any CAT of the subject descriptor with the same identifier, so
+        // visit all versions of that identifier and let CheckSubjectAgainstCATs decide.
+        for (auto cat : subjectDescriptor.cats.values)
+        {
+            if (cat == kUndefinedCAT)
+            {
+                continue;
+            }
+            const NodeId low  = NodeIdFromCASEAuthTag(cat) & ~kTagVersionMask;
+            const NodeId high = low | kTagVersionMask;
+            if (CheckSubjects(subjectDescriptor, low, high, requestPath, requestPrivilege, deviceTypeResolver))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool AccessControl::EntryIndex::CheckSubjects(const SubjectDescriptor & subjectDescriptor, NodeId low, NodeId high,
+                                              const RequestPath & requestPath, Privilege requestPrivilege,
+                                              DeviceTypeResolver & deviceTypeResolver) const
+{
+    const IndexedSubject * const begin = mSubjects.Get();
+    const IndexedSubject * const end   = begin + mSubjectCount;
+    const IndexedSubject key           = { low, subjectDescriptor.fabricIndex, subjectDescriptor.authMode, 0 };
+    const IndexedSubject * it          = std::lower_bound(begin, end, key, SubjectLess);
+
+    for (; it != end && it->fabricIndex == key.fabricIndex && it->authMode == key.authMode && it->subject <= high; ++it)
+    {
+        if (IsCASEAuthTag(it->subject) && !subjectDescriptor.cats.CheckSubjectAgainstCATs(it->subject))
+        {
+            continue;
+        }
+        if (CheckEntry(mEntries[it->entry], requestPath, requestPrivilege, deviceTypeResolver))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool AccessControl::EntryIndex::CheckEntry(const IndexedEntry & entry, const RequestPath & requestPath, Privilege requestPrivilege,
+                                           DeviceTypeResolver & deviceTypeResolver) const
+{
+    if (!CheckRequestPrivilegeAgainstEntryPrivilege(requestPrivilege, entry.privilege))
+    {
+        return false;
+    }
+
+    if (entry.targetCount == 0)
+    {
+        return true;
+    }
+
+    const IndexedTarget * const targets = mTargets.Get() + entry.targetStart;
+    for (size_t i = 0; i < entry.targetCount; ++i)
+    {
+        const IndexedTarget & target = targets[i];
+        if ((target.flags & Entry::Target::kCluster) && target.cluster != requestPath.cluster)
+        {
+            continue;
+        }
+        if ((target.flags & Entry::Target::kEndpoint) && target.endpoint != requestPath.endpoint)
+        {
+            continue;
+        }
+        if ((target.flags & Entry::Target::kDeviceType) &&
+            !deviceTypeResolver.IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint))
+        {
+            continue;
+        }
+        return true;
+    }
+
+    return false;
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_ENTRY_INDEX
+
 AccessControl & GetAccessControl()
 {
     return (globalAccessControl) ? *globalAccessControl : defaultAccessControl.get();
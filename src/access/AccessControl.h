@@ -24,6 +24,7 @@
 #include "AccessRestrictionProvider.h"
 #endif
 
+#include "AccessDecisionCache.h"
 #include "Privilege.h"
 #include "RequestPath.h"
 #include "SubjectDescriptor.h"
@@ -31,6 +32,7 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/core/Global.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
 
 // Dump function for use during development only (0 for disabled, non-zero for enabled).
 #define CHIP_ACCESS_CONTROL_DUMP_ENABLED 0
@@ -397,6 +399,9 @@ public:
         // Return CHIP_NO_ERROR if allowed, CHIP_ERROR_ACCESS_DENIED if denied,
         // CHIP_ERROR_NOT_IMPLEMENTED to use the default check algorithm (against entries),
         // or any other CHIP_ERROR if another error occurred.
+        // Called for every request, including checks made with an AccessDecisionCache: only
+        // decisions of the default check algorithm are memoized, so this may depend on the
+        // whole request path (including request type and entity).
         virtual CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
                                  Privilege requestPrivilege)
         {
@@ -503,6 +508,7 @@ public:
     {
         VerifyOrReturnError(IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        OnEntriesModified();
         return mDelegate->CreateEntry(index, entry, fabricIndex);
     }
 
@@ -553,6 +559,7 @@ public:
     {
         VerifyOrReturnError(IsValid(entry), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        OnEntriesModified();
         return mDelegate->UpdateEntry(index, entry, fabricIndex);
     }
 
@@ -574,6 +581,7 @@ public:
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex = nullptr)
     {
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        OnEntriesModified();
         return mDelegate->DeleteEntry(index, fabricIndex);
     }
 
@@ -633,6 +641,13 @@ public:
     // Removes a listener from the listener list, if in the list.
     void RemoveEntryListener(EntryListener & listener);
 
+    /**
+     * Tells AccessControl that entries were changed without going through it, e.g. directly in the
+     * storage of the delegate. Everything derived from the entries (the entry index and memoized
+     * access decisions) is discarded, so the next check sees the change.
+     */
+    void OnEntriesChangedExternally() { OnEntriesModified(); }
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     // Set an optional AcceessRestriction object for MNGD feature.
     void SetAccessRestrictionProvider(AccessRestrictionProvider * accessRestrictionProvider)
@@ -662,13 +677,124 @@ public:
      */
     CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
 
+    /**
+     * Same as `Check` above, but access control list decisions are memoized in `cache` per
+     * endpoint, cluster and privilege, and reused for later checks of the same subject.
+     *
+     * Only decisions made from the entries are memoized. A delegate that implements
+     * `Delegate::Check` is still consulted for every request, since its decisions may depend
+     * on anything in the request path, such as the request type or entity.
+     */
+    CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                     AccessDecisionCache & cache);
+
 #if CHIP_ACCESS_CONTROL_DUMP_ENABLED
     CHIP_ERROR Dump(const Entry & entry);
 #endif
 
 private:
+#if CHIP_CONFIG_ACCESS_CONTROL_ENTRY_INDEX
+    /**
+     * Compiled copy of the access control list, used by CheckACL instead of iterating
+     * entries through the delegate.
+     *
+     * Entries are flattened into plain arrays, and their subjects are sorted by fabric,
+     * auth mode and subject, so a check only visits entries that name the requesting
+     * subject (or one of its CATs), or have no subjects at all.
+     */
+    class EntryIndex
+    {
+    public:
+        EntryIndex() = default;
+
+        EntryIndex(const EntryIndex &)             = delete;
+        EntryIndex & operator=(const EntryIndex &) = delete;
+
+        // Marks the index out of date; it is rebuilt on next use.
+        void Invalidate() { mState = State::kStale; }
+
+        // Frees the index and marks it out of date.
+        void Release();
+
+        bool IsStale() const { return mState == State::kStale; }
+        bool IsReady() const { return mState == State::kReady; }
+
+        /**
+         * Rebuilds the index from the entries of the access control list.
+         *
+         * On failure the index is left unusable (until invalidated again), so callers
+         * fall back to checking entries directly, which reports the offending entry.
+         */
+        CHIP_ERROR Build(const AccessControl & accessControl);
+
+        // Returns whether any indexed entry grants the request. Index must be ready.
+        bool Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                   DeviceTypeResolver & deviceTypeResolver) const;
+
+    private:
+        enum class State : uint8_t
+        {
+            kStale,
+            kReady,
+            kUnusable,
+        };
+
+        struct IndexedEntry
+        {
+            Privilege privilege;
+            uint16_t targetStart;
+            uint16_t targetCount;
+        };
+
+        // Entries without subjects are indexed once with `subject` set to kUndefinedNodeId.
+        struct IndexedSubject
+        {
+            NodeId subject;
+            FabricIndex fabricIndex;
+            AuthMode authMode;
+            uint16_t entry;
+        };
+
+        struct IndexedTarget
+        {
+            Entry::Target::Flags flags;
+            ClusterId cluster;
+            EndpointId endpoint;
+            DeviceTypeId deviceType;
+        };
+
+        static bool SubjectLess(const IndexedSubject & a, const IndexedSubject & b);
+
+        CHIP_ERROR Fill(const AccessControl & accessControl);
+
+        // Checks entries indexed under subjects in [low, high] for the fabric and auth mode of the subject descriptor.
+        bool CheckSubjects(const SubjectDescriptor & subjectDescriptor, NodeId low, NodeId high, const RequestPath & requestPath,
+                           Privilege requestPrivilege, DeviceTypeResolver & deviceTypeResolver) const;
+
+        bool CheckEntry(const IndexedEntry & entry, const RequestPath & requestPath, Privilege requestPrivilege,
+                        DeviceTypeResolver & deviceTypeResolver) const;
+
+        Platform::ScopedMemoryBuffer<IndexedEntry> mEntries;
+        Platform::ScopedMemoryBuffer<IndexedSubject> mSubjects;
+        Platform::ScopedMemoryBuffer<IndexedTarget> mTargets;
+        size_t mEntryCount   = 0;
+        size_t mSubjectCount = 0;
+        size_t mTargetCount  = 0;
+        State mState         = State::kStale;
+    };
+#endif // CHIP_CONFIG_ACCESS_CONTROL_ENTRY_INDEX
+
     bool IsInitialized() const { return (mDelegate != nullptr); }
 
+    // Invalidates everything derived from the entries: the index and memoized decisions.
+    void OnEntriesModified()
+    {
+        ++mEntriesGeneration;
+#if CHIP_CONFIG_ACCESS_CONTROL_ENTRY_INDEX
+        mEntryIndex.Invalidate();
+#endif
+    }
+
     bool IsValid(const Entry & entry);
 
     void NotifyEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
@@ -677,8 +803,18 @@ private:
     /**
      * Check ACL for whether access (by a subject descriptor, to a request path,
      * requiring a privilege) should be allowed or denied.
+     *
+     * If `cache` is not null, decisions made from the entries are memoized in it. Decisions
+     * of the delegate are not.
      */
-    CHIP_ERROR CheckACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
+    CHIP_ERROR CheckACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege,
+                        AccessDecisionCache * cache = nullptr);
+
+    /**
+     * Check the entries of the ACL, see CheckACL.
+     */
+    CHIP_ERROR CheckACLEntries(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                               Privilege requestPrivilege);
 
     /**
      * Check CommissioningARL or ARL (as appropriate) for whether access (by a
@@ -694,6 +830,13 @@ private:
 
     EntryListener * mEntryListener = nullptr;
 
+    // Incremented on every change of the entries, see AccessDecisionCache.
+    uint32_t mEntriesGeneration = 0;
+
+#if CHIP_CONFIG_ACCESS_CONTROL_ENTRY_INDEX
+    EntryIndex mEntryIndex;
+#endif
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     AccessRestrictionProvider * mAccessRestrictionProvider;
 #endif
@@ -0,0 +1,72 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include "Privilege.h"
+#include "SubjectDescriptor.h"
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Access {
+
+class AccessControl;
+
+static_assert(CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0, "Decision cache must hold at least one decision");
+
+/**
+ * Memoizes access control list decisions made for one subject, so that checks repeated
+ * for many paths of the same cluster instance (e.g. while expanding a wildcard read)
+ * evaluate the access control list only once.
+ *
+ * Meant to be scoped to a single interaction, see `AccessControl::Check`. Decisions are
+ * dropped when used with a different subject or access control instance, or once the
+ * access control list has been modified. Access restrictions and decisions of a delegate
+ * implementing `Delegate::Check` are never memoized, since they may also depend on the
+ * requested attribute, command or event.
+ */
+class AccessDecisionCache
+{
+public:
+    void Clear() { mCount = 0; }
+
+private:
+    friend class AccessControl;
+
+    struct Decision
+    {
+        ClusterId cluster;
+        EndpointId endpoint;
+        Privilege privilege;
+        bool allowed;
+    };
+
+    const AccessControl * mAccessControl = nullptr;
+    uint32_t mEntriesGeneration          = 0;
+    SubjectDescriptor mSubjectDescriptor;
+    Decision mDecisions[CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE];
+    size_t mCount = 0;
+    size_t mNext  = 0;
+};
+
+} // namespace Access
+} // namespace chip
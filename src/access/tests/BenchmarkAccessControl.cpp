@@ -0,0 +1,174 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Timing benchmark of AccessControl::Check with a full access control list,
+ *      with and without an AccessDecisionCache.
+ */
+
+#include "access/AccessControl.h"
+#include "access/examples/ExampleAccessControlDelegate.h"
+
+#include <pw_unit_test/framework.h>
+
+#include <inttypes.h>
+
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Access;
+
+using Entry  = AccessControl::Entry;
+using Target = Entry::Target;
+
+constexpr ClusterId kOnOffCluster        = 0x0000'0006;
+constexpr ClusterId kColorControlCluster = 0x0000'0300;
+
+constexpr NodeId kFirstSubject = 0x0123456789ABCDEF;
+
+constexpr size_t kSubjectsPerEntry = 3;
+constexpr size_t kTargetsPerEntry  = 3;
+constexpr size_t kIterations       = 2000;
+
+AccessControl accessControl;
+
+class NoDeviceTypeResolver : public AccessControl::DeviceTypeResolver
+{
+public:
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+} deviceTypeResolver;
+
+class BenchmarkAccessControl : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+        SetAccessControl(accessControl);
+        VerifyOrDie(GetAccessControl().Init(Examples::GetAccessControlDelegate(), deviceTypeResolver) == CHIP_NO_ERROR);
+    }
+    static void TearDownTestSuite()
+    {
+        GetAccessControl().Finish();
+        ResetAccessControlToDefault();
+        chip::Platform::MemoryShutdown();
+    }
+
+    void SetUp() override
+    {
+        while (accessControl.DeleteEntry(0) == CHIP_NO_ERROR)
+        {
+        }
+
+        // Fill every fabric with entries naming distinct subjects and targets, so a check that
+        // only matches the very last entry has to rule out all the others first.
+        size_t maxEntriesPerFabric = 0;
+        ASSERT_EQ(accessControl.GetMaxEntriesPerFabric(maxEntriesPerFabric), CHIP_NO_ERROR);
+
+        mEntryCount = 0;
+        for (FabricIndex fabricIndex = 1; fabricIndex <= CHIP_CONFIG_MAX_FABRICS; ++fabricIndex)
+        {
+            for (size_t i = 0; i < maxEntriesPerFabric; ++i, ++mEntryCount)
+            {
+                Entry entry;
+                ASSERT_EQ(accessControl.PrepareEntry(entry), CHIP_NO_ERROR);
+                ASSERT_EQ(entry.SetFabricIndex(fabricIndex), CHIP_NO_ERROR);
+                ASSERT_EQ(entry.SetPrivilege(Privilege::kOperate), CHIP_NO_ERROR);
+                ASSERT_EQ(entry.SetAuthMode(AuthMode::kCase), CHIP_NO_ERROR);
+                for (size_t j = 0; j < kSubjectsPerEntry; ++j)
+                {
+                    ASSERT_EQ(entry.AddSubject(nullptr, kFirstSubject + mEntryCount * kSubjectsPerEntry + j), CHIP_NO_ERROR);
+                }
+                for (size_t j = 0; j < kTargetsPerEntry; ++j)
+                {
+                    const Target target = { .flags    = Target::kCluster | Target::kEndpoint,
+                                            .cluster  = static_cast<ClusterId>(kOnOffCluster + j),
+                                            .endpoint = static_cast<EndpointId>(mEntryCount + 1) };
+                    ASSERT_EQ(entry.AddTarget(nullptr, target), CHIP_NO_ERROR);
+                }
+                ASSERT_EQ(accessControl.CreateEntry(nullptr, entry), CHIP_NO_ERROR);
+            }
+        }
+
+        const auto lastEndpoint = static_cast<EndpointId>(mEntryCount);
+        mSubjectDescriptor      = { .fabricIndex = CHIP_CONFIG_MAX_FABRICS,
+                                    .authMode    = AuthMode::kCase,
+                                    .subject     = kFirstSubject + mEntryCount * kSubjectsPerEntry - 1 };
+        mAllowedPath            = { .cluster = kOnOffCluster + kTargetsPerEntry - 1, .endpoint = lastEndpoint };
+        mDeniedPath             = { .cluster = kColorControlCluster, .endpoint = lastEndpoint };
+    }
+
+    size_t mEntryCount = 0;
+    SubjectDescriptor mSubjectDescriptor;
+    RequestPath mAllowedPath;
+    RequestPath mDeniedPath;
+};
+
+TEST_F(BenchmarkAccessControl, CheckFullAcl)
+{
+    size_t allowed = 0;
+    size_t denied  = 0;
+
+    System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    for (size_t i = 0; i < kIterations; ++i)
+    {
+        allowed += (accessControl.Check(mSubjectDescriptor, mAllowedPath, Privilege::kOperate) == CHIP_NO_ERROR) ? 1 : 0;
+        denied += (accessControl.Check(mSubjectDescriptor, mDeniedPath, Privilege::kOperate) == CHIP_ERROR_ACCESS_DENIED) ? 1 : 0;
+    }
+    System::Clock::Microseconds64 elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+    EXPECT_EQ(allowed, kIterations);
+    EXPECT_EQ(denied, kIterations);
+
+    ChipLogProgress(DataManagement, "%u entries (index %s): %u checks in %" PRIu64 " us", static_cast<unsigned>(mEntryCount),
+                    CHIP_CONFIG_ACCESS_CONTROL_ENTRY_INDEX ? "on" : "off", static_cast<unsigned>(2 * kIterations),
+                    elapsed.count());
+}
+
+TEST_F(BenchmarkAccessControl, CheckFullAclWithDecisionCache)
+{
+    // Same checks as made while expanding a wildcard read, with decisions memoized per interaction.
+    AccessDecisionCache cache;
+    size_t allowed = 0;
+    size_t denied  = 0;
+
+    System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    for (size_t i = 0; i < kIterations; ++i)
+    {
+        allowed += (accessControl.Check(mSubjectDescriptor, mAllowedPath, Privilege::kOperate, cache) == CHIP_NO_ERROR) ? 1 : 0;
+        denied +=
+            (accessControl.Check(mSubjectDescriptor, mDeniedPath, Privilege::kOperate, cache) == CHIP_ERROR_ACCESS_DENIED) ? 1 : 0;
+    }
+    System::Clock::Microseconds64 elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+    EXPECT_EQ(allowed, kIterations);
+    EXPECT_EQ(denied, kIterations);
+
+    ChipLogProgress(DataManagement, "%u entries (index %s): %u memoized checks in %" PRIu64 " us",
+                    static_cast<unsigned>(mEntryCount), CHIP_CONFIG_ACCESS_CONTROL_ENTRY_INDEX ? "on" : "off",
+                    static_cast<unsigned>(2 * kIterations), elapsed.count());
+}
+
+} // namespace
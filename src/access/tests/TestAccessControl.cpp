@@ -23,6 +23,7 @@
 
 #include <lib/core/CHIPCore.h>
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
 
 namespace chip {
 namespace Access {
@@ -419,10 +420,19 @@ constexpr DeviceTypeId invalidDeviceTypes[] = {
 };
 // clang-format on
 
+constexpr DeviceTypeId kResolvedDeviceType = 0x0000'0100;
+constexpr EndpointId kResolvedEndpoint     = 3;
+
 class DeviceTypeResolver : public AccessControl::DeviceTypeResolver
 {
 public:
-    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override
+    {
+        ++calls;
+        return deviceType == kResolvedDeviceType && endpoint == kResolvedEndpoint;
+    }
+
+    size_t calls = 0;
 } testDeviceTypeResolver;
 
 // For testing, supports one subject and target, allows any value (valid or invalid)
@@ -1084,6 +1094,7 @@ public: // protected
     void SetUp() override { ASSERT_EQ(ClearAccessControl(accessControl), CHIP_NO_ERROR); }
     static void SetUpTestSuite()
     {
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
         AccessControl::Delegate * delegate = Examples::GetAccessControlDelegate();
         SetAccessControl(accessControl);
         VerifyOrDie(GetAccessControl().Init(delegate, testDeviceTypeResolver) == CHIP_NO_ERROR);
@@ -1092,6 +1103,7 @@ public: // protected
     {
         GetAccessControl().Finish();
         ResetAccessControlToDefault();
+        chip::Platform::MemoryShutdown();
     }
 };
 
@@ -2195,5 +2207,127 @@ TEST_F(TestAccessControl, TestUpdateEntry)
     }
 }
 
+TEST_F(TestAccessControl, TestCheckAfterChange)
+{
+    const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId3 };
+    const RequestPath requestPath             = { .cluster = kAccessControlCluster, .endpoint = 0 };
+
+    // Entry 0 grants administer to the subject; the first check also builds any index.
+    EXPECT_EQ(LoadAccessControl(accessControl, entryData1, entryData1Count), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_NO_ERROR);
+
+    // Changes must be visible to the next check.
+    EXPECT_EQ(accessControl.DeleteEntry(0), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_ERROR_ACCESS_DENIED);
+
+    EXPECT_EQ(LoadAccessControl(accessControl, entryData1, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_NO_ERROR);
+
+    {
+        EntryData data = entryData1[0];
+        data.privilege = Privilege::kView;
+        Entry entry;
+        EXPECT_EQ(accessControl.PrepareEntry(entry), CHIP_NO_ERROR);
+        EXPECT_EQ(LoadEntry(entry, data), CHIP_NO_ERROR);
+        EXPECT_EQ(accessControl.UpdateEntry(nullptr, 1, kNumFabric1EntriesInEntryData1 - 1, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_NO_ERROR);
+
+    // Changes made directly through the delegate are seen once AccessControl is told about them.
+    {
+        const FabricIndex fabricIndex = 1;
+        Entry entry;
+        EXPECT_EQ(accessControl.PrepareEntry(entry), CHIP_NO_ERROR);
+        EXPECT_EQ(LoadEntry(entry, entryData1[0]), CHIP_NO_ERROR);
+        EXPECT_EQ(Examples::GetAccessControlDelegate()->UpdateEntry(kNumFabric1EntriesInEntryData1 - 1, entry, &fabricIndex),
+                  CHIP_NO_ERROR);
+    }
+    accessControl.OnEntriesChangedExternally();
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_NO_ERROR);
+}
+
+TEST_F(TestAccessControl, TestCheckWithDecisionCache)
+{
+    EntryData data;
+    data.fabricIndex = 1;
+    data.privilege   = Privilege::kOperate;
+    data.authMode    = AuthMode::kCase;
+    data.AddSubject(nullptr, kOperationalNodeId1);
+    data.AddTarget(nullptr, { .flags = Target::kDeviceType, .deviceType = kResolvedDeviceType });
+    EXPECT_EQ(LoadAccessControl(accessControl, &data, 1), CHIP_NO_ERROR);
+
+    const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+    const SubjectDescriptor otherSubject      = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId2 };
+    RequestPath requestPath                   = { .cluster = kOnOffCluster, .endpoint = kResolvedEndpoint };
+
+    AccessDecisionCache cache;
+    testDeviceTypeResolver.calls = 0;
+
+    // Device type resolution only happens when the access control list is actually evaluated.
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate, cache), CHIP_NO_ERROR);
+    EXPECT_EQ(testDeviceTypeResolver.calls, 1u);
+
+    // Other attributes of the same cluster instance reuse the decision.
+    for (AttributeId attribute = 0; attribute < 8; ++attribute)
+    {
+        requestPath.entityId = attribute;
+        EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate, cache), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(testDeviceTypeResolver.calls, 1u);
+
+    // Another privilege, endpoint or subject is a different decision.
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kManage, cache), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kManage, cache), CHIP_ERROR_ACCESS_DENIED);
+    requestPath.endpoint = kResolvedEndpoint + 1;
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate, cache), CHIP_ERROR_ACCESS_DENIED);
+    requestPath.endpoint = kResolvedEndpoint;
+    EXPECT_EQ(accessControl.Check(otherSubject, requestPath, Privilege::kOperate, cache), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate, cache), CHIP_NO_ERROR);
+    EXPECT_EQ(testDeviceTypeResolver.calls, 3u);
+
+    // Changing the access control list drops memoized decisions.
+    EXPECT_EQ(accessControl.DeleteEntry(0), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate, cache), CHIP_ERROR_ACCESS_DENIED);
+}
+
+TEST_F(TestAccessControl, TestCheckWithDecisionCacheAndDelegateCheck)
+{
+    // Allows reads only. Decision caches do not key on the request type, so this must be asked every time.
+    class ReadOnlyDelegate : public AccessControl::Delegate
+    {
+    public:
+        CHIP_ERROR Check(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                         Privilege requestPrivilege) override
+        {
+            ++calls;
+            return (requestPath.requestType == RequestType::kAttributeReadRequest) ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+        }
+
+        size_t calls = 0;
+    } delegate;
+
+    AccessControl readOnlyAccessControl;
+    ASSERT_EQ(readOnlyAccessControl.Init(&delegate, testDeviceTypeResolver), CHIP_NO_ERROR);
+
+    const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+    RequestPath requestPath                   = { .cluster     = kOnOffCluster,
+                                                  .endpoint    = 1,
+                                                  .requestType = RequestType::kAttributeReadRequest,
+                                                  .entityId    = 0 };
+
+    AccessDecisionCache cache;
+    EXPECT_EQ(readOnlyAccessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate, cache), CHIP_NO_ERROR);
+
+    requestPath.requestType = RequestType::kAttributeWriteRequest;
+    EXPECT_EQ(readOnlyAccessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate, cache), CHIP_ERROR_ACCESS_DENIED);
+
+    requestPath.requestType = RequestType::kAttributeReadRequest;
+    EXPECT_EQ(readOnlyAccessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate, cache), CHIP_NO_ERROR);
+    EXPECT_EQ(delegate.calls, 3u);
+
+    readOnlyAccessControl.Finish();
+}
+
 } // namespace Access
 } // namespace chip
@@ -146,7 +146,17 @@ public:
 
     bool TriedEncode() const { return mTriedEncode; }
 
-    const Access::SubjectDescriptor & GetSubjectDescriptor() const { return mSubjectDescriptor; }
+    const Access::SubjectDescriptor & GetSubjectDescriptor() const
+    {
+        mUsedSubjectDescriptor = true;
+        return mSubjectDescriptor;
+    }
+
+    /**
+     * Whether the subject descriptor (or accessing fabric) was looked at while encoding, i.e. whether
+     * the encoded value may be different for another reader.
+     */
+    bool UsedSubjectDescriptor() const { return mUsedSubjectDescriptor; }
 
     /**
      * The accessing fabric index for this read or subscribe interaction.
@@ -245,6 +255,8 @@ private:
     DataVersion mDataVersion;
     bool mTriedEncode      = false;
     bool mIsFabricFiltered = false;
+    // Set by GetSubjectDescriptor(), so that reader-independent values can be shared between reports.
+    mutable bool mUsedSubjectDescriptor = false;
     // mEncodingInitialList is true if we're encoding a list and we have not
     // started chunking it yet, so we're encoding a single attribute report IB
     // for the whole list, not one per item.
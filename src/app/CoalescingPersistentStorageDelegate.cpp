@@ -0,0 +1,283 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/CoalescingPersistentStorageDelegate.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <string.h>
+#include <utility>
+
+namespace chip {
+namespace app {
+
+CoalescingPersistentStorageDelegate::~CoalescingPersistentStorageDelegate()
+{
+    Shutdown();
+}
+
+CHIP_ERROR CoalescingPersistentStorageDelegate::Init(PersistentStorageDelegate * backing, System::Layer * systemLayer,
+                                                     System::Clock::Timeout flushWindow)
+{
+    VerifyOrReturnError(backing != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mBacking == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    mBacking     = backing;
+    mSystemLayer = systemLayer;
+    mFlushWindow = flushWindow;
+    return CHIP_NO_ERROR;
+}
+
+void CoalescingPersistentStorageDelegate::Shutdown()
+{
+    VerifyOrReturn(mBacking != nullptr);
+
+    CHIP_ERROR err = FlushPending();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(AppServer, "Dropping %u unflushed storage writes: %" CHIP_ERROR_FORMAT, static_cast<unsigned>(mPendingCount),
+                     err.Format());
+        for (size_t i = 0; i < mPendingCount; i++)
+        {
+            mPending[i].mValue.Free();
+        }
+        mPendingCount = 0;
+    }
+
+    if (mFlushScheduled)
+    {
+        mSystemLayer->CancelTimer(HandleFlushTimer, this);
+        mFlushScheduled = false;
+    }
+    mBacking     = nullptr;
+    mSystemLayer = nullptr;
+}
+
+CoalescingPersistentStorageDelegate::PendingWrite * CoalescingPersistentStorageDelegate::FindPending(const char * key)
+{
+    for (size_t i = 0; i < mPendingCount; i++)
+    {
+        if (strcmp(mPending[i].mKey, key) == 0)
+        {
+            return &mPending[i];
+        }
+    }
+    return nullptr;
+}
+
+CHIP_ERROR CoalescingPersistentStorageDelegate::SyncGetKeyValue(const char * key, void * buffer, uint16_t & size)
+{
+    VerifyOrReturnError(mBacking != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    PendingWrite * pending = FindPending(key);
+    if (pending == nullptr)
+    {
+        return mBacking->SyncGetKeyValue(key, buffer, size);
+    }
+
+    VerifyOrReturnError((buffer != nullptr) || (size == 0), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!pending->mIsDelete, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    VerifyOrReturnError(size != 0 || pending->mSize != 0, CHIP_NO_ERROR);
+    VerifyOrReturnError(buffer != nullptr, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    const uint16_t sizeToCopy = std::min(size, pending->mSize);
+    if (sizeToCopy > 0)
+    {
+        memcpy(buffer, pending->mValue.Get(), sizeToCopy);
+    }
+    size = sizeToCopy;
+    return (sizeToCopy < pending->mSize) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CoalescingPersistentStorageDelegate::SyncSetKeyValue(const char * key, const void * value, uint16_t size)
+{
+    VerifyOrReturnError(mBacking != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError((value != nullptr) || (size == 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    return AddPending(key, value, size, /* isDelete = */ false);
+}
+
+CHIP_ERROR CoalescingPersistentStorageDelegate::SyncDeleteKeyValue(const char * key)
+{
+    VerifyOrReturnError(mBacking != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Report a missing key now, since the caller will not see the result of the deferred delete.
+    PendingWrite * pending = FindPending(key);
+    if (pending != nullptr)
+    {
+        VerifyOrReturnError(!pending->mIsDelete, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    }
+    else
+    {
+        VerifyOrReturnError(mBacking->SyncDoesKeyExist(key), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    }
+
+    return AddPending(key, nullptr, 0, /* isDelete = */ true);
+}
+
+bool CoalescingPersistentStorageDelegate::SyncDoesKeyExist(const char * key)
+{
+    VerifyOrReturnValue(mBacking != nullptr && key != nullptr, false);
+
+    PendingWrite * pending = FindPending(key);
+    if (pending != nullptr)
+    {
+        return !pending->mIsDelete;
+    }
+    return mBacking->SyncDoesKeyExist(key);
+}
+
+CHIP_ERROR CoalescingPersistentStorageDelegate::SyncFlush()
+{
+    VerifyOrReturnError(mBacking != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    ReturnErrorOnFailure(FlushPending());
+    return mBacking->SyncFlush();
+}
+
+CHIP_ERROR CoalescingPersistentStorageDelegate::AddPending(const char * key, const void * value, uint16_t size, bool isDelete)
+{
+    const size_t keyLength = strlen(key);
+    if (keyLength > kKeyLengthMax)
+    {
+        // Keys too long to buffer are written through, after everything buffered so far to keep the order.
+        ReturnErrorOnFailure(FlushPending());
+        return isDelete ? mBacking->SyncDeleteKeyValue(key) : mBacking->SyncSetKeyValue(key, value, size);
+    }
+
+    Platform::ScopedMemoryBuffer<uint8_t> copy;
+    if (size > 0)
+    {
+        VerifyOrReturnError(copy.Alloc(size), CHIP_ERROR_NO_MEMORY);
+        memcpy(copy.Get(), value, size);
+    }
+
+    PendingWrite * entry = FindPending(key);
+    if (entry != nullptr)
+    {
+        mStats.mCoalesced++;
+    }
+    else
+    {
+        if (mPendingCount == kMaxPendingWrites)
+        {
+            ReturnErrorOnFailure(FlushPending());
+        }
+        entry = &mPending[mPendingCount++];
+        memcpy(entry->mKey, key, keyLength + 1);
+    }
+
+    entry->mIsDelete = isDelete;
+    entry->mSize     = size;
+    entry->mValue.Free();
+    entry->mValue = std::move(copy);
+    mStats.mMutations++;
+
+    ScheduleFlush();
+    return CHIP_NO_ERROR;
+}
+
+void CoalescingPersistentStorageDelegate::ScheduleFlush()
+{
+    VerifyOrReturn(mSystemLayer != nullptr && !mFlushScheduled);
+
+    CHIP_ERROR err = mSystemLayer->StartTimer(mFlushWindow, HandleFlushTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        // The writes stay buffered until the next barrier, overflow or successfully scheduled flush.
+        ChipLogError(AppServer, "Failed to schedule storage flush: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mFlushScheduled = true;
+}
+
+void CoalescingPersistentStorageDelegate::HandleFlushTimer(System::Layer * systemLayer, void * context)
+{
+    auto * self           = static_cast<CoalescingPersistentStorageDelegate *>(context);
+    self->mFlushScheduled = false;
+
+    CHIP_ERROR err = self->FlushPending();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(AppServer, "Deferred storage flush failed, %u writes still pending: %" CHIP_ERROR_FORMAT,
+                     static_cast<unsigned>(self->mPendingCount), err.Format());
+    }
+}
+
+CHIP_ERROR CoalescingPersistentStorageDelegate::FlushPending()
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    size_t flushed = 0;
+    for (; flushed < mPendingCount; flushed++)
+    {
+        PendingWrite & write = mPending[flushed];
+        if (write.mIsDelete)
+        {
+            // The key may already be gone if it was created and deleted within this batch.
+            err = mBacking->SyncDeleteKeyValue(write.mKey);
+            if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+            {
+                err = CHIP_NO_ERROR;
+            }
+        }
+        else
+        {
+            err = mBacking->SyncSetKeyValue(write.mKey, write.mValue.Get(), write.mSize);
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            break;
+        }
+        mStats.mBackingMutations++;
+    }
+
+    if (flushed > 0)
+    {
+        mStats.mFlushes++;
+
+        // Keep the writes that were not flushed, in order, at the front of the array.
+        for (size_t i = 0; i < mPendingCount; i++)
+        {
+            mPending[i].mValue.Free();
+            if (i + flushed < mPendingCount)
+            {
+                PendingWrite & from = mPending[i + flushed];
+                memcpy(mPending[i].mKey, from.mKey, sizeof(from.mKey));
+                mPending[i].mIsDelete = from.mIsDelete;
+                mPending[i].mSize     = from.mSize;
+                mPending[i].mValue    = std::move(from.mValue);
+            }
+        }
+        mPendingCount -= flushed;
+    }
+
+    if (mPendingCount == 0 && mFlushScheduled)
+    {
+        mSystemLayer->CancelTimer(HandleFlushTimer, this);
+        mFlushScheduled = false;
+    }
+
+    return err;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,123 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/support/ScopedBuffer.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * PersistentStorageDelegate decorator that buffers mutations and writes them to a backing delegate
+ * together, so a burst of writes (e.g. while a fabric is being commissioned) reaches storage at one
+ * point in time and repeated writes to a key are only written once.
+ *
+ * Mutations are kept in RAM and served back by SyncGetKeyValue until they are flushed. Repeated
+ * writes to the same key before a flush are coalesced into the last one. A flush happens:
+ *   - on the event loop after the configured flush window (by default, on the next turn of the loop);
+ *   - immediately, when a mutation to a new key would exceed the pending capacity;
+ *   - when SyncFlush() is called, which callers use as a barrier before depending on durability;
+ *   - on Shutdown().
+ *
+ * A flush issues one SyncSetKeyValue/SyncDeleteKeyValue to the backing delegate per pending key, in
+ * the order the keys were first written in the batch. PersistentStorageDelegate has no multi-key
+ * transaction, so the batch is not atomic: a reboot during a flush can leave a subset of it applied,
+ * exactly as if the same writes had been issued one by one. Callers that need several keys to change
+ * together must keep using their own consistency scheme (e.g. FabricTable's pending commit markers).
+ *
+ * Must only be used from the Matter thread.
+ */
+class CoalescingPersistentStorageDelegate : public PersistentStorageDelegate
+{
+public:
+    static constexpr size_t kMaxPendingWrites = CHIP_CONFIG_COALESCING_STORAGE_MAX_PENDING_WRITES;
+
+    struct Stats
+    {
+        uint32_t mMutations        = 0; // SyncSetKeyValue/SyncDeleteKeyValue calls that were buffered
+        uint32_t mCoalesced        = 0; // buffered mutations that replaced an earlier pending one
+        uint32_t mFlushes          = 0; // flushes that wrote at least one mutation
+        uint32_t mBackingMutations = 0; // mutations issued to the backing delegate
+    };
+
+    CoalescingPersistentStorageDelegate() = default;
+    ~CoalescingPersistentStorageDelegate() override;
+
+    CoalescingPersistentStorageDelegate(const CoalescingPersistentStorageDelegate &)             = delete;
+    CoalescingPersistentStorageDelegate & operator=(const CoalescingPersistentStorageDelegate &) = delete;
+
+    /**
+     * @param backing      Storage that mutations are eventually written to. Must outlive this object.
+     * @param systemLayer  Used to schedule deferred flushes. If null, mutations are only flushed on
+     *                     overflow, SyncFlush() or Shutdown().
+     * @param flushWindow  How long to wait after the first buffered mutation before flushing.
+     */
+    CHIP_ERROR Init(PersistentStorageDelegate * backing, System::Layer * systemLayer,
+                    System::Clock::Timeout flushWindow = System::Clock::kZero);
+
+    /**
+     * Flush any pending mutations and detach from the backing delegate.
+     */
+    void Shutdown();
+
+    // PersistentStorageDelegate implementation.
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override;
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override;
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override;
+    bool SyncDoesKeyExist(const char * key) override;
+    CHIP_ERROR SyncFlush() override;
+
+    size_t GetPendingWriteCount() const { return mPendingCount; }
+    const Stats & GetStats() const { return mStats; }
+
+private:
+    struct PendingWrite
+    {
+        char mKey[kKeyLengthMax + 1];
+        bool mIsDelete;
+        uint16_t mSize;
+        Platform::ScopedMemoryBuffer<uint8_t> mValue;
+    };
+
+    static void HandleFlushTimer(System::Layer * systemLayer, void * context);
+
+    PendingWrite * FindPending(const char * key);
+    CHIP_ERROR AddPending(const char * key, const void * value, uint16_t size, bool isDelete);
+    void ScheduleFlush();
+    CHIP_ERROR FlushPending();
+
+    PersistentStorageDelegate * mBacking = nullptr;
+    System::Layer * mSystemLayer         = nullptr;
+    System::Clock::Timeout mFlushWindow  = System::Clock::kZero;
+    bool mFlushScheduled                 = false;
+
+    PendingWrite mPending[kMaxPendingWrites];
+    size_t mPendingCount = 0;
+
+    Stats mStats;
+};
+
+} // namespace app
+} // namespace chip
@@ -66,6 +66,7 @@ struct ReclaimEventCtx
 {
     CircularEventBuffer * mpEventBuffer = nullptr;
     size_t mSpaceNeededForMovedEvent    = 0;
+    EventNumber mMovedEventNumber       = 0;
 };
 
 /**
@@ -126,7 +127,7 @@ void EventManagement::Init(Messaging::ExchangeManager * apExchangeManager, uint3
     mMonotonicStartupTime = aMonotonicStartupTime;
 }
 
-CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer)
+CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer, EventNumber aEventNumber)
 {
     CircularTLVWriter writer;
     CircularTLVReader reader;
@@ -137,6 +138,7 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
     CircularEventBuffer backup = *nextBuffer;
+    const uint8_t * eventStart = nextBuffer->QueueTail();
 
     // Set up the next buffer s.t. it fails if needs to evict an element
     nextBuffer->mProcessEvictedElement = AlwaysFail;
@@ -155,6 +157,8 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = writer.Finalize();
     SuccessOrExit(err);
 
+    nextBuffer->IndexEvent(aEventNumber, eventStart);
+
     ChipLogDetail(EventLogging, "Copy Event to next buffer with priority %u", static_cast<unsigned>(nextBuffer->GetPriority()));
 exit:
     if (err != CHIP_NO_ERROR)
@@ -199,7 +203,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
 
             eventBuffer->mProcessEvictedElement = EvictEvent;
             eventBuffer->mAppData               = &ctx;
-            err                                 = eventBuffer->EvictHead();
+            err                                 = eventBuffer->EvictHeadEvent();
 
             // one of two things happened: either the element was evicted immediately if the head's priority is same as current
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
@@ -217,11 +221,11 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     // Since we're calling CopyElement and we've checked
                     // that there is space in the next buffer, we don't expect
                     // this to fail.
-                    err = CopyToNextBuffer(eventBuffer);
+                    err = CopyToNextBuffer(eventBuffer, ctx.mMovedEventNumber);
                     SuccessOrExit(err);
                     // success; evict head unconditionally
                     eventBuffer->mProcessEvictedElement = nullptr;
-                    err                                 = eventBuffer->EvictHead();
+                    err                                 = eventBuffer->EvictHeadEvent();
                     // if unconditional eviction failed, this
                     // means that we have no way of further
                     // clearing the buffer.  fail out and let the
@@ -427,6 +431,7 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     aEventNumber                 = 0;
     CircularTLVWriter checkpoint = writer;
     EventLoadOutContext ctxt     = EventLoadOutContext(writer, aEventOptions.mPriority, mLastEventNumber);
+    const uint8_t * eventStart   = nullptr;
     EventOptions opts;
 
     Timestamp timestamp;
@@ -447,6 +452,8 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     opts = EventOptions(timestamp);
     // Start the event container (anonymous structure) in the circular buffer
     writer.Init(*mpEventBuffer);
+    // Evicting events to make space below does not move the tail, where the event gets written.
+    eventStart = mpEventBuffer->QueueTail();
 
     opts.mPriority = aEventOptions.mPriority;
     // Create all event specific data
@@ -468,6 +475,7 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     err = ConstructEvent(&ctxt, apDelegate, &opts);
     SuccessOrExit(err);
 
+    mpEventBuffer->IndexEvent(ctxt.mCurrentEventNumber, eventStart);
     mBytesWritten += writer.GetLengthWritten();
 
 exit:
@@ -652,13 +660,28 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
     CHIP_ERROR err     = CHIP_NO_ERROR;
     const bool recurse = false;
     TLVReader reader;
+    CircularEventReader circularReader;
     CircularEventBufferWrapper bufWrapper;
     EventLoadOutContext context(aWriter, PriorityLevel::Invalid, aEventMin);
 
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
-    SuccessOrExit(err);
+
+    // Events are read in increasing event number order, from the oldest ones in the most critical buffer to the newest ones in
+    // the debug buffer, so the events numbered less than aEventMin can be skipped without decoding them.
+    for (bufWrapper.mpCurrent = GetPriorityBuffer(PriorityLevel::Critical); bufWrapper.mpCurrent != nullptr;
+         bufWrapper.mpCurrent = bufWrapper.mpCurrent->GetPreviousCircularEventBuffer())
+    {
+        if (bufWrapper.mpCurrent->FindFirstEventSince(aEventMin, bufWrapper.mpStartPoint, context.mCurrentEventNumber))
+        {
+            break;
+        }
+    }
+    // No new events.
+    VerifyOrExit(bufWrapper.mpCurrent != nullptr, err = CHIP_NO_ERROR);
+
+    circularReader.Init(&bufWrapper);
+    reader.Init(circularReader);
 
     err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
     if (err == CHIP_END_OF_TLV)
@@ -832,6 +855,7 @@ CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAp
     const PriorityLevel imp = static_cast<PriorityLevel>(context.mPriority);
 
     ReclaimEventCtx * const ctx             = static_cast<ReclaimEventCtx *>(apAppData);
+    ctx->mMovedEventNumber                  = context.mEventNumber;
     CircularEventBuffer * const eventBuffer = ctx->mpEventBuffer;
     if (eventBuffer->IsFinalDestinationForPriority(imp))
     {
@@ -868,6 +892,10 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
     mpPrev    = apPrev;
     mpNext    = apNext;
     mPriority = aPriorityLevel;
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    mIndexFirst = 0;
+    mIndexCount = 0;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
@@ -875,6 +903,110 @@ bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority)
     return !((mpNext != nullptr) && (mpNext->mPriority <= aPriority));
 }
 
+CHIP_ERROR CircularEventBuffer::EvictHeadEvent()
+{
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    const uint32_t headOffset = GetOffset(QueueHead());
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
+    ReturnErrorOnFailure(EvictHead());
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    // Only the most recent events are indexed, the evicted one may not be.
+    if (mIndexCount > 0 && mIndexOffsets[mIndexFirst] == headOffset)
+    {
+        mIndexFirst = GetIndexSlot(1);
+        mIndexCount--;
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    return CHIP_NO_ERROR;
+}
+
+void CircularEventBuffer::IndexEvent(EventNumber aEventNumber, const uint8_t * apEventStart)
+{
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    if (mIndexCount > 0 && mIndexEventNumbers[GetIndexSlot(static_cast<uint16_t>(mIndexCount - 1))] >= aEventNumber)
+    {
+        // Lookups rely on the events being ordered, start over rather than risk skipping events.
+        mIndexCount = 0;
+    }
+    if (mIndexCount == CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE)
+    {
+        mIndexFirst = GetIndexSlot(1);
+        mIndexCount--;
+    }
+
+    const uint16_t slot      = GetIndexSlot(mIndexCount++);
+    mIndexEventNumbers[slot] = aEventNumber;
+    mIndexOffsets[slot]      = GetOffset(apEventStart);
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+}
+
+bool CircularEventBuffer::FindFirstEventSince(EventNumber aEventMin, const uint8_t *& apStart, EventNumber & aLastEventNumber) const
+{
+    apStart = nullptr;
+    VerifyOrReturnValue(DataLength() != 0, false);
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    VerifyOrReturnValue(mIndexCount > 0, true);
+
+    const EventNumber lastEventNumber = mIndexEventNumbers[GetIndexSlot(static_cast<uint16_t>(mIndexCount - 1))];
+    if (lastEventNumber < aEventMin)
+    {
+        aLastEventNumber = lastEventNumber;
+        return false;
+    }
+
+    // Binary search for the first indexed event numbered aEventMin or more.
+    uint16_t low  = 0;
+    uint16_t high = static_cast<uint16_t>(mIndexCount - 1);
+    while (low < high)
+    {
+        const uint16_t middle = static_cast<uint16_t>((low + high) / 2);
+        if (mIndexEventNumbers[GetIndexSlot(middle)] < aEventMin)
+        {
+            low = static_cast<uint16_t>(middle + 1);
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    // Events older than the first indexed one may still be numbered aEventMin or more, so these need reading from the head.
+    const uint16_t slot = GetIndexSlot(low);
+    if (low > 0 || mIndexEventNumbers[slot] == aEventMin)
+    {
+        apStart = GetQueue() + mIndexOffsets[slot];
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    return true;
+}
+
+void CircularEventBuffer::GetReadableBufferFrom(const uint8_t * apStart, const uint8_t *& aBufStart, uint32_t & aBufLen) const
+{
+    const uint8_t * tail = QueueTail();
+
+    aBufStart = apStart;
+    if (apStart >= tail)
+    {
+        // The data wraps around the end of the storage.
+        aBufLen = GetTotalDataLength() - static_cast<uint32_t>(apStart - GetQueue());
+    }
+    else
+    {
+        aBufLen = static_cast<uint32_t>(tail - apStart);
+    }
+}
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+uint32_t CircularEventBuffer::GetOffset(const uint8_t * apPosition) const
+{
+    // The head may point right past the end of the storage, which is where its start is.
+    return static_cast<uint32_t>(apPosition - GetQueue()) % GetTotalDataLength();
+}
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
 /**
  * @brief
  * TLVCircularBuffer::OnInit can modify the state of the buffer, but we don't want that behavior here.
@@ -907,6 +1039,12 @@ void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
 CHIP_ERROR CircularEventBufferWrapper::GetNextBuffer(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
+    if (aBufStart == nullptr && mpStartPoint != nullptr)
+    {
+        mpCurrent->GetReadableBufferFrom(mpStartPoint, aBufStart, aBufLen);
+        mpStartPoint = nullptr;
+        ExitNow();
+    }
     mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
     SuccessOrExit(err);
 
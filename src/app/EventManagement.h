@@ -129,6 +129,45 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   Evict the oldest event of the buffer, keeping the event index up to date.
+     */
+    CHIP_ERROR EvictHeadEvent();
+
+    /**
+     * @brief
+     *   Add the event that was just written at the tail of the buffer to the event index.
+     *
+     * @param[in] aEventNumber  The number of the event.
+     *
+     * @param[in] apEventStart  Where the event starts in the buffer, i.e. the tail of the buffer before it was written.
+     */
+    void IndexEvent(EventNumber aEventNumber, const uint8_t * apEventStart);
+
+    /**
+     * @brief
+     *   Use the event index to find where to start reading the buffer to get every event numbered aEventMin or more.
+     *
+     * Events in a buffer are ordered by event number, so the index only has to remember the most recent ones.
+     *
+     * @param[in] aEventMin          The smallest event number of interest.
+     *
+     * @param[out] apStart           Where to start reading, or nullptr to start at the head of the buffer.
+     *
+     * @param[in,out] aLastEventNumber  Set to the number of the last event in the buffer when returning false.
+     *
+     * @retval true  The buffer may have events numbered aEventMin or more.
+     * @retval false All events in the buffer are numbered less than aEventMin.
+     */
+    bool FindFirstEventSince(EventNumber aEventMin, const uint8_t *& apStart, EventNumber & aLastEventNumber) const;
+
+    /**
+     * @brief
+     *   Get the contiguous data of the buffer starting at apStart, which must be the start of an event in the buffer.
+     */
+    void GetReadableBufferFrom(const uint8_t * apStart, const uint8_t *& aBufStart, uint32_t & aBufLen) const;
+
     ~CircularEventBuffer() override = default;
 
 private:
@@ -140,6 +179,22 @@ private:
 
     size_t mRequiredSpaceForEvicted = 0; ///< Required space for previous buffer to evict event to new buffer
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    static_assert(CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE <= UINT16_MAX, "Event index size must fit in 16 bits");
+
+    uint32_t GetOffset(const uint8_t * apPosition) const;
+    uint16_t GetIndexSlot(uint16_t aEntry) const
+    {
+        return static_cast<uint16_t>((mIndexFirst + aEntry) % CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE);
+    }
+
+    // Ring of the most recent events of the buffer, oldest first: their numbers and their offsets in the buffer.
+    EventNumber mIndexEventNumbers[CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE];
+    uint32_t mIndexOffsets[CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE];
+    uint16_t mIndexFirst = 0;
+    uint16_t mIndexCount = 0;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
     CHIP_ERROR OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
 };
 
@@ -156,6 +211,7 @@ class CircularEventBufferWrapper : public TLV::TLVCircularBuffer
 public:
     CircularEventBufferWrapper() : TLVCircularBuffer(nullptr, 0), mpCurrent(nullptr){};
     CircularEventBuffer * mpCurrent;
+    const uint8_t * mpStartPoint = nullptr; ///< Where to start reading mpCurrent, nullptr for its head.
 
 private:
     CHIP_ERROR GetNextBuffer(chip::TLV::TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override;
@@ -442,8 +498,10 @@ private:
      *
      * @param[in] apEventBuffer  CircularEventBuffer
      *
+     * @param[in] aEventNumber   The number of the event, to index it in the next buffer
+     *
      */
-    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer);
+    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer, EventNumber aEventNumber);
 
     /**
      * @brief Ensure that:
@@ -135,6 +135,8 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
 
     MoveToState(HandlerState::CanStartReporting);
 
+    mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().AddAttributeInterest(*this);
+
     SingleLinkedListNode<AttributePathParams> * attributePath = mpAttributePathList;
     while (attributePath)
     {
@@ -159,6 +161,7 @@ ReadHandler::~ReadHandler()
     {
         mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().OnReportConfirm();
     }
+    mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().RemoveAttributeInterest(*this);
     mManagementCallback.GetInteractionModelEngine()->ReleaseAttributePathList(mpAttributePathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseEventPathList(mpEventPathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
@@ -511,6 +514,7 @@ CHIP_ERROR ReadHandler::ProcessAttributePaths(AttributePathIBs::Parser & aAttrib
     {
         mManagementCallback.GetInteractionModelEngine()->RemoveDuplicateConcreteAttributePath(mpAttributePathList);
         mAttributePathExpandIterator.ResetTo(mpAttributePathList);
+        mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().AddAttributeInterest(*this);
         err = CHIP_NO_ERROR;
     }
     return err;
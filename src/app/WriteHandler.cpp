@@ -80,6 +80,7 @@ CHIP_ERROR WriteHandler::Init(DataModel::Provider * apProvider, WriteHandlerDele
     MoveToState(State::Initialized);
 
     mACLCheckCache.ClearValue();
+    mAccessDecisionCache.Clear();
     mProcessingAttributePath.ClearValue();
 
     return CHIP_NO_ERROR;
@@ -763,6 +764,7 @@ CHIP_ERROR WriteHandler::WriteClusterData(const Access::SubjectDescriptor & aSub
     request.path                = aPath;
     request.subjectDescriptor   = &aSubject;
     request.previousSuccessPath = mLastSuccessfullyWrittenPath;
+    request.accessDecisionCache = &mAccessDecisionCache;
     request.writeFlags.Set(DataModel::WriteFlags::kTimed, IsTimedWrite());
 
     AttributeValueDecoder decoder(aData, aSubject);
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <access/AccessDecisionCache.h>
 #include <app/AppConfig.h>
 #include <app/AttributeAccessToken.h>
 #include <app/AttributePathParams.h>
@@ -199,6 +200,7 @@ private:
     WriteResponseMessage::Builder mWriteResponseBuilder;
     Optional<ConcreteAttributePath> mProcessingAttributePath;
     Optional<AttributeAccessToken> mACLCheckCache = NullOptional;
+    Access::AccessDecisionCache mAccessDecisionCache;
 
     DataModel::Provider * mDataModelProvider = nullptr;
     std::optional<ConcreteAttributePath> mLastSuccessfullyWrittenPath;
@@ -175,6 +175,11 @@ public:
 private:
     // Iteration is often done in a tight loop going through all values.
     // To avoid N^2 iterations, cache a hint of where something is positioned
+    //
+    // A flattened snapshot of the ember metadata (contiguous endpoint/cluster/attribute arrays, rebuilt on
+    // endpoint changes) was measured against these hints on sequential and interleaved wildcard expansions
+    // of a 4 endpoint x 30 cluster x 26 attribute node. It was not faster and needs a RAM copy of the
+    // metadata, so lookups stay on ember.
     uint16_t mEndpointIterationHint   = 0;
     unsigned mClusterIterationHint    = 0;
     unsigned mAttributeIterationHint  = 0;
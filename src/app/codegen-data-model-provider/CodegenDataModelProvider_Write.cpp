@@ -165,8 +165,17 @@ DataModel::ActionReturnStatus CodegenDataModelProvider::WriteAttribute(const Dat
                                          .endpoint    = request.path.mEndpointId,
                                          .requestType = Access::RequestType::kAttributeWriteRequest,
                                          .entityId    = request.path.mAttributeId };
-        CHIP_ERROR err = Access::GetAccessControl().Check(*request.subjectDescriptor, requestPath,
-                                                          RequiredPrivilege::ForWriteAttribute(request.path));
+        const Access::Privilege privilege     = RequiredPrivilege::ForWriteAttribute(request.path);
+        Access::AccessControl & accessControl = Access::GetAccessControl();
+        CHIP_ERROR err;
+        if (request.accessDecisionCache != nullptr)
+        {
+            err = accessControl.Check(*request.subjectDescriptor, requestPath, privilege, *request.accessDecisionCache);
+        }
+        else
+        {
+            err = accessControl.Check(*request.subjectDescriptor, requestPath, privilege);
+        }
 
         if (err != CHIP_NO_ERROR)
         {
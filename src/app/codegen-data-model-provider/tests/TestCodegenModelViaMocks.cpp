@@ -869,6 +869,25 @@ void WriteLe16(void * buffer, uint16_t value)
 
 } // namespace
 
+TEST(TestCodegenModelViaMocks, MockEndpointConfigCopyIsSelfContained)
+{
+    std::optional<MockEndpointConfig> original;
+    original.emplace(kMockEndpoint1,
+                     std::initializer_list<MockClusterConfig>{
+                         MockClusterConfig(MockClusterId(1), { ClusterRevision::Id, FeatureMap::Id, MockAttributeId(1) }),
+                     });
+
+    MockEndpointConfig copy(*original);
+    original.reset();
+
+    // The ember clusters of the copy must reference the attribute metadata of its own cluster configs, not of the
+    // (now destroyed) original ones.
+    const EmberAfEndpointType * emberEndpoint = copy.emberEndpoint();
+    ASSERT_EQ(emberEndpoint->clusterCount, 1u);
+    EXPECT_EQ(emberEndpoint->cluster[0].attributes, copy.clusters[0].emberCluster()->attributes);
+    EXPECT_EQ(emberEndpoint->cluster[0].attributes[2].attributeId, MockAttributeId(1));
+}
+
 TEST(TestCodegenModelViaMocks, IterateOverEndpoints)
 {
     UseMockNodeConfig config(gTestNodeConfig);
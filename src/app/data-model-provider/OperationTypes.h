@@ -16,6 +16,7 @@
  */
 #pragma once
 
+#include <access/AccessDecisionCache.h>
 #include <access/SubjectDescriptor.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/ConcreteCommandPath.h>
@@ -99,6 +100,11 @@ struct WriteAttributeRequest : OperationRequest
     // callers are expected to keep track of a `previousSuccessPath` whenever a write succeeds (otherwise ACL
     // checks may fail)
     std::optional<ConcreteAttributePath> previousSuccessPath;
+
+    // Access decisions already made in the same write transaction, if the caller keeps any.
+    //
+    // Lets writes to several attributes of one cluster instance share a single ACL check.
+    chip::Access::AccessDecisionCache * accessDecisionCache = nullptr;
 };
 
 enum class InvokeFlags : uint32_t
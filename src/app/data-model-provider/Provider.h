@@ -67,6 +67,10 @@ public:
     ///      - Indicates that list encoding had insufficient buffer space to encode elements.
     ///      - encoder::GetState().AllowPartialData() determines if these errors are permanent (no partial
     ///        data allowed) or further encoding can be retried (AllowPartialData true for list encoding)
+    ///
+    /// Values that depend on the reader (accessing fabric, subject) MUST be obtained through
+    /// `encoder.GetSubjectDescriptor()`/`encoder.AccessingFabricIndex()` rather than `request.subjectDescriptor`:
+    /// the reporting engine shares the encoding of values that did not look at the reader between subscribers.
     virtual ActionReturnStatus ReadAttribute(const ReadAttributeRequest & request, AttributeValueEncoder & encoder) = 0;
 
     /// Requests a write of an attribute.
@@ -0,0 +1,102 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/AttributeInterestIndex.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+static_assert((AttributeInterestIndex::kBucketCount & (AttributeInterestIndex::kBucketCount - 1)) == 0,
+              "kBucketCount must be a power of two");
+
+size_t AttributeInterestIndex::BucketFor(EndpointId aEndpointId, ClusterId aClusterId)
+{
+    // Cluster ids of the same endpoint are often consecutive and vendor clusters share their upper bits,
+    // so mix both ids before keeping the low bits.
+    uint32_t hash = (aClusterId * 0x9E3779B1u) ^ (static_cast<uint32_t>(aEndpointId) * 0x85EBCA77u);
+    hash ^= hash >> 16;
+    return hash & (kBucketCount - 1);
+}
+
+CHIP_ERROR AttributeInterestIndex::Add(ReadHandler & aReadHandler, const SingleLinkedListNode<AttributePathParams> * aPaths)
+{
+    Remove(aReadHandler);
+
+    for (auto path = aPaths; path != nullptr; path = path->mpNext)
+    {
+        Entry * entry = mEntryPool.CreateObject();
+        if (entry == nullptr)
+        {
+            Remove(aReadHandler);
+            mOverflowed = true;
+            return CHIP_ERROR_NO_MEMORY;
+        }
+
+        const size_t bucket = BucketFor(path->mValue.mEndpointId, path->mValue.mClusterId);
+        entry->mReadHandler = &aReadHandler;
+        entry->mPath        = &path->mValue;
+        entry->mNext        = mBuckets[bucket];
+        mBuckets[bucket]    = entry;
+        mEntryCount++;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void AttributeInterestIndex::Remove(ReadHandler & aReadHandler)
+{
+    VerifyOrReturn(mEntryCount > 0);
+
+    for (Entry *& head : mBuckets)
+    {
+        Entry ** link = &head;
+        while (*link != nullptr)
+        {
+            Entry * entry = *link;
+            if (entry->mReadHandler != &aReadHandler)
+            {
+                link = &entry->mNext;
+                continue;
+            }
+            *link = entry->mNext;
+            mEntryPool.ReleaseObject(entry);
+            mEntryCount--;
+        }
+    }
+
+    if (mEntryCount == 0)
+    {
+        // Every handler that could not be indexed is gone as well.
+        mOverflowed = false;
+    }
+}
+
+void AttributeInterestIndex::Clear()
+{
+    mEntryPool.ReleaseAll();
+    for (Entry *& head : mBuckets)
+    {
+        head = nullptr;
+    }
+    mEntryCount = 0;
+    mOverflowed = false;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
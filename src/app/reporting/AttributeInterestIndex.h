@@ -0,0 +1,151 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/LinkedList.h>
+#include <lib/support/Pool.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+
+class ReadHandler;
+
+namespace reporting {
+
+/**
+ * Reverse index from (endpoint, cluster) to the attribute paths of the read handlers that cover it.
+ *
+ * Each attribute path of an indexed read handler is stored in a bucket chosen by its endpoint and
+ * cluster ids, where a wildcard id hashes as itself (kInvalidEndpointId / kInvalidClusterId). A change
+ * to a concrete (endpoint, cluster) can then only intersect paths in at most four buckets: the exact
+ * one and the three with wildcard endpoint and/or cluster. Buckets are shared between keys, so
+ * candidates still have to be checked with AttributePathParams::Intersects.
+ *
+ * The index references the read handlers' attribute path lists rather than copying them: a handler
+ * must be removed before its path list is changed or released.
+ */
+class AttributeInterestIndex
+{
+public:
+    static constexpr size_t kMaxEntries =
+        CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS;
+    static constexpr size_t kBucketCount = 64;
+
+    AttributeInterestIndex() = default;
+    ~AttributeInterestIndex() { Clear(); }
+
+    AttributeInterestIndex(const AttributeInterestIndex &)             = delete;
+    AttributeInterestIndex & operator=(const AttributeInterestIndex &) = delete;
+
+    /**
+     * Indexes every path of aPaths for aReadHandler, replacing any paths previously indexed for it.
+     *
+     * If the index runs out of entries, aReadHandler is left unindexed and the index is marked
+     * incomplete until it becomes empty again; callers must then visit all read handlers.
+     */
+    CHIP_ERROR Add(ReadHandler & aReadHandler, const SingleLinkedListNode<AttributePathParams> * aPaths);
+
+    /**
+     * Removes all the paths indexed for aReadHandler. It is not an error for it not to be indexed.
+     */
+    void Remove(ReadHandler & aReadHandler);
+
+    void Clear();
+
+    /**
+     * Returns false if some read handler could not be indexed, in which case ForEachCandidate may
+     * miss interested read handlers.
+     */
+    bool IsComplete() const { return !mOverflowed; }
+
+    bool IsEmpty() const { return mEntryCount == 0; }
+
+    /**
+     * Calls aFunction(ReadHandler &, const AttributePathParams &) for every indexed path that may
+     * intersect aChangedPath. A read handler is visited once per such path.
+     *
+     * aFunction must not add to or remove from the index.
+     */
+    template <typename Function>
+    void ForEachCandidate(const AttributePathParams & aChangedPath, Function && aFunction) const
+    {
+        if (aChangedPath.HasWildcardEndpointId() || aChangedPath.HasWildcardClusterId())
+        {
+            // Wildcard changes (e.g. a whole endpoint) are rare, visit everything.
+            for (const Entry * bucket : mBuckets)
+            {
+                VisitBucket(bucket, aFunction);
+            }
+            return;
+        }
+
+        const size_t buckets[] = {
+            BucketFor(aChangedPath.mEndpointId, aChangedPath.mClusterId),
+            BucketFor(kInvalidEndpointId, aChangedPath.mClusterId),
+            BucketFor(aChangedPath.mEndpointId, kInvalidClusterId),
+            BucketFor(kInvalidEndpointId, kInvalidClusterId),
+        };
+        for (size_t i = 0; i < ArraySize(buckets); i++)
+        {
+            bool alreadyVisited = false;
+            for (size_t j = 0; j < i; j++)
+            {
+                alreadyVisited = alreadyVisited || (buckets[j] == buckets[i]);
+            }
+            if (!alreadyVisited)
+            {
+                VisitBucket(mBuckets[buckets[i]], aFunction);
+            }
+        }
+    }
+
+private:
+    struct Entry
+    {
+        ReadHandler * mReadHandler;
+        const AttributePathParams * mPath;
+        Entry * mNext;
+    };
+
+    static size_t BucketFor(EndpointId aEndpointId, ClusterId aClusterId);
+
+    template <typename Function>
+    static void VisitBucket(const Entry * aEntry, Function & aFunction)
+    {
+        for (; aEntry != nullptr; aEntry = aEntry->mNext)
+        {
+            aFunction(*aEntry->mReadHandler, *aEntry->mPath);
+        }
+    }
+
+    Entry * mBuckets[kBucketCount] = {};
+    ObjectPool<Entry, kMaxEntries> mEntryPool;
+    size_t mEntryCount = 0;
+    bool mOverflowed   = false;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
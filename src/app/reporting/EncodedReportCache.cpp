@@ -0,0 +1,91 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/EncodedReportCache.h>
+
+#include <lib/core/TLVReader.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/SafeInt.h>
+
+#include <string.h>
+
+#if CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE > 0
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+static_assert(EncodedReportCache::kBufferSize <= UINT16_MAX, "Fragment offsets are 16 bits");
+
+std::optional<ByteSpan> EncodedReportCache::Find(const Key & aKey) const
+{
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        if (mEntries[i].mKey == aKey)
+        {
+            return std::make_optional(ByteSpan(&mBuffer[mEntries[i].mOffset], mEntries[i].mLength));
+        }
+    }
+    return std::nullopt;
+}
+
+ByteSpan EncodedReportCache::GetWrittenReport(const TLV::TLVWriter & aWriter) const
+{
+    TLV::TLVReader reader;
+    TLV::TLVType outerType;
+    reader.Init(&mBuffer[mUsed], aWriter.GetLengthWritten());
+    VerifyOrReturnValue(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()) == CHIP_NO_ERROR, ByteSpan());
+    VerifyOrReturnValue(reader.EnterContainer(outerType) == CHIP_NO_ERROR, ByteSpan());
+    VerifyOrReturnValue(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()) == CHIP_NO_ERROR, ByteSpan());
+
+    const uint8_t * report = reader.GetReadPoint();
+    VerifyOrReturnValue(reader.Skip() == CHIP_NO_ERROR, ByteSpan());
+    const uint8_t * reportEnd = reader.GetReadPoint();
+    VerifyOrReturnValue(reader.Next() == CHIP_END_OF_TLV, ByteSpan());
+
+    return ByteSpan(report, static_cast<size_t>(reportEnd - report));
+}
+
+void EncodedReportCache::Store(const Key & aKey, ByteSpan aReport)
+{
+    VerifyOrReturn(mEntryCount < kMaxEntries);
+    VerifyOrDie(aReport.data() >= &mBuffer[mUsed] && aReport.data() + aReport.size() <= mBuffer + kBufferSize);
+
+    // Drop the array and report control bytes in front of the report contents.
+    memmove(&mBuffer[mUsed], aReport.data(), aReport.size());
+    mEntries[mEntryCount++] = { aKey, static_cast<uint16_t>(mUsed), static_cast<uint16_t>(aReport.size()) };
+    mUsed += aReport.size();
+}
+
+void EncodedReportCache::StoreNotCacheable(const Key & aKey)
+{
+    VerifyOrReturn(mEntryCount < kMaxEntries);
+    mEntries[mEntryCount++] = { aKey, 0, 0 };
+}
+
+CHIP_ERROR EncodedReportCache::Encode(ByteSpan aFragment, TLV::TLVWriter & aWriter)
+{
+    VerifyOrReturnError(CanCastTo<uint32_t>(aFragment.size()), CHIP_ERROR_INVALID_ARGUMENT);
+    return aWriter.PutPreEncodedContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, aFragment.data(),
+                                          static_cast<uint32_t>(aFragment.size()));
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
+
+#endif // CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE > 0
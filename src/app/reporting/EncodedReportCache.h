@@ -0,0 +1,133 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+#if CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE > 0
+
+/**
+ * Encoded AttributeReportIBs shared between the read handlers of a single reporting engine run.
+ *
+ * A fragment is the encoding of a complete attribute value (a single AttributeReportIB), keyed by
+ * everything that can change its bytes for readers that are allowed to read it: the attribute path,
+ * the cluster data version, whether the read is fabric-filtered and whether the path was expanded
+ * from a wildcard. Whatever depends on the reader itself (access control, fabric-scoped data) must
+ * be checked by the caller before looking up or storing a fragment.
+ *
+ * Fragments are only valid while attribute values cannot change, i.e. within one engine run: the
+ * cache must be cleared between runs. A value may only be stored if encoding it did not look at the
+ * reader (see AttributeValueEncoder::UsedSubjectDescriptor).
+ */
+class EncodedReportCache
+{
+public:
+    static constexpr size_t kBufferSize = CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE;
+    static constexpr size_t kMaxEntries = 32;
+
+    struct Key
+    {
+        ConcreteAttributePath mPath;
+        DataVersion mDataVersion;
+        bool mFabricFiltered;
+        bool mExpanded;
+
+        bool operator==(const Key & aOther) const
+        {
+            return mPath == aOther.mPath && mDataVersion == aOther.mDataVersion && mFabricFiltered == aOther.mFabricFiltered &&
+                mExpanded == aOther.mExpanded;
+        }
+    };
+
+    void Clear()
+    {
+        mEntryCount = 0;
+        mUsed       = 0;
+    }
+
+    /**
+     * Looks up aKey. Returns:
+     *   - std::nullopt if nothing is known about aKey;
+     *   - an empty span if aKey was marked as not cacheable;
+     *   - otherwise the contents of the cached AttributeReportIB (everything after its control byte,
+     *     up to and including its end of container).
+     */
+    std::optional<ByteSpan> Find(const Key & aKey) const;
+
+    bool IsFull() const { return mEntryCount >= kMaxEntries || mUsed >= kBufferSize; }
+
+    /**
+     * Initializes aWriter over the free space of the cache, to encode an AttributeReportIBs array
+     * holding a fragment to store.
+     */
+    void PrepareWriter(TLV::TLVWriter & aWriter) { aWriter.Init(&mBuffer[mUsed], kBufferSize - mUsed); }
+
+    /**
+     * Returns the contents of the AttributeReportIB written by a writer obtained from PrepareWriter
+     * (as Find would), or an empty span if the array written does not hold exactly one report.
+     */
+    ByteSpan GetWrittenReport(const TLV::TLVWriter & aWriter) const;
+
+    /**
+     * Stores aReport, returned by GetWrittenReport, for aKey. Nothing else may be written to the cache in between.
+     */
+    void Store(const Key & aKey, ByteSpan aReport);
+
+    /**
+     * Records that aKey cannot be shared, so that later lookups do not try to encode it again.
+     */
+    void StoreNotCacheable(const Key & aKey);
+
+    /**
+     * Writes a report returned by Find or GetWrittenReport as the next element of an AttributeReportIBs array.
+     */
+    static CHIP_ERROR Encode(ByteSpan aFragment, TLV::TLVWriter & aWriter);
+
+private:
+    struct Entry
+    {
+        Key mKey;
+        uint16_t mOffset;
+        uint16_t mLength; // 0 if the value cannot be cached
+    };
+
+    uint8_t mBuffer[kBufferSize];
+    Entry mEntries[kMaxEntries];
+    size_t mEntryCount = 0;
+    size_t mUsed       = 0;
+};
+
+#endif // CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE > 0
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
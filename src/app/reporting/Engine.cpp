@@ -68,6 +68,7 @@ Status EventPathValid(DataModel::Provider * model, const ConcreteEventPath & eve
 ///   If the returned value is std::nullopt, that means the ACL check passed and the
 ///   read should proceed.
 std::optional<CHIP_ERROR> ValidateReadAttributeACL(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
+                                                   AccessDecisionCache & accessDecisionCache,
                                                    const ConcreteReadAttributePath & path)
 {
 
@@ -90,7 +91,7 @@ std::optional<CHIP_ERROR> ValidateReadAttributeACL(DataModel::Provider * dataMod
         requiredPrivilege = *info->readPrivilege;
     }
 
-    CHIP_ERROR err = GetAccessControl().Check(subjectDescriptor, requestPath, requiredPrivilege);
+    CHIP_ERROR err = GetAccessControl().Check(subjectDescriptor, requestPath, requiredPrivilege, accessDecisionCache);
     if (err == CHIP_NO_ERROR)
     {
         if (IsSupportedGlobalAttributeNotInMetadata(path.mAttributeId))
@@ -133,8 +134,10 @@ std::optional<CHIP_ERROR> ValidateReadAttributeACL(DataModel::Provider * dataMod
 }
 
 DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataModel, const SubjectDescriptor & subjectDescriptor,
-                                                  bool isFabricFiltered, AttributeReportIBs::Builder & reportBuilder,
-                                                  const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState)
+                                                  AccessDecisionCache & accessDecisionCache, bool isFabricFiltered,
+                                                  AttributeReportIBs::Builder & reportBuilder,
+                                                  const ConcreteReadAttributePath & path, AttributeEncodeState * encoderState,
+                                                  bool * usedSubjectDescriptor = nullptr)
 {
     ChipLogDetail(DataManagement, "<RE:Run> Cluster %" PRIx32 ", Attribute %" PRIx32 " is dirty", path.mClusterId,
                   path.mAttributeId);
@@ -163,7 +166,8 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
     DataModel::ActionReturnStatus status(CHIP_NO_ERROR);
     AttributeValueEncoder attributeValueEncoder(reportBuilder, subjectDescriptor, path, version, isFabricFiltered, encoderState);
 
-    if (auto access_status = ValidateReadAttributeACL(dataModel, subjectDescriptor, path); access_status.has_value())
+    if (auto access_status = ValidateReadAttributeACL(dataModel, subjectDescriptor, accessDecisionCache, path);
+        access_status.has_value())
     {
         status = *access_status;
     }
@@ -172,6 +176,11 @@ DataModel::ActionReturnStatus RetrieveClusterData(DataModel::Provider * dataMode
         status = dataModel->ReadAttribute(readRequest, attributeValueEncoder);
     }
 
+    if (usedSubjectDescriptor != nullptr)
+    {
+        *usedSubjectDescriptor = attributeValueEncoder.UsedSubjectDescriptor();
+    }
+
     if (status.IsSuccess())
     {
         // TODO: this callback being only executed on success is awkward. The Write callback is always done
@@ -265,6 +274,96 @@ static bool IsOutOfWriterSpaceError(CHIP_ERROR err)
     return err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL;
 }
 
+#if CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE > 0
+std::optional<DataModel::ActionReturnStatus> Engine::RetrieveClusterDataFromCache(ReadHandler * apReadHandler,
+                                                                                  AttributeReportIBs::Builder & aReportBuilder,
+                                                                                  const ConcreteReadAttributePath & aPath,
+                                                                                  const AttributeEncodeState & aEncodeState)
+{
+    // Only complete values are shared: resuming a chunked list goes through RetrieveClusterData.
+    VerifyOrReturnValue(mEncodedReportCacheActive, std::nullopt);
+    VerifyOrReturnValue(!aEncodeState.AllowPartialData() && aEncodeState.CurrentEncodingListIndex() == kInvalidListIndex,
+                        std::nullopt);
+
+    DataModel::Provider * dataModel            = mpImEngine->GetDataModelProvider();
+    const SubjectDescriptor & subjectDescriptor = apReadHandler->GetSubjectDescriptor();
+
+    // Access control depends on the reader, check it every time. Denied paths are reported by RetrieveClusterData.
+    VerifyOrReturnValue(!ValidateReadAttributeACL(dataModel, subjectDescriptor, mAccessDecisionCache, aPath).has_value(),
+                        std::nullopt);
+
+    std::optional<DataModel::ClusterInfo> clusterInfo = dataModel->GetClusterInfo(aPath);
+    VerifyOrReturnValue(clusterInfo.has_value(), std::nullopt);
+
+    const EncodedReportCache::Key key = { aPath, clusterInfo->dataVersion, apReadHandler->IsFabricFiltered(), aPath.mExpanded };
+
+    TLV::TLVWriter * writer = aReportBuilder.GetWriter();
+    TLV::TLVWriter checkpoint;
+    aReportBuilder.Checkpoint(checkpoint);
+
+    std::optional<ByteSpan> cached = mEncodedReportCache.Find(key);
+    if (cached.has_value())
+    {
+        VerifyOrReturnValue(!cached->empty(), std::nullopt);
+
+        if (EncodedReportCache::Encode(*cached, *writer) != CHIP_NO_ERROR)
+        {
+            // Let RetrieveClusterData chunk the value or report that it does not fit.
+            aReportBuilder.Rollback(checkpoint);
+            return std::nullopt;
+        }
+        // Same callbacks as a successful RetrieveClusterData.
+        DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
+                                                              DataModelCallbacks::OperationOrder::Pre, aPath);
+        DataModelCallbacks::GetInstance()->AttributeOperation(DataModelCallbacks::OperationType::Read,
+                                                              DataModelCallbacks::OperationOrder::Post, aPath);
+        return std::make_optional<DataModel::ActionReturnStatus>(CHIP_NO_ERROR);
+    }
+
+    VerifyOrReturnValue(!mEncodedReportCache.IsFull(), std::nullopt);
+
+    // Encode the value on its own, in the free space of the cache, then copy it into the report.
+    TLV::TLVWriter cacheWriter;
+    AttributeReportIBs::Builder cacheBuilder;
+    mEncodedReportCache.PrepareWriter(cacheWriter);
+    VerifyOrReturnValue(cacheBuilder.Init(&cacheWriter) == CHIP_NO_ERROR, std::nullopt);
+
+    bool usedSubjectDescriptor = false;
+    DataModel::ActionReturnStatus status =
+        RetrieveClusterData(dataModel, subjectDescriptor, mAccessDecisionCache, apReadHandler->IsFabricFiltered(), cacheBuilder,
+                            aPath, nullptr /* encoderState */, &usedSubjectDescriptor);
+    ByteSpan report;
+    if (status.IsSuccess() && cacheBuilder.EndOfAttributeReportIBs() == CHIP_NO_ERROR)
+    {
+        report = mEncodedReportCache.GetWrittenReport(cacheWriter);
+    }
+    if (report.empty())
+    {
+        // Failed, too large for the cache or nothing to report: not worth retrying for the next readers.
+        mEncodedReportCache.StoreNotCacheable(key);
+        return std::nullopt;
+    }
+
+    if (EncodedReportCache::Encode(report, *writer) != CHIP_NO_ERROR)
+    {
+        aReportBuilder.Rollback(checkpoint);
+        mEncodedReportCache.StoreNotCacheable(key);
+        return std::nullopt;
+    }
+
+    if (usedSubjectDescriptor)
+    {
+        // Fabric-scoped or otherwise reader-dependent value: good for this reader only.
+        mEncodedReportCache.StoreNotCacheable(key);
+    }
+    else
+    {
+        mEncodedReportCache.Store(key, report);
+    }
+    return std::make_optional(status);
+}
+#endif // CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE > 0
+
 CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Builder & aReportDataBuilder,
                                                            ReadHandler * apReadHandler, bool * apHasMoreChunks,
                                                            bool * apHasEncodedData)
@@ -278,6 +377,9 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
 
     aReportDataBuilder.Checkpoint(backup);
 
+    // Decisions are only reused within this report: endpoint composition may change in between.
+    mAccessDecisionCache.Clear();
+
     AttributeReportIBs::Builder & attributeReportIBs = aReportDataBuilder.CreateAttributeReportIBs();
     size_t emptyReportDataLength                     = 0;
 
@@ -362,9 +464,21 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             ConcreteReadAttributePath pathForRetrieval(readPath);
             // Load the saved state from previous encoding session for chunking of one single attribute (list chunking).
             AttributeEncodeState encodeState = apReadHandler->GetAttributeEncodeState();
-            DataModel::ActionReturnStatus status =
-                RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(),
-                                    apReadHandler->IsFabricFiltered(), attributeReportIBs, pathForRetrieval, &encodeState);
+            DataModel::ActionReturnStatus status(CHIP_NO_ERROR);
+#if CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE > 0
+            std::optional<DataModel::ActionReturnStatus> cachedStatus =
+                RetrieveClusterDataFromCache(apReadHandler, attributeReportIBs, pathForRetrieval, encodeState);
+            if (cachedStatus.has_value())
+            {
+                status = *cachedStatus;
+            }
+            else
+#endif
+            {
+                status = RetrieveClusterData(mpImEngine->GetDataModelProvider(), apReadHandler->GetSubjectDescriptor(),
+                                             mAccessDecisionCache, apReadHandler->IsFabricFiltered(), attributeReportIBs,
+                                             pathForRetrieval, &encodeState);
+            }
             if (status.IsError())
             {
                 // Operation error set, since this will affect early return or override on status encoding
@@ -689,8 +803,24 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     VerifyOrExit(apReadHandler->GetSession() != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     reportBufferMaxSize = apReadHandler->GetReportBufferMaxSize();
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    if (mReportBufferMaxSize != 0)
+    {
+        reportBufferMaxSize = mReportBufferMaxSize;
+    }
+#endif
 
     bufHandle = System::PacketBufferHandle::New(reportBufferMaxSize);
+    if (bufHandle.IsNull() && reportBufferMaxSize > kMaxSecureSduLengthBytes)
+    {
+        // Large payload sessions (TCP) size reports by the transport's maximum payload, but buffers that large may not be
+        // available (e.g. pool or LwIP based buffers, or a fragmented heap). Fall back to regular sized chunks rather than
+        // failing the report.
+        ChipLogDetail(DataManagement, "Large report buffer unavailable, using %u byte chunks",
+                      static_cast<unsigned>(kMaxSecureSduLengthBytes));
+        reportBufferMaxSize = kMaxSecureSduLengthBytes;
+        bufHandle           = System::PacketBufferHandle::New(reportBufferMaxSize);
+    }
     VerifyOrExit(!bufHandle.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
     if (bufHandle->AvailableDataLength() > reportBufferMaxSize)
@@ -845,6 +975,13 @@ void Engine::Run()
     // We may be deallocating read handlers as we go.  Track how many we had
     // initially, so we make sure to go through all of them.
     size_t initialAllocated = mpImEngine->mReadHandlers.Allocated();
+
+#if CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE > 0
+    // Attribute values cannot change during a run, so encoded values can be shared between the read handlers it reports.
+    mEncodedReportCache.Clear();
+    mEncodedReportCacheActive = (initialAllocated > 1);
+#endif
+
     while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < initialAllocated))
     {
         ReadHandler * readHandler =
@@ -859,6 +996,9 @@ void Engine::Run()
             mRunningReadHandler = nullptr;
             if (err != CHIP_NO_ERROR)
             {
+#if CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE > 0
+                mEncodedReportCacheActive = false;
+#endif
                 return;
             }
         }
@@ -880,6 +1020,10 @@ void Engine::Run()
         mCurReadHandlerIdx = 0;
     }
 
+#if CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE > 0
+    mEncodedReportCacheActive = false;
+#endif
+
     bool allReadClean = true;
 
     mpImEngine->mReadHandlers.ForEachActiveObject([&allReadClean](ReadHandler * handler) {
@@ -1035,11 +1179,55 @@ CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttribute
     return CHIP_NO_ERROR;
 }
 
+void Engine::AddAttributeInterest(ReadHandler & aReadHandler)
+{
+#if CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_INDEX
+    CHIP_ERROR err = mAttributeInterestIndex.Add(aReadHandler, aReadHandler.GetAttributePathList());
+    if (err != CHIP_NO_ERROR)
+    {
+        // SetDirty falls back to visiting every read handler until the index is complete again.
+        ChipLogError(DataManagement, "Failed to index attribute paths: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+#endif
+}
+
+void Engine::RemoveAttributeInterest(ReadHandler & aReadHandler)
+{
+#if CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_INDEX
+    mAttributeInterestIndex.Remove(aReadHandler);
+#endif
+}
+
 CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
 {
     BumpDirtySetGeneration();
 
     bool intersectsInterestPath = false;
+#if CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_INDEX
+    if (mAttributeInterestIndex.IsComplete())
+    {
+        const uint64_t generation = GetDirtySetGeneration();
+        mAttributeInterestIndex.ForEachCandidate(aAttributePath, [&](ReadHandler & handler, const AttributePathParams & path) {
+            // Same conditions as below. A handler with several matching paths is only marked dirty for the first one.
+            if ((handler.mDirtyGeneration == generation) || !(handler.CanStartReporting() || handler.IsAwaitingReportResponse()))
+            {
+                return;
+            }
+            if (path.Intersects(aAttributePath))
+            {
+                handler.AttributePathIsDirty(aAttributePath);
+                intersectsInterestPath = true;
+            }
+        });
+
+        if (!intersectsInterestPath)
+        {
+            return CHIP_NO_ERROR;
+        }
+        return InsertPathIntoDirtySet(aAttributePath);
+    }
+#endif
+
     mpImEngine->mReadHandlers.ForEachActiveObject([&aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
         // We call AttributePathIsDirty for both read interactions and subscribe interactions, since we may send inconsistent
         // attribute data between two chunks. AttributePathIsDirty will not schedule a new run for read handlers which are
@@ -27,7 +27,10 @@
 #include <access/AccessControl.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
+#include <app/data-model-provider/ActionReturnStatus.h>
 #include <app/data-model-provider/ProviderChangeListener.h>
+#include <app/reporting/AttributeInterestIndex.h>
+#include <app/reporting/EncodedReportCache.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
@@ -77,6 +80,10 @@ public:
     void SetWriterReserved(uint32_t aReservedSize) { mReservedSize = aReservedSize; }
 
     void SetMaxAttributesPerChunk(uint32_t aMaxAttributesPerChunk) { mMaxAttributesPerChunk = aMaxAttributesPerChunk; }
+
+    // Report buffer size to request instead of ReadHandler::GetReportBufferMaxSize(), e.g. to exercise large payload
+    // reports over the loopback transport, which cannot carry large payload (TCP) sessions. 0 means no override.
+    void SetReportBufferMaxSize(size_t aReportBufferMaxSize) { mReportBufferMaxSize = aReportBufferMaxSize; }
 #endif
 
     /**
@@ -96,6 +103,14 @@ public:
      */
     CHIP_ERROR SetDirty(const AttributePathParams & aAttributePathParams);
 
+    /**
+     * Records the attribute paths of a read handler, so that SetDirty only has to visit the read handlers interested
+     * in a change. Must be called whenever the handler's attribute path list has been (re)built, and
+     * RemoveAttributeInterest must be called before that list is released.
+     */
+    void AddAttributeInterest(ReadHandler & aReadHandler);
+    void RemoveAttributeInterest(ReadHandler & aReadHandler);
+
     /**
      * @brief
      *  Schedule the event delivery
@@ -174,6 +189,15 @@ private:
                                                  bool aBufferIsUsed, bool * apHasMoreChunks, bool * apHasEncodedData);
     CHIP_ERROR CheckAccessDeniedEventPaths(TLV::TLVWriter & aWriter, bool & aHasEncodedData, ReadHandler * apReadHandler);
 
+#if CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE > 0
+    // Encodes aPath for apReadHandler through mEncodedReportCache. Returns std::nullopt if nothing was
+    // encoded and the attribute must be read as usual.
+    std::optional<DataModel::ActionReturnStatus> RetrieveClusterDataFromCache(ReadHandler * apReadHandler,
+                                                                              AttributeReportIBs::Builder & aReportBuilder,
+                                                                              const ConcreteReadAttributePath & aPath,
+                                                                              const AttributeEncodeState & aEncodeState);
+#endif
+
     // If version match, it means don't send, if version mismatch, it means send.
     // If client sends the same path with multiple data versions, client will get the data back per the spec, because at least one
     // of those will fail to match.  This function should return false if either nothing in the list matches the given
@@ -281,9 +305,32 @@ private:
      */
     uint64_t mDirtyGeneration = 1;
 
+#if CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_INDEX
+    /**
+     * Attribute paths of the read handlers, indexed by the endpoint and cluster they cover.
+     */
+    AttributeInterestIndex mAttributeInterestIndex;
+#endif
+
+#if CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE > 0
+    /**
+     * Attribute values encoded during the current Run(), shared between the read handlers it reports.
+     * Only used while mEncodedReportCacheActive is set.
+     */
+    EncodedReportCache mEncodedReportCache;
+    bool mEncodedReportCacheActive = false;
+#endif
+
+    /**
+     * Access decisions for the read handler whose attribute reports are being built, so that
+     * expanded paths of one cluster instance only check access control once.
+     */
+    Access::AccessDecisionCache mAccessDecisionCache;
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     uint32_t mReservedSize          = 0;
     uint32_t mMaxAttributesPerChunk = UINT32_MAX;
+    size_t mReportBufferMaxSize     = 0;
 #endif
 
     InteractionModelEngine * mpImEngine = nullptr;
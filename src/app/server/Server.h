@@ -24,6 +24,7 @@
 #include <access/examples/ExampleAccessControlDelegate.h>
 #include <app/CASEClientPool.h>
 #include <app/CASESessionManager.h>
+#include <app/CoalescingPersistentStorageDelegate.h>
 #include <app/FailSafeContext.h>
 #include <app/OperationalSessionSetupPool.h>
 #include <app/SimpleSubscriptionResumptionStorage.h>
@@ -251,7 +252,14 @@ struct CommonCaseDeviceServerInitParams : public ServerInitParams
             chip::DeviceLayer::PersistedStorage::KeyValueStoreManager & kvsManager =
                 DeviceLayer::PersistedStorage::KeyValueStoreMgr();
             ReturnErrorOnFailure(sKvsPersistenStorageDelegate.Init(&kvsManager));
+#if CHIP_CONFIG_SERVER_COALESCING_STORAGE
+            // Detach from a previous server run, if any, before attaching again.
+            sCoalescingStorageDelegate.Shutdown();
+            ReturnErrorOnFailure(sCoalescingStorageDelegate.Init(&sKvsPersistenStorageDelegate, &DeviceLayer::SystemLayer()));
+            this->persistentStorageDelegate = &sCoalescingStorageDelegate;
+#else
             this->persistentStorageDelegate = &sKvsPersistenStorageDelegate;
+#endif
         }
 
         // PersistentStorageDelegate "software-based" operational key access injection
@@ -260,6 +268,12 @@ struct CommonCaseDeviceServerInitParams : public ServerInitParams
             // WARNING: PersistentStorageOperationalKeystore::Finish() is never called. It's fine for
             //          for examples and for now.
             ReturnErrorOnFailure(sPersistentStorageOperationalKeystore.Init(this->persistentStorageDelegate));
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && !CHIP_CONFIG_SERVER_COALESCING_STORAGE
+            // The platform KVS may be read from the background tasks signing CASE Sigma2; the
+            // coalescing storage delegate and injected delegates may not.
+            sPersistentStorageOperationalKeystore.SetSupportsSignWithOpKeypairInBackground(this->persistentStorageDelegate ==
+                                                                                           &sKvsPersistenStorageDelegate);
+#endif
             this->operationalKeystore = &sPersistentStorageOperationalKeystore;
         }
 
@@ -323,6 +337,9 @@ struct CommonCaseDeviceServerInitParams : public ServerInitParams
 
 private:
     static KvsPersistentStorageDelegate sKvsPersistenStorageDelegate;
+#if CHIP_CONFIG_SERVER_COALESCING_STORAGE
+    static app::CoalescingPersistentStorageDelegate sCoalescingStorageDelegate;
+#endif
     static PersistentStorageOperationalKeystore sPersistentStorageOperationalKeystore;
     static Credentials::PersistentStorageOpCertStore sPersistentStorageOpCertStore;
     static Credentials::GroupDataProviderImpl sGroupDataProvider;
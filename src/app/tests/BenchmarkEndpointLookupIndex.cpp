@@ -0,0 +1,70 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/tests/EndpointLookupIndexTestData.h>
+#include <app/util/endpoint-lookup-index.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Testing;
+
+namespace {
+
+class BenchmarkEndpointLookupIndex : public ::testing::Test
+{
+protected:
+    EndpointLookupIndex<kMaxEndpoints> mIndex;
+};
+
+TEST_F(BenchmarkEndpointLookupIndex, AttributeLookup)
+{
+    constexpr uint16_t kEndpointCounts[] = { 10, 50, kMaxEndpoints };
+    constexpr int kLookups               = 100000;
+
+    for (uint16_t count : kEndpointCounts)
+    {
+        ConfigureEndpoints(count);
+        mIndex.Rebuild(gEndpoints, count, count);
+
+        // Look up the last attribute of the last cluster, on endpoints spread over the whole table.
+        uint32_t checksum[2] = {};
+        auto start           = System::SystemClock().GetMonotonicMicroseconds64();
+        for (int i = 0; i < kLookups; i++)
+        {
+            EndpointId endpoint = gEndpoints[static_cast<uint16_t>(i % count)].endpoint;
+            checksum[0] += LinearAttributeOffset(count, count, endpoint, 0x0300, 0xFFFD);
+        }
+        auto mid = System::SystemClock().GetMonotonicMicroseconds64();
+        for (int i = 0; i < kLookups; i++)
+        {
+            EndpointId endpoint = gEndpoints[static_cast<uint16_t>(i % count)].endpoint;
+            checksum[1] += IndexedAttributeOffset(mIndex, endpoint, 0x0300, 0xFFFD);
+        }
+        auto end = System::SystemClock().GetMonotonicMicroseconds64();
+        EXPECT_EQ(checksum[0], checksum[1]);
+
+        ChipLogProgress(Test, "%u endpoints: linear lookup %u ns, indexed lookup %u ns", static_cast<unsigned>(count),
+                        static_cast<unsigned>((mid - start).count() * 1000 / kLookups),
+                        static_cast<unsigned>((end - mid).count() * 1000 / kLookups));
+    }
+}
+
+} // namespace
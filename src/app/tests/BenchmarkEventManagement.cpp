@@ -0,0 +1,180 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Timing benchmark of EventManagement::FetchEventsSince for up-to-date
+ *      subscribers, with full event buffers of several sizes.
+ */
+
+#include <app/EventLoggingDelegate.h>
+#include <app/EventLoggingTypes.h>
+#include <app/EventManagement.h>
+#include <app/MessageDef/EventDataIB.h>
+#include <app/tests/AppTestContext.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CHIPCounter.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/LinkedList.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include <inttypes.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+constexpr uint32_t kBufferSizes[]     = { 1024, 4096, 16384 };
+constexpr size_t kSubscriberCounts[]  = { 1, 8, 32 };
+constexpr size_t kMaxSubscribers      = 32;
+constexpr chip::ClusterId kClusters[] = { 0x0006, 0x0008, 0x0028, 0x002F, 0x0033, 0x0045, 0x0101, 0x0300 };
+constexpr int kRounds                 = 100;
+
+class BenchmarkEventManagement : public chip::Test::AppContext
+{
+public:
+    void TearDown() override
+    {
+        chip::app::EventManagement::DestroyEventManagement();
+        AppContext::TearDown();
+    }
+};
+
+class TestEventGenerator : public chip::app::EventLoggingDelegate
+{
+public:
+    CHIP_ERROR WriteEvent(chip::TLV::TLVWriter & aWriter)
+    {
+        chip::TLV::TLVType dataContainerType;
+        ReturnErrorOnFailure(aWriter.StartContainer(chip::TLV::ContextTag(chip::to_underlying(chip::app::EventDataIB::Tag::kData)),
+                                                    chip::TLV::kTLVType_Structure, dataContainerType));
+        ReturnErrorOnFailure(aWriter.Put(chip::TLV::ContextTag(1), static_cast<uint32_t>(1)));
+        ReturnErrorOnFailure(aWriter.Put(chip::TLV::ContextTag(2), static_cast<uint32_t>(2)));
+        return aWriter.EndContainer(dataContainerType);
+    }
+};
+
+chip::app::PriorityLevel PriorityForEvent(int i)
+{
+    switch (i % 3)
+    {
+    case 0:
+        return chip::app::PriorityLevel::Debug;
+    case 1:
+        return chip::app::PriorityLevel::Info;
+    default:
+        return chip::app::PriorityLevel::Critical;
+    }
+}
+
+TEST_F(BenchmarkEventManagement, FetchEventsSince)
+{
+    TestEventGenerator testEventGenerator;
+    chip::app::EventOptions options;
+    chip::EventNumber eid = 0;
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> paths[kMaxSubscribers];
+    for (size_t i = 0; i < kMaxSubscribers; i++)
+    {
+        paths[i].mValue.mEndpointId = 1;
+        paths[i].mValue.mClusterId  = kClusters[i % ArraySize(kClusters)];
+    }
+
+    uint8_t reportBuffer[1024];
+    chip::Platform::ScopedMemoryBuffer<uint8_t> storage;
+
+    for (uint32_t bufferSize : kBufferSizes)
+    {
+        ASSERT_TRUE(storage.Alloc(3 * bufferSize));
+        chip::app::CircularEventBuffer circularEventBuffers[3];
+        const chip::app::LogStorageResources logStorageResources[] = {
+            { storage.Get(), bufferSize, chip::app::PriorityLevel::Debug },
+            { storage.Get() + bufferSize, bufferSize, chip::app::PriorityLevel::Info },
+            { storage.Get() + 2 * bufferSize, bufferSize, chip::app::PriorityLevel::Critical },
+        };
+        chip::MonotonicallyIncreasingCounter<chip::EventNumber> eventCounter;
+        ASSERT_EQ(eventCounter.Init(0), CHIP_NO_ERROR);
+        chip::app::EventManagement::CreateEventManagement(&GetExchangeManager(), ArraySize(logStorageResources),
+                                                          circularEventBuffers, logStorageResources, &eventCounter);
+        chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+
+        // Fill all the buffers, so that reads have the whole log to go through.
+        for (uint32_t i = 0; i < bufferSize / 4; i++)
+        {
+            options.mPath     = { 1, kClusters[i % ArraySize(kClusters)], 1 };
+            options.mPriority = PriorityForEvent(static_cast<int>(i));
+            ASSERT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid), CHIP_NO_ERROR);
+        }
+
+        for (size_t subscriberCount : kSubscriberCounts)
+        {
+            // Subscribers are up to date, and get each new event as it is logged.
+            chip::EventNumber eventMins[kMaxSubscribers];
+            for (auto & eventMin : eventMins)
+            {
+                eventMin = eid + 1;
+            }
+
+            size_t totalEventCount = 0;
+            chip::System::Clock::Microseconds64 elapsed(0);
+            for (int round = 0; round < kRounds; round++)
+            {
+                options.mPath     = { 1, kClusters[static_cast<size_t>(round) % ArraySize(kClusters)], 1 };
+                options.mPriority = PriorityForEvent(round);
+                ASSERT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid), CHIP_NO_ERROR);
+
+                chip::System::Clock::Microseconds64 start = chip::System::SystemClock().GetMonotonicMicroseconds64();
+                for (size_t i = 0; i < subscriberCount; i++)
+                {
+                    chip::TLV::TLVWriter writer;
+                    writer.Init(reportBuffer, sizeof(reportBuffer));
+                    ASSERT_EQ(logMgmt.FetchEventsSince(writer, &paths[i], eventMins[i], totalEventCount,
+                                                       chip::Access::SubjectDescriptor{}),
+                              CHIP_NO_ERROR);
+                }
+                elapsed += chip::System::SystemClock().GetMonotonicMicroseconds64() - start;
+            }
+
+            // Each event is for one cluster out of eight, and subscribers are spread evenly over them.
+            size_t expectedEventCount = 0;
+            for (int round = 0; round < kRounds; round++)
+            {
+                for (size_t i = 0; i < subscriberCount; i++)
+                {
+                    if (static_cast<size_t>(round) % ArraySize(kClusters) == i % ArraySize(kClusters))
+                    {
+                        expectedEventCount++;
+                    }
+                }
+            }
+            EXPECT_EQ(totalEventCount, expectedEventCount);
+
+            ChipLogProgress(EventLogging, "FetchEventsSince: %" PRIu32 " byte buffers, %u subscribers: %" PRIu64 " ns per fetch",
+                            bufferSize, static_cast<unsigned>(subscriberCount),
+                            elapsed.count() * 1000 / (static_cast<uint64_t>(kRounds) * subscriberCount));
+        }
+
+        chip::app::EventManagement::DestroyEventManagement();
+    }
+}
+
+} // namespace
@@ -0,0 +1,131 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Endpoint tables shared by the EndpointLookupIndex unit tests and benchmark, along with the attribute lookup as
+ *      attribute-storage did it before the index, for comparison.
+ */
+
+#pragma once
+
+#include <app/util/endpoint-lookup-index.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+namespace Testing {
+
+constexpr uint16_t kMaxEndpoints = 254;
+constexpr uint16_t kNotFound     = EndpointLookupIndex<kMaxEndpoints>::kInvalidIndex;
+
+// A representative endpoint: a few server clusters with a handful of internally stored attributes each.
+constexpr EmberAfAttributeMetadata kAttributes[] = {
+    { uint32_t(0), 0x0000, 2, 0, 0 }, { uint32_t(0), 0x0001, 4, 0, 0 }, { uint32_t(0), 0x0002, 1, 0, 0 },
+    { uint32_t(0), 0x0003, 8, 0, 0 }, { uint32_t(0), 0xFFFD, 2, 0, 0 },
+};
+constexpr uint16_t kClusterSize = 2 + 4 + 1 + 8 + 2;
+
+constexpr EmberAfCluster MakeCluster(ClusterId id)
+{
+    return { id, kAttributes, ArraySize(kAttributes), kClusterSize, CLUSTER_MASK_SERVER, nullptr, nullptr, nullptr, nullptr, 0 };
+}
+
+constexpr EmberAfCluster kClusters[] = { MakeCluster(0x0003), MakeCluster(0x0004), MakeCluster(0x0006),
+                                         MakeCluster(0x0008), MakeCluster(0x001D), MakeCluster(0x0300) };
+constexpr EmberAfEndpointType kEndpointType = { kClusters, ArraySize(kClusters),
+                                                static_cast<uint16_t>(kClusterSize * ArraySize(kClusters)) };
+
+inline EmberAfDefinedEndpoint gEndpoints[kMaxEndpoints];
+
+inline void ConfigureEndpoints(uint16_t count)
+{
+    for (uint16_t i = 0; i < kMaxEndpoints; i++)
+    {
+        gEndpoints[i] = EmberAfDefinedEndpoint();
+        if (i < count)
+        {
+            // Endpoint ids are deliberately not in table order.
+            gEndpoints[i].endpoint     = static_cast<EndpointId>((i * 7) % kMaxEndpoints);
+            gEndpoints[i].endpointType = &kEndpointType;
+            gEndpoints[i].bitmask.Set(EmberAfEndpointOptions::isEnabled);
+        }
+    }
+}
+
+inline bool IsEnabled(uint16_t index)
+{
+    return gEndpoints[index].bitmask.Has(EmberAfEndpointOptions::isEnabled);
+}
+
+// Offset of the attribute within the cluster's storage, or kNotFound.
+inline uint16_t AttributeOffsetInEndpoint(const EmberAfEndpointType * type, ClusterId clusterId, AttributeId attributeId)
+{
+    uint16_t offset = 0;
+    for (uint8_t c = 0; c < type->clusterCount; c++)
+    {
+        const EmberAfCluster & cluster = type->cluster[c];
+        if (cluster.clusterId != clusterId)
+        {
+            offset = static_cast<uint16_t>(offset + cluster.clusterSize);
+            continue;
+        }
+        for (uint16_t a = 0; a < cluster.attributeCount; a++)
+        {
+            if (cluster.attributes[a].attributeId == attributeId)
+            {
+                return offset;
+            }
+            offset = static_cast<uint16_t>(offset + cluster.attributes[a].size);
+        }
+        return kNotFound;
+    }
+    return kNotFound;
+}
+
+// The attribute-storage lookup as it was before the index: scan all endpoints, summing their sizes.
+inline uint16_t LinearAttributeOffset(uint16_t endpointCount, uint16_t fixedCount, EndpointId endpoint, ClusterId clusterId,
+                                      AttributeId attributeId)
+{
+    uint16_t offset = 0;
+    for (uint16_t ep = 0; ep < endpointCount; ep++)
+    {
+        if (gEndpoints[ep].endpoint == endpoint && IsEnabled(ep))
+        {
+            uint16_t inEndpoint = AttributeOffsetInEndpoint(gEndpoints[ep].endpointType, clusterId, attributeId);
+            return (inEndpoint == kNotFound) ? kNotFound : static_cast<uint16_t>(offset + inEndpoint);
+        }
+        if (ep < fixedCount)
+        {
+            offset = static_cast<uint16_t>(offset + gEndpoints[ep].endpointType->endpointSize);
+        }
+    }
+    return kNotFound;
+}
+
+inline uint16_t IndexedAttributeOffset(const EndpointLookupIndex<kMaxEndpoints> & index, EndpointId endpoint,
+                                       ClusterId clusterId, AttributeId attributeId)
+{
+    uint16_t ep = index.Find(endpoint, IsEnabled);
+    VerifyOrReturnValue(ep != kNotFound, kNotFound);
+    uint16_t inEndpoint = AttributeOffsetInEndpoint(gEndpoints[ep].endpointType, clusterId, attributeId);
+    return (inEndpoint == kNotFound) ? kNotFound : static_cast<uint16_t>(index.GetAttributeDataOffset(ep) + inEndpoint);
+}
+
+} // namespace Testing
+} // namespace app
+} // namespace chip
@@ -150,6 +150,7 @@ TEST(TestAttributeValueEncoder, TestEncodeBool)
         // clang-format on
     };
     VERIFY_BUFFER_STATE(test, expected);
+    EXPECT_FALSE(test.encoder.UsedSubjectDescriptor());
 }
 
 TEST(TestAttributeValueEncoder, TestEncodeListOfBools1)
@@ -288,6 +289,8 @@ TEST(TestAttributeValueEncoder, TestEncodeFabricScoped)
         // clang-format on
     };
     VERIFY_BUFFER_STATE(test, expected);
+    // The encoded list depends on the accessing fabric.
+    EXPECT_TRUE(test.encoder.UsedSubjectDescriptor());
 }
 
 TEST(TestAttributeValueEncoder, TestEncodeListChunking)
@@ -0,0 +1,267 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/CoalescingPersistentStorageDelegate.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/PersistedCounter.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+// Counts the mutations that reach the backing storage.
+class CountingStorage : public TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncSetKeyValueInternal(const char * key, const void * value, uint16_t size) override
+    {
+        mMutations++;
+        return TestPersistentStorageDelegate::SyncSetKeyValueInternal(key, value, size);
+    }
+
+    CHIP_ERROR SyncDeleteKeyValueInternal(const char * key) override
+    {
+        mMutations++;
+        return TestPersistentStorageDelegate::SyncDeleteKeyValueInternal(key);
+    }
+
+    unsigned mMutations = 0;
+};
+
+// System::Layer whose single pending timer is fired explicitly by the test.
+class ManualTimerLayer : public System::Layer
+{
+public:
+    CHIP_ERROR Init() override { return CHIP_NO_ERROR; }
+    void Shutdown() override {}
+    bool IsInitialized() const override { return true; }
+
+    CHIP_ERROR StartTimer(System::Clock::Timeout delay, System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        mDelay    = delay;
+        mCallback = onComplete;
+        mAppState = appState;
+        mStartCount++;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR ExtendTimerTo(System::Clock::Timeout delay, System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return StartTimer(delay, onComplete, appState);
+    }
+    bool IsTimerActive(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return mCallback == onComplete && mAppState == appState;
+    }
+    System::Clock::Timeout GetRemainingTime(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return IsTimerActive(onComplete, appState) ? mDelay : System::Clock::kZero;
+    }
+    void CancelTimer(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        if (IsTimerActive(onComplete, appState))
+        {
+            mCallback = nullptr;
+            mAppState = nullptr;
+        }
+    }
+    CHIP_ERROR ScheduleWork(System::TimerCompleteCallback onComplete, void * appState) override
+    {
+        return StartTimer(System::Clock::kZero, onComplete, appState);
+    }
+
+    bool HasPendingTimer() const { return mCallback != nullptr; }
+
+    void FireTimer()
+    {
+        ASSERT_NE(mCallback, nullptr);
+        auto callback = mCallback;
+        auto appState = mAppState;
+        mCallback     = nullptr;
+        mAppState     = nullptr;
+        callback(this, appState);
+    }
+
+    System::Clock::Timeout mDelay = System::Clock::kZero;
+    unsigned mStartCount          = 0;
+
+private:
+    System::TimerCompleteCallback mCallback = nullptr;
+    void * mAppState                        = nullptr;
+};
+
+class TestCoalescingPersistentStorageDelegate : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override { ASSERT_EQ(mStorage.Init(&mBacking, &mLayer), CHIP_NO_ERROR); }
+    void TearDown() override { mStorage.Shutdown(); }
+
+    CountingStorage mBacking;
+    ManualTimerLayer mLayer;
+    CoalescingPersistentStorageDelegate mStorage;
+};
+
+TEST_F(TestCoalescingPersistentStorageDelegate, WritesAreCoalescedUntilTheLoopRuns)
+{
+    const uint8_t first[]  = { 1, 2, 3 };
+    const uint8_t second[] = { 4, 5 };
+
+    EXPECT_EQ(mStorage.SyncSetKeyValue("a", first, sizeof(first)), CHIP_NO_ERROR);
+    EXPECT_EQ(mStorage.SyncSetKeyValue("b", first, sizeof(first)), CHIP_NO_ERROR);
+    EXPECT_EQ(mStorage.SyncSetKeyValue("a", second, sizeof(second)), CHIP_NO_ERROR);
+    EXPECT_EQ(mBacking.mMutations, 0u);
+    EXPECT_EQ(mStorage.GetPendingWriteCount(), 2u);
+    EXPECT_EQ(mLayer.mStartCount, 1u);
+
+    // Reads see the buffered values, with the usual partial-read semantics.
+    uint8_t buf[8];
+    uint16_t size = sizeof(buf);
+    EXPECT_EQ(mStorage.SyncGetKeyValue("a", buf, size), CHIP_NO_ERROR);
+    EXPECT_EQ(size, sizeof(second));
+    EXPECT_EQ(memcmp(buf, second, sizeof(second)), 0);
+    size = 1;
+    EXPECT_EQ(mStorage.SyncGetKeyValue("b", buf, size), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(size, 1u);
+    EXPECT_TRUE(mStorage.SyncDoesKeyExist("b"));
+    EXPECT_FALSE(mBacking.SyncDoesKeyExist("a"));
+
+    mLayer.FireTimer();
+    EXPECT_EQ(mBacking.mMutations, 2u);
+    EXPECT_EQ(mStorage.GetPendingWriteCount(), 0u);
+    EXPECT_EQ(mStorage.GetStats().mFlushes, 1u);
+    EXPECT_EQ(mStorage.GetStats().mCoalesced, 1u);
+
+    size = sizeof(buf);
+    EXPECT_EQ(mBacking.SyncGetKeyValue("a", buf, size), CHIP_NO_ERROR);
+    EXPECT_EQ(size, sizeof(second));
+}
+
+TEST_F(TestCoalescingPersistentStorageDelegate, DeleteSemantics)
+{
+    const uint8_t value[] = { 1 };
+    EXPECT_EQ(mBacking.SyncSetKeyValue("stored", value, sizeof(value)), CHIP_NO_ERROR);
+    mBacking.mMutations = 0;
+
+    EXPECT_EQ(mStorage.SyncDeleteKeyValue("missing"), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_EQ(mStorage.SyncDeleteKeyValue("stored"), CHIP_NO_ERROR);
+    EXPECT_EQ(mStorage.SyncDeleteKeyValue("stored"), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_FALSE(mStorage.SyncDoesKeyExist("stored"));
+
+    uint8_t buf[4];
+    uint16_t size = sizeof(buf);
+    EXPECT_EQ(mStorage.SyncGetKeyValue("stored", buf, size), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    // A key created and deleted within one batch never needs to reach the backing storage as a value.
+    EXPECT_EQ(mStorage.SyncSetKeyValue("transient", value, sizeof(value)), CHIP_NO_ERROR);
+    EXPECT_EQ(mStorage.SyncDeleteKeyValue("transient"), CHIP_NO_ERROR);
+
+    EXPECT_EQ(mStorage.SyncFlush(), CHIP_NO_ERROR);
+    EXPECT_FALSE(mBacking.SyncDoesKeyExist("stored"));
+    EXPECT_FALSE(mBacking.SyncDoesKeyExist("transient"));
+    EXPECT_EQ(mBacking.GetNumKeys(), 0u);
+}
+
+TEST_F(TestCoalescingPersistentStorageDelegate, BarrierFlushesImmediately)
+{
+    const uint8_t value[] = { 7 };
+    EXPECT_EQ(mStorage.SyncSetKeyValue("a", value, sizeof(value)), CHIP_NO_ERROR);
+    EXPECT_TRUE(mLayer.HasPendingTimer());
+
+    EXPECT_EQ(mStorage.SyncFlush(), CHIP_NO_ERROR);
+    EXPECT_EQ(mBacking.mMutations, 1u);
+    EXPECT_FALSE(mLayer.HasPendingTimer());
+
+    // Nothing pending: another barrier does not touch the backing storage.
+    EXPECT_EQ(mStorage.SyncFlush(), CHIP_NO_ERROR);
+    EXPECT_EQ(mBacking.mMutations, 1u);
+    EXPECT_EQ(mStorage.GetStats().mFlushes, 1u);
+}
+
+TEST_F(TestCoalescingPersistentStorageDelegate, OverflowFlushesInOrder)
+{
+    char key[PersistentStorageDelegate::kKeyLengthMax + 1];
+    const uint8_t value[] = { 1 };
+    for (size_t i = 0; i < CoalescingPersistentStorageDelegate::kMaxPendingWrites; i++)
+    {
+        snprintf(key, sizeof(key), "k%u", static_cast<unsigned>(i));
+        EXPECT_EQ(mStorage.SyncSetKeyValue(key, value, sizeof(value)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(mBacking.mMutations, 0u);
+
+    EXPECT_EQ(mStorage.SyncSetKeyValue("one-more", value, sizeof(value)), CHIP_NO_ERROR);
+    EXPECT_EQ(mBacking.mMutations, CoalescingPersistentStorageDelegate::kMaxPendingWrites);
+    EXPECT_EQ(mStorage.GetPendingWriteCount(), 1u);
+    EXPECT_FALSE(mBacking.SyncDoesKeyExist("one-more"));
+
+    // Keys too long to buffer are written through after the pending writes.
+    char longKey[PersistentStorageDelegate::kKeyLengthMax + 2];
+    memset(longKey, 'x', sizeof(longKey) - 1);
+    longKey[sizeof(longKey) - 1] = '\0';
+    EXPECT_EQ(mStorage.SyncSetKeyValue(longKey, value, sizeof(value)), CHIP_NO_ERROR);
+    EXPECT_TRUE(mBacking.SyncDoesKeyExist("one-more"));
+    EXPECT_TRUE(mBacking.SyncDoesKeyExist(longKey));
+    EXPECT_EQ(mStorage.GetPendingWriteCount(), 0u);
+}
+
+TEST_F(TestCoalescingPersistentStorageDelegate, FailedFlushKeepsPendingWrites)
+{
+    const uint8_t value[] = { 1 };
+    EXPECT_EQ(mStorage.SyncSetKeyValue("a", value, sizeof(value)), CHIP_NO_ERROR);
+    EXPECT_EQ(mStorage.SyncSetKeyValue("b", value, sizeof(value)), CHIP_NO_ERROR);
+
+    mBacking.SetRejectWrites(true);
+    EXPECT_EQ(mStorage.SyncFlush(), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    EXPECT_EQ(mStorage.GetPendingWriteCount(), 2u);
+    EXPECT_TRUE(mStorage.SyncDoesKeyExist("a"));
+
+    mBacking.SetRejectWrites(false);
+    EXPECT_EQ(mStorage.SyncFlush(), CHIP_NO_ERROR);
+    EXPECT_EQ(mStorage.GetPendingWriteCount(), 0u);
+    EXPECT_TRUE(mBacking.SyncDoesKeyExist("a"));
+    EXPECT_TRUE(mBacking.SyncDoesKeyExist("b"));
+}
+
+TEST_F(TestCoalescingPersistentStorageDelegate, PersistedCounterEpochIsDurable)
+{
+    PersistedCounter<uint32_t> counter;
+    const StorageKeyName key = DefaultStorageKeyAllocator::GroupDataCounter();
+    ASSERT_EQ(counter.Init(&mStorage, key, 4), CHIP_NO_ERROR);
+
+    // Every epoch written by the counter is flushed before the counter hands out values from it.
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(counter.Advance(), CHIP_NO_ERROR);
+        EXPECT_EQ(mStorage.GetPendingWriteCount(), 0u);
+    }
+
+    uint32_t storedEpoch = 0;
+    uint16_t size        = sizeof(storedEpoch);
+    EXPECT_EQ(mBacking.SyncGetKeyValue(key.KeyName(), &storedEpoch, size), CHIP_NO_ERROR);
+    EXPECT_GT(storedEpoch, counter.GetValue());
+}
+
+} // namespace
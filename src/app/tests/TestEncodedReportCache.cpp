@@ -0,0 +1,165 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <app/AttributeValueEncoder.h>
+#include <app/MessageDef/AttributeReportIBs.h>
+#include <app/reporting/EncodedReportCache.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CodeUtils.h>
+
+#include <initializer_list>
+#include <string.h>
+
+#if CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE > 0
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+namespace {
+
+constexpr DataVersion kDataVersion = 0x1234;
+
+// Writes an AttributeReportIBs array holding a report of aPath for each of aValues.
+CHIP_ERROR EncodeReports(TLV::TLVWriter & aWriter, const ConcreteAttributePath & aPath, std::initializer_list<uint32_t> aValues)
+{
+    AttributeReportIBs::Builder builder;
+    ReturnErrorOnFailure(builder.Init(&aWriter));
+    for (uint32_t value : aValues)
+    {
+        AttributeValueEncoder encoder(builder, Access::SubjectDescriptor(), aPath, kDataVersion);
+        ReturnErrorOnFailure(encoder.Encode(value));
+    }
+    return builder.EndOfAttributeReportIBs();
+}
+
+class TestEncodedReportCache : public ::testing::Test
+{
+public:
+    // Encodes aValue through the cache and stores it for aKey.
+    ByteSpan Fill(const EncodedReportCache::Key & aKey, uint32_t aValue)
+    {
+        TLV::TLVWriter writer;
+        mCache.PrepareWriter(writer);
+        EXPECT_EQ(EncodeReports(writer, aKey.mPath, { aValue }), CHIP_NO_ERROR);
+        ByteSpan report = mCache.GetWrittenReport(writer);
+        EXPECT_FALSE(report.empty());
+        mCache.Store(aKey, report);
+        return mCache.Find(aKey).value_or(ByteSpan());
+    }
+
+    EncodedReportCache mCache;
+};
+
+TEST_F(TestEncodedReportCache, TestCopiedReportMatchesDirectEncoding)
+{
+    const ConcreteAttributePath path(1, 6, 0);
+    const EncodedReportCache::Key key = { path, kDataVersion, true, false };
+
+    EXPECT_FALSE(mCache.Find(key).has_value());
+    ByteSpan fragment = Fill(key, 42);
+    EXPECT_FALSE(fragment.empty());
+
+    uint8_t direct[128];
+    TLV::TLVWriter directWriter;
+    directWriter.Init(direct);
+    ASSERT_EQ(EncodeReports(directWriter, path, { 42 }), CHIP_NO_ERROR);
+
+    uint8_t copied[128];
+    TLV::TLVWriter copiedWriter;
+    AttributeReportIBs::Builder builder;
+    copiedWriter.Init(copied);
+    ASSERT_EQ(builder.Init(&copiedWriter), CHIP_NO_ERROR);
+    ASSERT_EQ(EncodedReportCache::Encode(fragment, *builder.GetWriter()), CHIP_NO_ERROR);
+    ASSERT_EQ(builder.EndOfAttributeReportIBs(), CHIP_NO_ERROR);
+
+    ASSERT_EQ(copiedWriter.GetLengthWritten(), directWriter.GetLengthWritten());
+    EXPECT_EQ(memcmp(copied, direct, directWriter.GetLengthWritten()), 0);
+}
+
+TEST_F(TestEncodedReportCache, TestKeys)
+{
+    const ConcreteAttributePath path(1, 6, 0);
+    const EncodedReportCache::Key key = { path, kDataVersion, true, false };
+    Fill(key, 1);
+
+    // Anything that can change the encoded bytes is a different entry.
+    EXPECT_TRUE(mCache.Find(key).has_value());
+    EXPECT_FALSE(mCache.Find({ ConcreteAttributePath(2, 6, 0), kDataVersion, true, false }).has_value());
+    EXPECT_FALSE(mCache.Find({ ConcreteAttributePath(1, 8, 0), kDataVersion, true, false }).has_value());
+    EXPECT_FALSE(mCache.Find({ ConcreteAttributePath(1, 6, 1), kDataVersion, true, false }).has_value());
+    EXPECT_FALSE(mCache.Find({ path, kDataVersion + 1, true, false }).has_value());
+    EXPECT_FALSE(mCache.Find({ path, kDataVersion, false, false }).has_value());
+    EXPECT_FALSE(mCache.Find({ path, kDataVersion, true, true }).has_value());
+
+    // Fragments stay valid as others are added.
+    const EncodedReportCache::Key otherKey = { ConcreteAttributePath(1, 6, 1), kDataVersion, true, false };
+    ByteSpan other                         = Fill(otherKey, 2);
+    ByteSpan first                         = mCache.Find(key).value_or(ByteSpan());
+    EXPECT_FALSE(first.empty());
+    EXPECT_FALSE(first.data_equal(other));
+
+    mCache.Clear();
+    EXPECT_FALSE(mCache.Find(key).has_value());
+    EXPECT_FALSE(mCache.Find(otherKey).has_value());
+}
+
+TEST_F(TestEncodedReportCache, TestNotCacheable)
+{
+    const EncodedReportCache::Key key = { ConcreteAttributePath(1, 6, 0), kDataVersion, false, false };
+    mCache.StoreNotCacheable(key);
+
+    std::optional<ByteSpan> found = mCache.Find(key);
+    ASSERT_TRUE(found.has_value());
+    EXPECT_TRUE(found->empty());
+}
+
+TEST_F(TestEncodedReportCache, TestOnlySingleReportsAreCached)
+{
+    const ConcreteAttributePath path(1, 6, 0);
+
+    // Chunked values are made of several reports.
+    TLV::TLVWriter writer;
+    mCache.PrepareWriter(writer);
+    ASSERT_EQ(EncodeReports(writer, path, { 1, 2 }), CHIP_NO_ERROR);
+    EXPECT_TRUE(mCache.GetWrittenReport(writer).empty());
+
+    mCache.PrepareWriter(writer);
+    ASSERT_EQ(EncodeReports(writer, path, {}), CHIP_NO_ERROR);
+    EXPECT_TRUE(mCache.GetWrittenReport(writer).empty());
+}
+
+TEST_F(TestEncodedReportCache, TestFull)
+{
+    for (size_t i = 0; i < EncodedReportCache::kMaxEntries; i++)
+    {
+        EXPECT_FALSE(mCache.IsFull());
+        Fill({ ConcreteAttributePath(1, 6, static_cast<AttributeId>(i)), kDataVersion, false, false }, 0);
+    }
+    EXPECT_TRUE(mCache.IsFull());
+
+    const EncodedReportCache::Key key = { ConcreteAttributePath(1, 6, 0xFFFF), kDataVersion, false, false };
+    mCache.StoreNotCacheable(key);
+    EXPECT_FALSE(mCache.Find(key).has_value());
+}
+
+} // namespace
+
+#endif // CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE > 0
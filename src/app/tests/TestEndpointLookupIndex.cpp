@@ -0,0 +1,73 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/tests/EndpointLookupIndexTestData.h>
+#include <app/util/endpoint-lookup-index.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Testing;
+
+namespace {
+
+class TestEndpointLookupIndex : public ::testing::Test
+{
+protected:
+    EndpointLookupIndex<kMaxEndpoints> mIndex;
+};
+
+TEST_F(TestEndpointLookupIndex, TestFindMatchesScan)
+{
+    ConfigureEndpoints(50);
+    mIndex.Rebuild(gEndpoints, 50, 50);
+    EXPECT_TRUE(mIndex.IsValid());
+
+    for (uint16_t i = 0; i < 50; i++)
+    {
+        EXPECT_EQ(mIndex.Find(gEndpoints[i].endpoint, IsEnabled), i);
+        EXPECT_EQ(mIndex.GetAttributeDataOffset(i), i * kEndpointType.endpointSize);
+    }
+    EXPECT_EQ(mIndex.Find(static_cast<EndpointId>(1), IsEnabled), kNotFound);
+    EXPECT_EQ(mIndex.Find(kInvalidEndpointId, IsEnabled), kNotFound);
+
+    mIndex.Invalidate();
+    EXPECT_FALSE(mIndex.IsValid());
+}
+
+TEST_F(TestEndpointLookupIndex, TestDuplicateAndDisabledEntries)
+{
+    ConfigureEndpoints(6);
+    // A disabled entry ahead of an enabled one with the same id, as happens while a dynamic endpoint is replaced.
+    gEndpoints[2].endpoint = gEndpoints[5].endpoint;
+    gEndpoints[2].bitmask.Clear(EmberAfEndpointOptions::isEnabled);
+    gEndpoints[4].endpoint = kInvalidEndpointId;
+    mIndex.Rebuild(gEndpoints, 6, 3);
+
+    EXPECT_EQ(mIndex.Find(gEndpoints[5].endpoint, IsEnabled), 5);
+    EXPECT_EQ(mIndex.Find(gEndpoints[5].endpoint, [](uint16_t) { return true; }), 2);
+    EXPECT_EQ(mIndex.Find(kInvalidEndpointId, [](uint16_t) { return true; }), kNotFound);
+
+    // Only fixed endpoints contribute to the attribute data offsets.
+    EXPECT_EQ(mIndex.GetAttributeDataOffset(0), 0);
+    EXPECT_EQ(mIndex.GetAttributeDataOffset(2), 2 * kEndpointType.endpointSize);
+    EXPECT_EQ(IndexedAttributeOffset(mIndex, gEndpoints[1].endpoint, 0x0006, 0x0003),
+              LinearAttributeOffset(6, 3, gEndpoints[1].endpoint, 0x0006, 0x0003));
+}
+
+} // namespace
@@ -26,6 +26,7 @@
 #include <app/EventLoggingTypes.h>
 #include <app/EventManagement.h>
 #include <app/InteractionModelEngine.h>
+#include <app/MessageDef/EventReportIB.h>
 #include <app/tests/AppTestContext.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/ErrorStr.h>
@@ -35,6 +36,8 @@
 #include <lib/support/CHIPCounter.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/EnforceFormat.h>
+#include <lib/support/LinkedList.h>
+#include <lib/support/ScopedBuffer.h>
 #include <lib/support/logging/Constants.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/Flags.h>
@@ -157,4 +160,85 @@ TEST_F(TestEventOverflow, TestCheckLogEventOverFlow)
     }
 }
 
+// Reads the numbers of the events in the log, in the order FetchEventsSince reads them.
+void CollectEventNumbers(chip::EventNumber * apNumbers, size_t aMaxCount, size_t & aCount)
+{
+    chip::TLV::TLVReader reader;
+    chip::app::CircularEventBufferWrapper bufWrapper;
+    ASSERT_EQ(chip::app::EventManagement::GetInstance().GetEventReader(reader, chip::app::PriorityLevel::Critical, &bufWrapper),
+              CHIP_NO_ERROR);
+
+    aCount = 0;
+    while (reader.Next() == CHIP_NO_ERROR)
+    {
+        chip::app::EventReportIB::Parser report;
+        chip::app::EventDataIB::Parser data;
+        ASSERT_LT(aCount, aMaxCount);
+        ASSERT_EQ(report.Init(reader), CHIP_NO_ERROR);
+        ASSERT_EQ(report.GetEventData(&data), CHIP_NO_ERROR);
+        ASSERT_EQ(data.GetEventNumber(&apNumbers[aCount]), CHIP_NO_ERROR);
+        aCount++;
+    }
+}
+
+chip::app::PriorityLevel PriorityForEvent(int i)
+{
+    switch (i % 3)
+    {
+    case 0:
+        return chip::app::PriorityLevel::Debug;
+    case 1:
+        return chip::app::PriorityLevel::Info;
+    default:
+        return chip::app::PriorityLevel::Critical;
+    }
+}
+
+TEST_F(TestEventOverflow, TestFetchEventsSinceAfterOverflow)
+{
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    TestEventGenerator testEventGenerator;
+    chip::app::EventOptions options;
+    chip::EventNumber eid = 0;
+    options.mPath         = { 1, 0x00000006, 1 };
+
+    for (int i = 0; i < 500; i++)
+    {
+        options.mPriority = PriorityForEvent(i * 7 / 5);
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid), CHIP_NO_ERROR);
+    }
+
+    chip::EventNumber eventNumbers[500];
+    size_t eventNumberCount = 0;
+    CollectEventNumbers(eventNumbers, ArraySize(eventNumbers), eventNumberCount);
+    ASSERT_GT(eventNumberCount, 0u);
+    for (size_t i = 1; i < eventNumberCount; i++)
+    {
+        EXPECT_LT(eventNumbers[i - 1], eventNumbers[i]);
+    }
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> path;
+    chip::Platform::ScopedMemoryBuffer<uint8_t> backingStore;
+    ASSERT_TRUE(backingStore.Alloc(8192));
+
+    // Every starting point gets exactly the events numbered from it, whether or not it is indexed.
+    for (chip::EventNumber eventMin = 0; eventMin <= eid + 2; eventMin++)
+    {
+        size_t expectedCount = 0;
+        for (size_t i = 0; i < eventNumberCount; i++)
+        {
+            expectedCount += (eventNumbers[i] >= eventMin) ? 1 : 0;
+        }
+
+        chip::TLV::TLVWriter writer;
+        writer.Init(backingStore.Get(), 8192);
+        chip::EventNumber nextEventMin = eventMin;
+        size_t eventCount              = 0;
+        EXPECT_EQ(logMgmt.FetchEventsSince(writer, &path, nextEventMin, eventCount, chip::Access::SubjectDescriptor{}),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(eventCount, expectedCount);
+        EXPECT_EQ(nextEventMin, eid + 1);
+    }
+}
+
 } // namespace
@@ -42,6 +42,7 @@
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/Flags.h>
+#include <system/SystemFaultInjection.h>
 
 namespace chip {
 
@@ -96,8 +97,17 @@ public:
     static bool InsertToDirtySet(const AttributePathParams & aPath);
 
     void TestBuildAndSendSingleReportData();
+    void TestBuildAndSendSingleReportDataWithoutLargeBuffer();
     void TestMergeOverlappedAttributePath();
     void TestMergeAttributePathWhenDirtySetPoolExhausted();
+    void TestSetDirtyMarksInterestedHandlers();
+    void TestSetDirtyScale();
+
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_INDEX
+    static void CreateSubscriptions(Platform::UniquePtr<ReadHandler> * aHandlers, size_t aCount,
+                                    ReadHandler::ManagementCallback & aCallback, ReadHandler::Observer & aObserver);
+    static AttributePathParams SubscribedPath(size_t aIndex);
+#endif
 
 private:
     chip::app::DataModel::Provider * mOldProvider = nullptr;
@@ -218,6 +228,52 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportData)
     DrainAndServiceIO();
 }
 
+#if CHIP_WITH_NLFAULTINJECTION
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportDataWithoutLargeBuffer)
+{
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferHandle readRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    ReadRequestMessage::Builder readRequestBuilder;
+    DummyDelegate dummy;
+
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+    TestExchangeDelegate delegate;
+    Messaging::ExchangeContext * exchangeCtx = NewExchangeToAlice(&delegate);
+
+    writer.Init(std::move(readRequestbuf));
+    EXPECT_EQ(readRequestBuilder.Init(&writer), CHIP_NO_ERROR);
+    AttributePathIBs::Builder & attributePathListBuilder = readRequestBuilder.CreateAttributeRequests();
+    EXPECT_EQ(readRequestBuilder.GetError(), CHIP_NO_ERROR);
+    AttributePathIB::Builder & attributePathBuilder = attributePathListBuilder.CreatePath();
+    EXPECT_EQ(attributePathListBuilder.GetError(), CHIP_NO_ERROR);
+    attributePathBuilder.Node(1).Endpoint(kTestEndpointId).Cluster(kTestClusterId).Attribute(kTestFieldId1).EndOfAttributePathIB();
+    EXPECT_EQ(attributePathBuilder.GetError(), CHIP_NO_ERROR);
+    attributePathListBuilder.EndOfAttributePathIBs();
+
+    readRequestBuilder.IsFabricFiltered(false).EndOfReadRequestMessage();
+    EXPECT_EQ(readRequestBuilder.GetError(), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(&readRequestbuf), CHIP_NO_ERROR);
+    app::ReadHandler readHandler(dummy, exchangeCtx, chip::app::ReadHandler::InteractionType::Read,
+                                 app::reporting::GetDefaultReportScheduler(), CodegenDataModelProviderInstance());
+    readHandler.OnInitialRequest(std::move(readRequestbuf));
+
+    // Size the report as a large payload session would, and fail that first allocation: the engine must fall back to a
+    // regular sized buffer and still send the report.
+    Engine & reportingEngine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    reportingEngine.SetReportBufferMaxSize(kMaxLargeSecureSduLengthBytes);
+    System::FaultInjection::GetManager().FailAtFault(System::FaultInjection::kFault_PacketBufferNew, 0, 1);
+    GetLoopback().mSentMessageCount = 0;
+
+    EXPECT_EQ(reportingEngine.BuildAndSendSingleReportData(&readHandler), CHIP_NO_ERROR);
+    EXPECT_EQ(GetLoopback().mSentMessageCount, 1u);
+
+    reportingEngine.SetReportBufferMaxSize(0);
+    DrainAndServiceIO();
+}
+#endif // CHIP_WITH_NLFAULTINJECTION
+
 TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
 {
     EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
@@ -351,6 +407,193 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeAttributePathWhenDirtySetPoolE
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
 
+#if CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_INDEX
+
+namespace {
+
+constexpr size_t kPathsPerSubscription = 3;
+constexpr size_t kSubscriptionCount =
+    (CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS) / kPathsPerSubscription;
+constexpr EndpointId kSubscribedEndpoints = 8;
+constexpr ClusterId kSubscribedClusters   = 32;
+constexpr ClusterId kFirstClusterId       = 0x100;
+
+class NullReadHandlerObserver : public ReadHandler::Observer
+{
+public:
+    void OnSubscriptionEstablished(ReadHandler * apReadHandler) override {}
+    void OnBecameReportable(ReadHandler * apReadHandler) override {}
+    void OnSubscriptionReportSent(ReadHandler * apReadHandler) override {}
+    void OnReadHandlerDestroyed(ReadHandler * apReadHandler) override {}
+};
+
+} // namespace
+
+AttributePathParams TestReportingEngine::SubscribedPath(size_t aIndex)
+{
+    AttributePathParams path(static_cast<EndpointId>(1 + aIndex % kSubscribedEndpoints),
+                             static_cast<ClusterId>(kFirstClusterId + (aIndex * 7) % kSubscribedClusters),
+                             static_cast<AttributeId>(1 + aIndex % kPathsPerSubscription));
+
+    // Mix in the wildcards controllers commonly use: whole clusters, whole endpoints and a cluster on all endpoints.
+    if (aIndex % 16 == 0)
+    {
+        path.mEndpointId = kInvalidEndpointId;
+    }
+    else if (aIndex % 16 == 8)
+    {
+        path.mClusterId   = kInvalidClusterId;
+        path.mAttributeId = kInvalidAttributeId;
+    }
+    else if (aIndex % 32 == 5)
+    {
+        path.mAttributeId = kInvalidAttributeId;
+    }
+    return path;
+}
+
+void TestReportingEngine::CreateSubscriptions(Platform::UniquePtr<ReadHandler> * aHandlers, size_t aCount,
+                                              ReadHandler::ManagementCallback & aCallback, ReadHandler::Observer & aObserver)
+{
+    for (size_t i = 0; i < aCount; i++)
+    {
+        aHandlers[i] = Platform::MakeUnique<ReadHandler>(aCallback, &aObserver, CodegenDataModelProviderInstance());
+        ASSERT_NE(aHandlers[i], nullptr);
+        for (size_t j = 0; j < kPathsPerSubscription; j++)
+        {
+            AttributePathParams path = SubscribedPath(i * kPathsPerSubscription + j);
+            ASSERT_EQ(InteractionModelEngine::GetInstance()->PushFrontAttributePathList(aHandlers[i]->mpAttributePathList, path),
+                      CHIP_NO_ERROR);
+        }
+        aHandlers[i]->mState = ReadHandler::HandlerState::CanStartReporting;
+        InteractionModelEngine::GetInstance()->GetReportingEngine().AddAttributeInterest(*aHandlers[i]);
+    }
+}
+
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestSetDirtyMarksInterestedHandlers)
+{
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    DummyDelegate dummy;
+    NullReadHandlerObserver observer;
+    Platform::UniquePtr<ReadHandler> handlers[kSubscriptionCount];
+    CreateSubscriptions(handlers, kSubscriptionCount, dummy, observer);
+    EXPECT_TRUE(engine.mAttributeInterestIndex.IsComplete());
+
+    const AttributePathParams changes[] = {
+        AttributePathParams(1, kFirstClusterId + 7, 2),
+        AttributePathParams(3, kFirstClusterId + 21, 1),
+        AttributePathParams(kSubscribedEndpoints, kFirstClusterId, 3),
+        AttributePathParams(kSubscribedEndpoints + 1, kFirstClusterId + 1, 1), // not subscribed to
+        AttributePathParams(EndpointId(2), ClusterId(kFirstClusterId + 14)),   // whole cluster
+        AttributePathParams(kInvalidEndpointId, kFirstClusterId + 3, 1),       // cluster on all endpoints
+        AttributePathParams(EndpointId(5), kInvalidClusterId),                 // whole endpoint
+    };
+
+    for (const auto & change : changes)
+    {
+        EXPECT_EQ(engine.SetDirty(change), CHIP_NO_ERROR);
+
+        for (const auto & handler : handlers)
+        {
+            bool interested = false;
+            for (auto path = handler->GetAttributePathList(); path != nullptr; path = path->mpNext)
+            {
+                interested = interested || path->mValue.Intersects(change);
+            }
+            EXPECT_EQ(handler->mDirtyGeneration == engine.GetDirtySetGeneration(), interested);
+        }
+    }
+
+    // Handlers that are not reporting yet must not be marked dirty.
+    handlers[0]->mState = ReadHandler::HandlerState::Idle;
+    EXPECT_EQ(engine.SetDirty(AttributePathParams()), CHIP_NO_ERROR);
+    EXPECT_NE(handlers[0]->mDirtyGeneration, engine.GetDirtySetGeneration());
+    EXPECT_EQ(handlers[1]->mDirtyGeneration, engine.GetDirtySetGeneration());
+
+    // Destroyed handlers remove themselves from the index.
+    for (auto & handler : handlers)
+    {
+        handler.reset();
+    }
+    EXPECT_TRUE(engine.mAttributeInterestIndex.IsEmpty());
+
+    engine.mGlobalDirtySet.ReleaseAll();
+    engine.Shutdown();
+}
+
+TEST_F_FROM_FIXTURE(TestReportingEngine, TestSetDirtyScale)
+{
+    EXPECT_EQ(InteractionModelEngine::GetInstance()->Init(&GetExchangeManager(), &GetFabricTable(),
+                                                          app::reporting::GetDefaultReportScheduler()),
+              CHIP_NO_ERROR);
+
+    constexpr int kChanges = 20000;
+
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    DummyDelegate dummy;
+    NullReadHandlerObserver observer;
+    Platform::UniquePtr<ReadHandler> handlers[kSubscriptionCount];
+    CreateSubscriptions(handlers, kSubscriptionCount, dummy, observer);
+
+    auto changedPath = [](int i) {
+        return AttributePathParams(static_cast<EndpointId>(1 + i % (kSubscribedEndpoints + 2)),
+                                   static_cast<ClusterId>(kFirstClusterId + (i * 5) % (kSubscribedClusters + 8)),
+                                   static_cast<AttributeId>(1 + i % 4));
+    };
+
+    // Reference: what SetDirty does without the index, visiting every path of every handler.
+    auto start = System::SystemClock().GetMonotonicMicroseconds64();
+    for (int i = 0; i < kChanges; i++)
+    {
+        AttributePathParams change = changedPath(i);
+        engine.BumpDirtySetGeneration();
+        bool intersectsInterestPath = false;
+        for (const auto & handler : handlers)
+        {
+            for (auto path = handler->GetAttributePathList(); path != nullptr; path = path->mpNext)
+            {
+                if (path->mValue.Intersects(change))
+                {
+                    handler->AttributePathIsDirty(change);
+                    intersectsInterestPath = true;
+                    break;
+                }
+            }
+        }
+        if (intersectsInterestPath)
+        {
+            EXPECT_EQ(engine.InsertPathIntoDirtySet(change), CHIP_NO_ERROR);
+        }
+    }
+    auto mid = System::SystemClock().GetMonotonicMicroseconds64();
+    engine.mGlobalDirtySet.ReleaseAll();
+
+    auto indexedStart = System::SystemClock().GetMonotonicMicroseconds64();
+    for (int i = 0; i < kChanges; i++)
+    {
+        EXPECT_EQ(engine.SetDirty(changedPath(i)), CHIP_NO_ERROR);
+    }
+    auto end = System::SystemClock().GetMonotonicMicroseconds64();
+
+    ChipLogProgress(Test, "%u subscriptions x %u paths: linear SetDirty %u ns, indexed SetDirty %u ns",
+                    static_cast<unsigned>(kSubscriptionCount), static_cast<unsigned>(kPathsPerSubscription),
+                    static_cast<unsigned>((mid - start).count() * 1000 / kChanges),
+                    static_cast<unsigned>((end - indexedStart).count() * 1000 / kChanges));
+
+    for (auto & handler : handlers)
+    {
+        handler.reset();
+    }
+    engine.mGlobalDirtySet.ReleaseAll();
+    engine.Shutdown();
+}
+
+#endif // CHIP_CONFIG_PERSIST_SUBSCRIPTIONS && CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_INDEX
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -0,0 +1,121 @@
+/**
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/util/af-types.h>
+#include <lib/core/DataModelTypes.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+/**
+ * Lookup index over an EmberAfDefinedEndpoint table (emAfEndpoints), so that resolving an endpoint
+ * id to its index in the table is a binary search instead of a scan of every defined endpoint.
+ *
+ * The index also records, for each fixed endpoint, the offset of its attributes in the attribute
+ * data block, which otherwise has to be computed by summing the sizes of all preceding endpoints.
+ *
+ * The index is a snapshot of the endpoint ids and types: it must be invalidated whenever an entry's
+ * endpoint id or type changes or the endpoint count changes. The enabled state of endpoints is not
+ * part of the snapshot; Find() callers check it on the candidate entries.
+ */
+template <uint16_t kMaxEndpoints>
+class EndpointLookupIndex
+{
+public:
+    static constexpr uint16_t kInvalidIndex = 0xFFFF;
+
+    bool IsValid() const { return mValid; }
+    void Invalidate() { mValid = false; }
+
+    /**
+     * Rebuild the index from the first endpointCount entries of the given table, of which the first
+     * fixedEndpointCount are fixed endpoints.
+     */
+    void Rebuild(const EmberAfDefinedEndpoint * endpoints, uint16_t endpointCount, uint16_t fixedEndpointCount)
+    {
+        endpointCount      = std::min(endpointCount, kMaxEndpoints);
+        fixedEndpointCount = std::min(fixedEndpointCount, endpointCount);
+
+        uint16_t dataOffset = 0;
+        for (uint16_t i = 0; i < fixedEndpointCount; i++)
+        {
+            mDataOffsets[i] = dataOffset;
+            dataOffset      = static_cast<uint16_t>(dataOffset + endpoints[i].endpointType->endpointSize);
+        }
+
+        mEntryCount = 0;
+        for (uint16_t i = 0; i < endpointCount; i++)
+        {
+            if (endpoints[i].endpoint != kInvalidEndpointId)
+            {
+                mEntries[mEntryCount++] = { endpoints[i].endpoint, i };
+            }
+        }
+        // Entries for the same id stay in table order, so Find() returns the same entry a scan would.
+        std::sort(mEntries, mEntries + mEntryCount, [](const Entry & a, const Entry & b) {
+            return (a.endpoint < b.endpoint) || (a.endpoint == b.endpoint && a.index < b.index);
+        });
+
+        mValid = true;
+    }
+
+    /**
+     * Returns the lowest table index holding the given endpoint id for which accept(index) returns
+     * true, or kInvalidIndex if there is none.
+     */
+    template <typename Predicate>
+    uint16_t Find(EndpointId endpoint, Predicate && accept) const
+    {
+        const Entry * end = mEntries + mEntryCount;
+        const Entry * it  = std::lower_bound(mEntries, end, endpoint,
+                                             [](const Entry & entry, EndpointId id) { return entry.endpoint < id; });
+        for (; it != end && it->endpoint == endpoint; ++it)
+        {
+            if (accept(it->index))
+            {
+                return it->index;
+            }
+        }
+        return kInvalidIndex;
+    }
+
+    /**
+     * Returns the offset in the attribute data block of the attributes of the fixed endpoint at the
+     * given table index.
+     */
+    uint16_t GetAttributeDataOffset(uint16_t fixedEndpointIndex) const { return mDataOffsets[fixedEndpointIndex]; }
+
+private:
+    struct Entry
+    {
+        EndpointId endpoint;
+        uint16_t index;
+    };
+
+    Entry mEntries[kMaxEndpoints];
+    uint16_t mDataOffsets[kMaxEndpoints];
+    uint16_t mEntryCount = 0;
+    bool mValid          = false;
+};
+
+} // namespace app
+} // namespace chip
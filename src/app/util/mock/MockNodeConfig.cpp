@@ -193,10 +193,13 @@ MockEndpointConfig::MockEndpointConfig(EndpointId aId, std::initializer_list<Moc
 }
 
 MockEndpointConfig::MockEndpointConfig(const MockEndpointConfig & other) :
-    id(other.id), clusters(other.clusters), mEmberClusters(other.mEmberClusters), mDeviceTypes(other.mDeviceTypes),
-    mEmberEndpoint(other.mEmberEndpoint)
+    id(other.id), clusters(other.clusters), mDeviceTypes(other.mDeviceTypes), mEmberEndpoint(other.mEmberEndpoint)
 {
-    // fix self-referencing pointers
+    // fix self-referencing pointers: the ember clusters must reference the attribute metadata of our own cluster copies
+    for (const auto & cluster : clusters)
+    {
+        mEmberClusters.push_back(*cluster.emberCluster());
+    }
     mEmberEndpoint.cluster = mEmberClusters.data();
 }
 
@@ -29,6 +29,7 @@
 
 #include <credentials/CHIPCert_Internal.h>
 #include <credentials/CHIPCertificateSet.h>
+#include <credentials/VerifiedCertificateCache.h>
 #include <lib/asn1/ASN1.h>
 #include <lib/asn1/ASN1Macros.h>
 #include <lib/core/CHIPCore.h>
@@ -411,8 +412,16 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
 
     // Verify signature of the current certificate against public key of the CA certificate. If signature verification
     // succeeds, the current certificate is valid.
+    if (context.mVerifiedCertCache != nullptr && context.mVerifiedCertCache->Contains(*cert, *caCert, context.mEffectiveTime))
+    {
+        ExitNow(err = CHIP_NO_ERROR);
+    }
     err = VerifyCertSignature(*cert, *caCert);
     SuccessOrExit(err);
+    if (context.mVerifiedCertCache != nullptr)
+    {
+        context.mVerifiedCertCache->Add(*cert, *caCert);
+    }
 
 exit:
     return err;
@@ -499,9 +508,10 @@ bool ChipCertificateData::IsEqual(const ChipCertificateData & other) const
 
 void ValidationContext::Reset()
 {
-    mEffectiveTime  = EffectiveTime{};
-    mTrustAnchor    = nullptr;
-    mValidityPolicy = nullptr;
+    mEffectiveTime     = EffectiveTime{};
+    mTrustAnchor       = nullptr;
+    mValidityPolicy    = nullptr;
+    mVerifiedCertCache = nullptr;
     mRequiredKeyUsages.ClearAll();
     mRequiredKeyPurposes.ClearAll();
     mRequiredCertType = CertType::kNotSpecified;
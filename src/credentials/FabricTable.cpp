@@ -1011,6 +1011,7 @@ CHIP_ERROR FabricTable::Delete(FabricIndex fabricIndex)
 
     // Since fabricIsInitialized was true, fabric is not null.
     fabricInfo->Reset();
+    mVerifiedCertificateCache.Clear();
 
     if (!mNextAvailableFabricIndex.HasValue())
     {
@@ -1097,6 +1098,8 @@ CHIP_ERROR FabricTable::Init(const FabricTable::InitParams & initParams)
     // this condition and can act appropriately.
     mLastKnownGoodTime.Init(mStorage);
 
+    ReturnErrorOnFailure(mVerifiedCertificateCache.Init());
+
     uint8_t buf[IndexInfoTLVMaxSize()];
     uint16_t size  = sizeof(buf);
     CHIP_ERROR err = mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::FabricIndexInfo().KeyName(), buf, size);
@@ -1466,8 +1469,11 @@ CHIP_ERROR FabricTable::StoreCommitMarker(const CommitMarker & commitMarker)
     const auto markerContextTLVLength = writer.GetLengthWritten();
     VerifyOrReturnError(CanCastTo<uint16_t>(markerContextTLVLength), CHIP_ERROR_BUFFER_TOO_SMALL);
 
-    return mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::FailSafeCommitMarkerKey().KeyName(), tlvBuf,
-                                     static_cast<uint16_t>(markerContextTLVLength));
+    ReturnErrorOnFailure(mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::FailSafeCommitMarkerKey().KeyName(), tlvBuf,
+                                                   static_cast<uint16_t>(markerContextTLVLength)));
+
+    // The marker must reach storage before any of the data it protects.
+    return mStorage->SyncFlush();
 }
 
 CHIP_ERROR FabricTable::GetCommitMarker(CommitMarker & outCommitMarker)
@@ -2025,12 +2031,21 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
             }
         }
         stickyError = (stickyError != CHIP_NO_ERROR) ? stickyError : fabricIndexErr;
+
+        // Everything above must reach storage before the commit marker is cleared below.
+        CHIP_ERROR flushErr = mStorage->SyncFlush();
+        if (flushErr != CHIP_NO_ERROR)
+        {
+            ChipLogError(FabricProvisioning, "Failed to flush committed fabric data: %" CHIP_ERROR_FORMAT, flushErr.Format());
+        }
+        stickyError = (stickyError != CHIP_NO_ERROR) ? stickyError : flushErr;
     }
 
     // Commit must have same side-effect as reverting all pending data
     mStateFlags.ClearAll();
     mFabricIndexWithPendingState = kUndefinedFabricIndex;
     mPendingFabric.Reset();
+    mVerifiedCertificateCache.Clear();
 
     if (stickyError != CHIP_NO_ERROR)
     {
@@ -2073,6 +2088,7 @@ void FabricTable::RevertPendingFabricData()
 
     mStateFlags.ClearAll();
     mFabricIndexWithPendingState = kUndefinedFabricIndex;
+    mVerifiedCertificateCache.Clear();
 }
 
 void FabricTable::RevertPendingOpCertsExceptRoot()
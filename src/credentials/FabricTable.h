@@ -29,6 +29,7 @@
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/LastKnownGoodTime.h>
 #include <credentials/OperationalCertificateStore.h>
+#include <credentials/VerifiedCertificateCache.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <crypto/OperationalKeystore.h>
 #include <lib/core/CHIPEncoding.h>
@@ -969,6 +970,13 @@ public:
                                         Credentials::ValidationContext & context, CompressedFabricId & outCompressedFabricId,
                                         FabricId & outFabricId, NodeId & outNodeId, Crypto::P256PublicKey & outNocPubkey,
                                         Crypto::P256PublicKey * outRootPublicKey = nullptr);
+
+    /**
+     * @brief Cache of operational certificate signatures already verified, to set in the ValidationContext
+     *        passed to VerifyCredentials. It is cleared whenever fabrics or trusted roots change.
+     */
+    Credentials::VerifiedCertificateCache & GetVerifiedCertificateCache() { return mVerifiedCertificateCache; }
+
     /**
      * @brief Enables FabricInfo instances to collide and reference the same logical fabric (i.e Root Public Key + FabricId).
      *
@@ -1219,6 +1227,8 @@ private:
 
     LastKnownGoodTime mLastKnownGoodTime;
 
+    Credentials::VerifiedCertificateCache mVerifiedCertificateCache;
+
     // We may not have an mNextAvailableFabricIndex if our table is as large as
     // it can go and is full.
     Optional<FabricIndex> mNextAvailableFabricIndex;
@@ -24,6 +24,8 @@
 #include <lib/support/Pool.h>
 #include <stdlib.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Credentials {
 
@@ -34,6 +36,23 @@ using EpochKey      = GroupDataProvider::EpochKey;
 using KeySet        = GroupDataProvider::KeySet;
 using GroupSession  = GroupDataProvider::GroupSession;
 
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+// Orders group session cache entries by session ID, for binary searches on the sorted cache.
+struct GroupSessionCacheEntryCompare
+{
+    template <typename Entry>
+    bool operator()(const Entry & entry, uint16_t session_id) const
+    {
+        return entry.session_id < session_id;
+    }
+    template <typename Entry>
+    bool operator()(uint16_t session_id, const Entry & entry) const
+    {
+        return session_id < entry.session_id;
+    }
+};
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
 struct FabricList : public CommonPersistentData::FabricList
 {
     CHIP_ERROR UpdateKey(StorageKeyName & key) override
@@ -832,12 +851,14 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+    InvalidateGroupSessionCache();
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
 {
     VerifyOrDie(storage != nullptr);
     mStorage = storage;
+    InvalidateGroupSessionCache();
 }
 
 //
@@ -1349,6 +1370,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
@@ -1415,6 +1437,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeyMapData map;
@@ -1447,6 +1470,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
@@ -1523,6 +1547,7 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
                                             const KeySet & in_keyset)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1594,6 +1619,7 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionCache();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1695,6 +1721,7 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    InvalidateGroupSessionCache();
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1845,6 +1872,22 @@ GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGrou
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    if (provider.LoadGroupSessionCache())
+    {
+        const GroupSessionCacheEntry * begin = provider.mGroupSessionCache;
+        const GroupSessionCacheEntry * end   = begin + provider.mGroupSessionCacheCount;
+        const auto range = std::equal_range(begin, end, session_id, GroupSessionCacheEntryCompare());
+
+        mUseCache        = true;
+        mCacheBegin      = static_cast<size_t>(range.first - begin);
+        mCacheIndex      = mCacheBegin;
+        mCacheEnd        = static_cast<size_t>(range.second - begin);
+        mCacheGeneration = provider.mGroupSessionCacheGeneration;
+        return;
+    }
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -1857,6 +1900,13 @@ GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupD
 
 size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 {
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    if (mUseCache)
+    {
+        return (mCacheGeneration == mProvider.mGroupSessionCacheGeneration) ? (mCacheEnd - mCacheBegin) : 0;
+    }
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
     FabricData fabric(mFirstFabric);
     size_t count = 0;
 
@@ -1898,6 +1948,23 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    if (mUseCache)
+    {
+        // Stop if the keys changed since this iterator was created, the remaining entries may be gone.
+        VerifyOrReturnValue(mCacheGeneration == mProvider.mGroupSessionCacheGeneration, false);
+        VerifyOrReturnValue(mCacheIndex < mCacheEnd, false);
+
+        const GroupSessionCacheEntry & entry = mProvider.mGroupSessionCache[mCacheIndex++];
+        mGroupKeyContext.Initialize(entry.encryption_key, mSessionId, entry.privacy_key);
+        output.fabric_index    = entry.fabric_index;
+        output.group_id        = entry.group_id;
+        output.security_policy = entry.security_policy;
+        output.keyContext      = &mGroupKeyContext;
+        return true;
+    }
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
@@ -1956,6 +2023,79 @@ void GroupDataProviderImpl::GroupSessionIteratorImpl::Release()
     mProvider.mGroupSessionsIterator.ReleaseObject(this);
 }
 
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
+bool GroupDataProviderImpl::LoadGroupSessionCache()
+{
+    VerifyOrReturnValue(!mGroupSessionCacheLoaded, true);
+    VerifyOrReturnValue(IsInitialized(), false);
+
+    size_t count = 0;
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(mStorage);
+    VerifyOrReturnValue(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, false);
+
+    // Same traversal as GroupSessionIteratorImpl::Next(): fabrics, then group-key mappings, then keys.
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        VerifyOrReturnValue(CHIP_NO_ERROR == fabric.Load(mStorage), false);
+
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; j < fabric.map_count; ++j, mapping.id = mapping.next)
+        {
+            VerifyOrReturnValue(CHIP_NO_ERROR == mapping.Load(mStorage), false);
+
+            // A mapping may refer to a key set that has been removed, it has no keys then.
+            KeySetData keyset;
+            if (!keyset.Find(mStorage, fabric, mapping.keyset_id))
+            {
+                continue;
+            }
+
+            for (uint16_t k = 0; k < keyset.keys_count; ++k)
+            {
+                const Crypto::GroupOperationalCredentials & creds = keyset.operational_keys[k];
+                if (count >= ArraySize(mGroupSessionCache))
+                {
+                    ChipLogProgress(Crypto, "Group session cache full, group messages will be decrypted from storage");
+                    InvalidateGroupSessionCache();
+                    return false;
+                }
+
+                // Insert after any entries with the same session ID to keep the storage order within a session ID.
+                GroupSessionCacheEntry * end = mGroupSessionCache + count;
+                GroupSessionCacheEntry * pos = std::upper_bound(mGroupSessionCache, end, creds.hash, GroupSessionCacheEntryCompare());
+                std::move_backward(pos, end, end + 1);
+
+                pos->session_id      = creds.hash;
+                pos->fabric_index    = fabric.fabric_index;
+                pos->security_policy = keyset.policy;
+                pos->group_id        = mapping.group_id;
+                memcpy(pos->encryption_key, creds.encryption_key, sizeof(pos->encryption_key));
+                memcpy(pos->privacy_key, creds.privacy_key, sizeof(pos->privacy_key));
+                count++;
+            }
+        }
+    }
+
+    mGroupSessionCacheCount  = count;
+    mGroupSessionCacheLoaded = true;
+    return true;
+}
+
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+
+void GroupDataProviderImpl::InvalidateGroupSessionCache()
+{
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(mGroupSessionCache), sizeof(mGroupSessionCache));
+    mGroupSessionCacheCount  = 0;
+    mGroupSessionCacheLoaded = false;
+    mGroupSessionCacheGeneration++;
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+}
+
 namespace {
 
 GroupDataProvider * gGroupsProvider = nullptr;
@@ -242,9 +242,48 @@ protected:
         uint16_t mKeyCount       = 0;
         bool mFirstMap           = true;
         GroupKeyContext mGroupKeyContext;
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+        // When the provider's group session cache is loaded, the iterator walks the cache entries
+        // [mCacheBegin, mCacheEnd) instead of the persistent records.
+        bool mUseCache            = false;
+        size_t mCacheBegin        = 0;
+        size_t mCacheIndex        = 0;
+        size_t mCacheEnd          = 0;
+        uint32_t mCacheGeneration = 0;
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
     };
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
+    // Must be called before any change to the group-key mappings, key sets or fabrics.
+    void InvalidateGroupSessionCache();
+
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
+    // Operational key of a group-key mapping, as needed to decrypt an incoming group message.
+    struct GroupSessionCacheEntry
+    {
+        uint16_t session_id;
+        FabricIndex fabric_index;
+        SecurityPolicy security_policy;
+        GroupId group_id;
+        Crypto::Symmetric128BitsKeyByteArray encryption_key;
+        Crypto::Symmetric128BitsKeyByteArray privacy_key;
+    };
+
+    /**
+     * Load the group session cache from persistent storage, if it is not already loaded.
+     *
+     * @return true if the cache holds every group session key, false if the keys could not be read or do not fit,
+     *         in which case lookups must read persistent storage.
+     */
+    bool LoadGroupSessionCache();
+
+    // Entries are sorted by session ID, and keep the fabric/mapping/key order of the persistent records within a session ID.
+    GroupSessionCacheEntry mGroupSessionCache[CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE];
+    size_t mGroupSessionCacheCount        = 0;
+    // Incremented on every invalidation, so iterators can detect that their cache entries are stale.
+    uint32_t mGroupSessionCacheGeneration = 0;
+    bool mGroupSessionCacheLoaded         = false;
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE > 0
 
     PersistentStorageDelegate * mStorage       = nullptr;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
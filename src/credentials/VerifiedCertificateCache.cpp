@@ -0,0 +1,148 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "VerifiedCertificateCache.h"
+
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace Credentials {
+
+CHIP_ERROR VerifiedCertificateCache::Init()
+{
+    VerifyOrReturnError(!mInitialized, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(System::Mutex::Init(mLock));
+    mInitialized = true;
+    return CHIP_NO_ERROR;
+}
+
+void VerifiedCertificateCache::Clear()
+{
+    VerifyOrReturn(mInitialized);
+    mLock.Lock();
+    mCount = 0;
+    mLock.Unlock();
+}
+
+bool VerifiedCertificateCache::Contains(const ChipCertificateData & cert, const ChipCertificateData & signer,
+                                        const EffectiveTime & effectiveTime)
+{
+    VerifyOrReturnValue(mInitialized, false);
+
+    Digest digest;
+    VerifyOrReturnValue(ComputeDigest(cert, signer, digest) == CHIP_NO_ERROR, false);
+
+    bool found = false;
+    mLock.Lock();
+    Entry * entry = Find(digest);
+    if (entry != nullptr)
+    {
+        if (IsExpired(*entry, effectiveTime))
+        {
+            // Keep the slot for certificates that can still be validated.
+            *entry = mEntries[--mCount];
+        }
+        else
+        {
+            entry->lastUsed = ++mUseCounter;
+            found           = true;
+        }
+    }
+    mLock.Unlock();
+
+    return found;
+}
+
+void VerifiedCertificateCache::Add(const ChipCertificateData & cert, const ChipCertificateData & signer)
+{
+    VerifyOrReturn(mInitialized);
+
+    Digest digest;
+    VerifyOrReturn(ComputeDigest(cert, signer, digest) == CHIP_NO_ERROR);
+
+    mLock.Lock();
+    // Another validation may have added the same signature meanwhile.
+    Entry * entry = Find(digest);
+    if (entry == nullptr)
+    {
+        if (mCount < CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE)
+        {
+            entry = &mEntries[mCount++];
+        }
+        else
+        {
+            entry = &mEntries[0];
+            for (auto & candidate : mEntries)
+            {
+                if (candidate.lastUsed < entry->lastUsed)
+                {
+                    entry = &candidate;
+                }
+            }
+        }
+        memcpy(entry->digest, digest, sizeof(digest));
+        entry->notAfterTime = cert.mNotAfterTime;
+    }
+    entry->lastUsed = ++mUseCounter;
+    mLock.Unlock();
+}
+
+CHIP_ERROR VerifiedCertificateCache::ComputeDigest(const ChipCertificateData & cert, const ChipCertificateData & signer,
+                                                   Digest & outDigest)
+{
+    VerifyOrReturnError(cert.mCertFlags.Has(CertFlags::kTBSHashPresent), CHIP_ERROR_INVALID_ARGUMENT);
+
+    Crypto::Hash_SHA256_stream hash;
+    MutableByteSpan digestSpan(outDigest);
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(hash.AddData(signer.mPublicKey));
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(cert.mTBSHash)));
+    ReturnErrorOnFailure(hash.AddData(cert.mSignature));
+    return hash.Finish(digestSpan);
+}
+
+bool VerifiedCertificateCache::IsExpired(const Entry & entry, const EffectiveTime & effectiveTime)
+{
+    VerifyOrReturnValue(entry.notAfterTime != kNullCertTime, false);
+
+    if (effectiveTime.Is<CurrentChipEpochTime>())
+    {
+        return effectiveTime.Get<CurrentChipEpochTime>().count() > entry.notAfterTime;
+    }
+    if (effectiveTime.Is<LastKnownGoodChipEpochTime>())
+    {
+        return effectiveTime.Get<LastKnownGoodChipEpochTime>().count() > entry.notAfterTime;
+    }
+    return false;
+}
+
+VerifiedCertificateCache::Entry * VerifiedCertificateCache::Find(const Digest & digest)
+{
+    for (size_t i = 0; i < mCount; i++)
+    {
+        if (memcmp(mEntries[i].digest, digest, sizeof(digest)) == 0)
+        {
+            return &mEntries[i];
+        }
+    }
+    return nullptr;
+}
+
+} // namespace Credentials
+} // namespace chip
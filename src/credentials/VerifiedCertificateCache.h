@@ -0,0 +1,98 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <credentials/CHIPCert.h>
+#include <credentials/CHIPCertificateSet.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <system/SystemMutex.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Credentials {
+
+static_assert(CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE > 0, "Verified certificate cache must hold at least one entry");
+
+/**
+ *  @class VerifiedCertificateCache
+ *
+ *  @brief
+ *    Bounded, least-recently-used record of certificate signatures that were
+ *    already verified against a given signer public key.
+ *
+ *    When set in a ValidationContext, certificate validation skips the ECDSA
+ *    verification of signatures found in the cache. Every other check (trust
+ *    anchor, chaining, key usages, validity period) is still made each time,
+ *    so the cache only saves the verification math. Entries are keyed by a
+ *    hash of the signer public key, the certificate TBS hash and signature,
+ *    and are dropped once the certificate has expired.
+ *
+ *    The cache may be used from several threads at once.
+ */
+class VerifiedCertificateCache
+{
+public:
+    CHIP_ERROR Init();
+
+    /**
+     * @brief Forget every verified signature, e.g. when trusted roots or fabrics change.
+     **/
+    void Clear();
+
+    /**
+     * @brief Check whether the signature of `cert` was already verified against `signer`.
+     *
+     * @param cert           Certificate, loaded with its TBS hash.
+     * @param signer         Certificate whose public key signed `cert`.
+     * @param effectiveTime  Time of the validation, entries of certificates expired by then are dropped.
+     **/
+    bool Contains(const ChipCertificateData & cert, const ChipCertificateData & signer, const EffectiveTime & effectiveTime);
+
+    /**
+     * @brief Record that the signature of `cert` was verified against `signer`, evicting the least
+     *        recently used entry if the cache is full.
+     **/
+    void Add(const ChipCertificateData & cert, const ChipCertificateData & signer);
+
+private:
+    using Digest = uint8_t[Crypto::kSHA256_Hash_Length];
+
+    struct Entry
+    {
+        Digest digest;
+        uint32_t notAfterTime;
+        uint32_t lastUsed;
+    };
+
+    static CHIP_ERROR ComputeDigest(const ChipCertificateData & cert, const ChipCertificateData & signer, Digest & outDigest);
+    static bool IsExpired(const Entry & entry, const EffectiveTime & effectiveTime);
+
+    Entry * Find(const Digest & digest);
+
+    System::Mutex mLock;
+    bool mInitialized = false;
+    Entry mEntries[CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE];
+    size_t mCount        = 0;
+    uint32_t mUseCounter = 0;
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -17,12 +17,19 @@
 #include "FileAttestationTrustStore.h"
 
 #include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/BufferReader.h>
+#include <lib/support/logging/CHIPLogging.h>
+
 #include <cstdio>
 #include <cstring>
 #include <string>
 
 extern "C" {
 #include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 }
 
 namespace chip {
@@ -38,21 +45,120 @@ const char * GetFilenameExtension(const char * filename)
     }
     return dot + 1;
 }
+
+constexpr uint8_t kBundleMagic[]     = { 'P', 'A', 'A', 'B' };
+constexpr uint16_t kBundleVersion    = 1;
+constexpr size_t kBundleHeaderLength = sizeof(kBundleMagic) + sizeof(uint16_t) * 2 + sizeof(uint32_t);
+constexpr size_t kBundleEntryLength  = Crypto::kSubjectKeyIdentifierLength + sizeof(uint32_t) * 2;
+
+bool IsRegularFile(const char * path)
+{
+    struct stat pathStat;
+    return (stat(path, &pathStat) == 0) && S_ISREG(pathStat.st_mode);
+}
 } // namespace
 
 FileAttestationTrustStore::FileAttestationTrustStore(const char * paaTrustStorePath)
 {
     VerifyOrReturn(paaTrustStorePath != nullptr);
 
-    if (paaTrustStorePath != nullptr)
+    if (IsRegularFile(paaTrustStorePath))
+    {
+        CHIP_ERROR err = LoadBundle(paaTrustStorePath);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Support, "Failed to load PAA bundle %s: %" CHIP_ERROR_FORMAT, paaTrustStorePath, err.Format());
+            Cleanup();
+            return;
+        }
+    }
+    else
     {
         mPAADerCerts = LoadAllX509DerCerts(paaTrustStorePath);
-        VerifyOrReturn(paaCount());
+        IndexCertificates();
     }
+    VerifyOrReturn(paaCount());
 
     mIsInitialized = true;
 }
 
+size_t FileAttestationTrustStore::SubjectKeyIdHash::operator()(const SubjectKeyId & skid) const
+{
+    // SKIDs are derived from a hash of the public key, so their leading bytes are already well distributed.
+    static_assert(sizeof(size_t) <= Crypto::kSubjectKeyIdentifierLength, "SKID too short to derive a hash from");
+    size_t hash;
+    memcpy(&hash, skid.data(), sizeof(hash));
+    return hash;
+}
+
+void FileAttestationTrustStore::IndexCertificates()
+{
+    mPAAIndex.reserve(mPAADerCerts.size());
+    for (const auto & certificate : mPAADerCerts)
+    {
+        ByteSpan certSpan{ certificate.data(), certificate.size() };
+        SubjectKeyId skid;
+        MutableByteSpan skidSpan{ skid };
+        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(certSpan, skidSpan) || skidSpan.size() != skid.size())
+        {
+            continue;
+        }
+
+        // On duplicate SKIDs, the first certificate loaded wins.
+        mPAAIndex.emplace(skid, certSpan);
+    }
+}
+
+CHIP_ERROR FileAttestationTrustStore::LoadBundle(const char * bundlePath)
+{
+    int fd = open(bundlePath, O_RDONLY);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_OPEN_FAILED);
+
+    struct stat bundleStat;
+    if (fstat(fd, &bundleStat) != 0 || bundleStat.st_size < static_cast<off_t>(kBundleHeaderLength))
+    {
+        close(fd);
+        return CHIP_ERROR_INVALID_FILE_IDENTIFIER;
+    }
+
+    void * bundle = mmap(nullptr, static_cast<size_t>(bundleStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    VerifyOrReturnError(bundle != MAP_FAILED, CHIP_ERROR_OPEN_FAILED);
+    mBundle     = bundle;
+    mBundleSize = static_cast<size_t>(bundleStat.st_size);
+
+    ByteSpan bundleSpan{ static_cast<const uint8_t *>(mBundle), mBundleSize };
+    Encoding::LittleEndian::Reader reader(bundleSpan);
+
+    uint8_t magic[sizeof(kBundleMagic)];
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t count;
+    ReturnErrorOnFailure(reader.ReadBytes(magic, sizeof(magic)).StatusCode());
+    ReturnErrorOnFailure(reader.Read16(&version).Read16(&reserved).Read32(&count).StatusCode());
+
+    VerifyOrReturnError(memcmp(magic, kBundleMagic, sizeof(magic)) == 0, CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+    VerifyOrReturnError(version == kBundleVersion, CHIP_ERROR_VERSION_MISMATCH);
+    VerifyOrReturnError(count <= reader.Remaining() / kBundleEntryLength, CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+
+    mPAAIndex.reserve(count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        SubjectKeyId skid;
+        uint32_t offset;
+        uint32_t length;
+        ReturnErrorOnFailure(reader.ReadBytes(skid.data(), skid.size()).StatusCode());
+        ReturnErrorOnFailure(reader.Read32(&offset).Read32(&length).StatusCode());
+
+        VerifyOrReturnError(length > 0 && length <= kMaxDERCertLength, CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+        VerifyOrReturnError(offset <= mBundleSize && length <= mBundleSize - offset, CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+
+        mPAAIndex.emplace(skid, bundleSpan.SubSpan(offset, length));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePath, CertificateValidationMode validationMode)
 {
     std::vector<std::vector<uint8_t>> certs;
@@ -140,7 +246,14 @@ FileAttestationTrustStore::~FileAttestationTrustStore()
 
 void FileAttestationTrustStore::Cleanup()
 {
+    mPAAIndex.clear();
     mPAADerCerts.clear();
+    if (mBundle != nullptr)
+    {
+        munmap(mBundle, mBundleSize);
+        mBundle     = nullptr;
+        mBundleSize = 0;
+    }
     mIsInitialized = false;
 }
 
@@ -154,27 +267,23 @@ CHIP_ERROR FileAttestationTrustStore::GetProductAttestationAuthorityCert(const B
         return CHIP_ERROR_NOT_IMPLEMENTED;
     }
 
-    VerifyOrReturnError(!mPAADerCerts.empty(), CHIP_ERROR_CA_CERT_NOT_FOUND);
+    VerifyOrReturnError(!mPAAIndex.empty(), CHIP_ERROR_CA_CERT_NOT_FOUND);
     VerifyOrReturnError(!skid.empty() && (skid.data() != nullptr), CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(skid.size() == Crypto::kSubjectKeyIdentifierLength, CHIP_ERROR_INVALID_ARGUMENT);
 
-    for (auto candidate : mPAADerCerts)
-    {
-        uint8_t skidBuf[Crypto::kSubjectKeyIdentifierLength] = { 0 };
-        MutableByteSpan candidateSkidSpan{ skidBuf };
-        if (CHIP_NO_ERROR != Crypto::ExtractSKIDFromX509Cert(ByteSpan{ candidate.data(), candidate.size() }, candidateSkidSpan))
-        {
-            continue;
-        }
+    SubjectKeyId key;
+    memcpy(key.data(), skid.data(), key.size());
 
-        if (skid.data_equal(candidateSkidSpan))
-        {
-            // Found a match
-            return CopySpanToMutableSpan(ByteSpan{ candidate.data(), candidate.size() }, outPaaDerBuffer);
-        }
-    }
+    auto entry = mPAAIndex.find(key);
+    VerifyOrReturnError(entry != mPAAIndex.end(), CHIP_ERROR_CA_CERT_NOT_FOUND);
+
+    // Bundle entries are indexed by the SKID recorded in the bundle; never hand out a certificate whose own SKID differs.
+    uint8_t certSkidBuf[Crypto::kSubjectKeyIdentifierLength];
+    MutableByteSpan certSkid(certSkidBuf);
+    VerifyOrReturnError(Crypto::ExtractSKIDFromX509Cert(entry->second, certSkid) == CHIP_NO_ERROR && certSkid.data_equal(skid),
+                        CHIP_ERROR_CA_CERT_NOT_FOUND);
 
-    return CHIP_ERROR_CA_CERT_NOT_FOUND;
+    return CopySpanToMutableSpan(entry->second, outPaaDerBuffer);
 }
 
 } // namespace Credentials
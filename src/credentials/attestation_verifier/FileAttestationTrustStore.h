@@ -20,6 +20,7 @@
 #include <credentials/attestation_verifier/DeviceAttestationVerifier.h>
 
 #include <array>
+#include <unordered_map>
 #include <vector>
 
 namespace chip {
@@ -49,6 +50,25 @@ enum class CertificateValidationMode
 std::vector<std::vector<uint8_t>> LoadAllX509DerCerts(const char * trustStorePath,
                                                       CertificateValidationMode validationMode = CertificateValidationMode::kPAA);
 
+/**
+ * @brief Attestation trust store backed by PAA certificates on the file system.
+ *
+ * The trust store path may either be a directory holding one X.509 DER file per PAA,
+ * or a PAA bundle file generated by `credentials/generate_paa_bundle.py`. Bundles are
+ * memory-mapped rather than copied, and carry a precomputed Subject Key Identifier
+ * for each certificate, so that loading them does not need to parse any certificate.
+ * Certificates in a bundle are validated by the tool that generates it, and are
+ * trusted as-is when loaded.
+ *
+ * In both cases a SKID-keyed hash index is built at load time, so that looking up a
+ * PAA does not depend on the number of PAAs in the store.
+ *
+ * Bundle layout (all integers are little-endian):
+ *
+ *     magic "PAAB" (4) | version (2) | reserved (2) | count (4)
+ *     count x [ SKID (20) | DER offset from start of file (4) | DER length (4) ]
+ *     DER certificates
+ */
 class FileAttestationTrustStore : public AttestationTrustStore
 {
 public:
@@ -58,14 +78,28 @@ public:
     CHIP_ERROR GetProductAttestationAuthorityCert(const ByteSpan & skid, MutableByteSpan & outPaaDerBuffer) const override;
 
     bool IsInitialized() const { return mIsInitialized; }
-    size_t paaCount() const { return mPAADerCerts.size(); };
+    size_t paaCount() const { return mPAAIndex.size(); };
 
 protected:
     std::vector<std::vector<uint8_t>> mPAADerCerts;
 
 private:
+    using SubjectKeyId = std::array<uint8_t, Crypto::kSubjectKeyIdentifierLength>;
+
+    struct SubjectKeyIdHash
+    {
+        size_t operator()(const SubjectKeyId & skid) const;
+    };
+
     bool mIsInitialized = false;
 
+    // DER of each PAA by SKID. Spans point either into mPAADerCerts or into the mapped bundle.
+    std::unordered_map<SubjectKeyId, ByteSpan, SubjectKeyIdHash> mPAAIndex;
+    void * mBundle     = nullptr;
+    size_t mBundleSize = 0;
+
+    CHIP_ERROR LoadBundle(const char * bundlePath);
+    void IndexCertificates();
     void Cleanup();
 };
 
@@ -0,0 +1,260 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Timing and memory benchmark of FileAttestationTrustStore with a
+ *      production-sized set of PAAs, loaded from a directory and from a bundle.
+ */
+
+#include <credentials/CHIPCert.h>
+#include <credentials/attestation_verifier/FileAttestationTrustStore.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <dirent.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::Crypto;
+
+namespace {
+
+constexpr size_t kPAACount      = 2000;
+constexpr size_t kLinearLookups = 10;
+
+struct BenchmarkPAA
+{
+    ByteSpan skid;
+    ByteSpan der;
+};
+
+// Writes a PAA bundle in the format produced by credentials/generate_paa_bundle.py.
+bool WriteBundle(const std::string & path, const std::vector<BenchmarkPAA> & paas)
+{
+    constexpr size_t kHeaderLength = 12;
+    constexpr size_t kEntryLength  = kSubjectKeyIdentifierLength + 8;
+
+    size_t derOffset = kHeaderLength + paas.size() * kEntryLength;
+    size_t totalSize = derOffset;
+    for (const auto & paa : paas)
+    {
+        totalSize += paa.der.size();
+    }
+
+    std::vector<uint8_t> bundle(totalSize);
+    Encoding::LittleEndian::BufferWriter writer(bundle.data(), bundle.size());
+    writer.Put("PAAB", 4).Put16(1).Put16(0).Put32(static_cast<uint32_t>(paas.size()));
+    for (const auto & paa : paas)
+    {
+        writer.Put(paa.skid.data(), paa.skid.size());
+        writer.Put32(static_cast<uint32_t>(derOffset)).Put32(static_cast<uint32_t>(paa.der.size()));
+        derOffset += paa.der.size();
+    }
+    for (const auto & paa : paas)
+    {
+        writer.Put(paa.der.data(), paa.der.size());
+    }
+    if (!writer.Fit())
+    {
+        return false;
+    }
+
+    FILE * file = fopen(path.c_str(), "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    bool written = fwrite(bundle.data(), 1, bundle.size(), file) == bundle.size();
+    fclose(file);
+    return written;
+}
+
+bool WriteFile(const std::string & path, ByteSpan contents)
+{
+    FILE * file = fopen(path.c_str(), "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    bool written = fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+    fclose(file);
+    return written;
+}
+
+std::string MakeTempDir()
+{
+    char dirTemplate[] = "/tmp/chip-paa-store-XXXXXX";
+    const char * dir   = mkdtemp(dirTemplate);
+    return (dir != nullptr) ? std::string(dir) : std::string();
+}
+
+void RemoveDir(const std::string & dirPath)
+{
+    DIR * dir = opendir(dirPath.c_str());
+    if (dir == nullptr)
+    {
+        return;
+    }
+    dirent * entry;
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        if (entry->d_name[0] != '.')
+        {
+            unlink((dirPath + "/" + entry->d_name).c_str());
+        }
+    }
+    closedir(dir);
+    rmdir(dirPath.c_str());
+}
+
+size_t ResidentMemoryKB()
+{
+#if defined(__linux__)
+    FILE * statm = fopen("/proc/self/statm", "r");
+    if (statm != nullptr)
+    {
+        unsigned long size;
+        unsigned long resident = 0;
+        int matched            = fscanf(statm, "%lu %lu", &size, &resident);
+        fclose(statm);
+        if (matched == 2)
+        {
+            return static_cast<size_t>(resident) * static_cast<size_t>(sysconf(_SC_PAGESIZE)) / 1024;
+        }
+    }
+#endif
+    return 0;
+}
+
+} // namespace
+
+class BenchmarkFileAttestationTrustStore : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(BenchmarkFileAttestationTrustStore, LookupManyPAAs)
+{
+    std::string dir = MakeTempDir();
+    ASSERT_FALSE(dir.empty());
+
+    // Generate a large trust store of distinct self-signed roots.
+    std::vector<std::vector<uint8_t>> ders;
+    std::vector<std::vector<uint8_t>> skids;
+    for (size_t i = 0; i < kPAACount; i++)
+    {
+        P256Keypair keypair;
+        ASSERT_EQ(keypair.Initialize(ECPKeyTarget::ECDSA), CHIP_NO_ERROR);
+
+        ChipDN dn;
+        ASSERT_EQ(dn.AddAttribute_MatterRCACId(i + 1), CHIP_NO_ERROR);
+        X509CertRequestParams params = { static_cast<int64_t>(i + 1), 631161876, 729942000, dn, dn };
+
+        std::vector<uint8_t> der(kMaxDERCertLength);
+        MutableByteSpan derSpan(der.data(), der.size());
+        ASSERT_EQ(NewRootX509Cert(params, keypair, derSpan), CHIP_NO_ERROR);
+        der.resize(derSpan.size());
+
+        std::vector<uint8_t> skid(kSubjectKeyIdentifierLength);
+        MutableByteSpan skidSpan(skid.data(), skid.size());
+        ASSERT_EQ(ExtractSKIDFromX509Cert(derSpan, skidSpan), CHIP_NO_ERROR);
+
+        char name[32];
+        snprintf(name, sizeof(name), "/paa-%04u.der", static_cast<unsigned>(i));
+        ASSERT_TRUE(WriteFile(dir + name, derSpan));
+
+        ders.push_back(std::move(der));
+        skids.push_back(std::move(skid));
+    }
+
+    std::vector<BenchmarkPAA> bundled;
+    for (size_t i = 0; i < kPAACount; i++)
+    {
+        bundled.push_back({ ByteSpan(skids[i].data(), skids[i].size()), ByteSpan(ders[i].data(), ders[i].size()) });
+    }
+    std::string bundlePath = dir + ".bundle";
+    ASSERT_TRUE(WriteBundle(bundlePath, bundled));
+
+    uint8_t buf[kMaxDERCertLength];
+
+    // Baseline: a linear scan over all PAAs, re-parsing each one, as done by a store without a SKID index.
+    System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    for (size_t i = 0; i < kLinearLookups; i++)
+    {
+        const auto & skid = skids[(i * 7919) % kPAACount];
+        for (const auto & candidate : ders)
+        {
+            uint8_t skidBuf[kSubjectKeyIdentifierLength];
+            MutableByteSpan candidateSkid(skidBuf);
+            ASSERT_EQ(ExtractSKIDFromX509Cert(ByteSpan(candidate.data(), candidate.size()), candidateSkid), CHIP_NO_ERROR);
+            if (candidateSkid.data_equal(ByteSpan(skid.data(), skid.size())))
+            {
+                break;
+            }
+        }
+    }
+    System::Clock::Microseconds64 linear = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+    const char * paths[] = { dir.c_str(), bundlePath.c_str() };
+    for (const char * path : paths)
+    {
+        size_t residentBefore = ResidentMemoryKB();
+        start                 = System::SystemClock().GetMonotonicMicroseconds64();
+        FileAttestationTrustStore store(path);
+        System::Clock::Microseconds64 load = System::SystemClock().GetMonotonicMicroseconds64() - start;
+        size_t residentAfter               = std::max(ResidentMemoryKB(), residentBefore);
+        EXPECT_EQ(store.paaCount(), kPAACount);
+
+        start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (size_t i = 0; i < kPAACount; i++)
+        {
+            MutableByteSpan paaSpan(buf);
+            EXPECT_EQ(store.GetProductAttestationAuthorityCert(ByteSpan(skids[i].data(), skids[i].size()), paaSpan),
+                      CHIP_NO_ERROR);
+            EXPECT_TRUE(paaSpan.data_equal(ByteSpan(ders[i].data(), ders[i].size())));
+        }
+        System::Clock::Microseconds64 indexed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+        ChipLogProgress(Crypto,
+                        "%u PAAs from %s: load %" PRIu64 " us, +%u KB resident, lookup %" PRIu64 " ns (linear %" PRIu64 " ns)",
+                        static_cast<unsigned>(kPAACount), (path == dir.c_str()) ? "directory" : "bundle", load.count(),
+                        static_cast<unsigned>(residentAfter - residentBefore), indexed.count() * 1000 / kPAACount,
+                        linear.count() * 1000 / kLinearLookups);
+    }
+
+    unlink(bundlePath.c_str());
+    RemoveDir(dir);
+}
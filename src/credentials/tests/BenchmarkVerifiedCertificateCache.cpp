@@ -0,0 +1,113 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Timing benchmark of FabricTable::VerifyCredentials with and without a
+ *      VerifiedCertificateCache.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <credentials/CHIPCert.h>
+#include <credentials/FabricTable.h>
+#include <credentials/VerifiedCertificateCache.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include "CHIPCert_test_vectors.h"
+
+#include <inttypes.h>
+
+using namespace chip;
+using namespace chip::ASN1;
+using namespace chip::Credentials;
+using namespace chip::TestCerts;
+
+namespace {
+
+constexpr BitFlags<TestCertLoadFlags> sNullLoadFlag;
+
+constexpr size_t kIterations = 200;
+
+CHIP_ERROR SetCurrentTime(ValidationContext & validContext, uint16_t year)
+{
+    ASN1UniversalTime currentTime;
+
+    currentTime.Year   = year;
+    currentTime.Month  = 1;
+    currentTime.Day    = 1;
+    currentTime.Hour   = 0;
+    currentTime.Minute = 0;
+    currentTime.Second = 0;
+
+    return validContext.SetEffectiveTimeFromAsn1Time<CurrentChipEpochTime>(currentTime);
+}
+
+} // namespace
+
+class BenchmarkVerifiedCertificateCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(BenchmarkVerifiedCertificateCache, VerifyCredentials)
+{
+    ByteSpan rcac;
+    ByteSpan icac;
+    ByteSpan noc;
+    ASSERT_EQ(GetTestCert(TestCert::kRoot01, sNullLoadFlag, rcac), CHIP_NO_ERROR);
+    ASSERT_EQ(GetTestCert(TestCert::kICA01, sNullLoadFlag, icac), CHIP_NO_ERROR);
+    ASSERT_EQ(GetTestCert(TestCert::kNode01_01, sNullLoadFlag, noc), CHIP_NO_ERROR);
+
+    VerifiedCertificateCache cache;
+    ASSERT_EQ(cache.Init(), CHIP_NO_ERROR);
+
+    System::Clock::Microseconds64 elapsed[2];
+    for (size_t useCache = 0; useCache < 2; useCache++)
+    {
+        System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            ValidationContext validContext;
+            validContext.Reset();
+            ASSERT_EQ(SetCurrentTime(validContext, 2021), CHIP_NO_ERROR);
+            validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+            validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+            if (useCache)
+            {
+                validContext.mVerifiedCertCache = &cache;
+            }
+
+            CompressedFabricId compressedFabricId;
+            FabricId fabricId;
+            NodeId nodeId;
+            Crypto::P256PublicKey nocPubkey;
+            ASSERT_EQ(
+                FabricTable::VerifyCredentials(noc, icac, rcac, validContext, compressedFabricId, fabricId, nodeId, nocPubkey),
+                CHIP_NO_ERROR);
+        }
+        elapsed[useCache] = System::SystemClock().GetMonotonicMicroseconds64() - start;
+    }
+
+    ChipLogProgress(SecureChannel, "VerifyCredentials x%u: %" PRIu64 " us without cache, %" PRIu64 " us with cache",
+                    static_cast<unsigned>(kIterations), elapsed[0].count(), elapsed[1].count());
+}
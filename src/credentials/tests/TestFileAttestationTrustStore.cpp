@@ -0,0 +1,284 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/CHIPCert.h>
+#include <credentials/attestation_verifier/FileAttestationTrustStore.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/Span.h>
+
+#include "CHIPAttCert_test_vectors.h"
+
+#include <pw_unit_test/framework.h>
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::Crypto;
+using namespace chip::TestCerts;
+
+namespace {
+
+struct TestPAA
+{
+    ByteSpan skid;
+    ByteSpan der;
+};
+
+// Writes a PAA bundle in the format produced by credentials/generate_paa_bundle.py.
+bool WriteBundle(const std::string & path, const std::vector<TestPAA> & paas)
+{
+    constexpr size_t kHeaderLength = 12;
+    constexpr size_t kEntryLength  = kSubjectKeyIdentifierLength + 8;
+
+    size_t derOffset = kHeaderLength + paas.size() * kEntryLength;
+    size_t totalSize = derOffset;
+    for (const auto & paa : paas)
+    {
+        totalSize += paa.der.size();
+    }
+
+    std::vector<uint8_t> bundle(totalSize);
+    Encoding::LittleEndian::BufferWriter writer(bundle.data(), bundle.size());
+    writer.Put("PAAB", 4).Put16(1).Put16(0).Put32(static_cast<uint32_t>(paas.size()));
+    for (const auto & paa : paas)
+    {
+        writer.Put(paa.skid.data(), paa.skid.size());
+        writer.Put32(static_cast<uint32_t>(derOffset)).Put32(static_cast<uint32_t>(paa.der.size()));
+        derOffset += paa.der.size();
+    }
+    for (const auto & paa : paas)
+    {
+        writer.Put(paa.der.data(), paa.der.size());
+    }
+    if (!writer.Fit())
+    {
+        return false;
+    }
+
+    FILE * file = fopen(path.c_str(), "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    bool written = fwrite(bundle.data(), 1, bundle.size(), file) == bundle.size();
+    fclose(file);
+    return written;
+}
+
+bool WriteFile(const std::string & path, ByteSpan contents)
+{
+    FILE * file = fopen(path.c_str(), "wb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+    bool written = fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+    fclose(file);
+    return written;
+}
+
+std::string MakeTempDir()
+{
+    char dirTemplate[] = "/tmp/chip-paa-store-XXXXXX";
+    const char * dir   = mkdtemp(dirTemplate);
+    return (dir != nullptr) ? std::string(dir) : std::string();
+}
+
+void RemoveDir(const std::string & dirPath)
+{
+    DIR * dir = opendir(dirPath.c_str());
+    if (dir == nullptr)
+    {
+        return;
+    }
+    dirent * entry;
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        if (entry->d_name[0] != '.')
+        {
+            unlink((dirPath + "/" + entry->d_name).c_str());
+        }
+    }
+    closedir(dir);
+    rmdir(dirPath.c_str());
+}
+
+void ExpectPAA(const FileAttestationTrustStore & store, const TestPAA & paa)
+{
+    uint8_t buf[kMaxDERCertLength];
+    MutableByteSpan paaSpan(buf);
+    EXPECT_EQ(store.GetProductAttestationAuthorityCert(paa.skid, paaSpan), CHIP_NO_ERROR);
+    EXPECT_TRUE(paaSpan.data_equal(paa.der));
+}
+
+const std::vector<TestPAA> kTestPAAs = {
+    { sTestCert_PAA_FFF2_ValInPast_SKID, sTestCert_PAA_FFF2_ValInPast_Cert },
+    { sTestCert_PAA_FFF2_ValInFuture_SKID, sTestCert_PAA_FFF2_ValInFuture_Cert },
+};
+
+} // namespace
+
+class TestFileAttestationTrustStore : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestFileAttestationTrustStore, TestLookupFromDirectory)
+{
+    std::string dir = MakeTempDir();
+    ASSERT_FALSE(dir.empty());
+    EXPECT_TRUE(WriteFile(dir + "/paa-past.der", sTestCert_PAA_FFF2_ValInPast_Cert));
+    EXPECT_TRUE(WriteFile(dir + "/paa-future.der", sTestCert_PAA_FFF2_ValInFuture_Cert));
+    // Duplicates and non-PAA certificates are not indexed.
+    EXPECT_TRUE(WriteFile(dir + "/paa-past-copy.der", sTestCert_PAA_FFF2_ValInPast_Cert));
+    EXPECT_TRUE(WriteFile(dir + "/pai.der", sTestCert_PAI_FFF1_8000_Cert));
+
+    FileAttestationTrustStore store(dir.c_str());
+    RemoveDir(dir);
+
+    EXPECT_TRUE(store.IsInitialized());
+    EXPECT_EQ(store.paaCount(), kTestPAAs.size());
+    for (const auto & paa : kTestPAAs)
+    {
+        ExpectPAA(store, paa);
+    }
+
+    uint8_t buf[kMaxDERCertLength];
+    MutableByteSpan paaSpan(buf);
+    EXPECT_EQ(store.GetProductAttestationAuthorityCert(sTestCert_PAI_FFF1_8000_SKID, paaSpan), CHIP_ERROR_CA_CERT_NOT_FOUND);
+    EXPECT_EQ(store.GetProductAttestationAuthorityCert(kTestPAAs[0].skid.SubSpan(1), paaSpan), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(TestFileAttestationTrustStore, TestLookupFromBundle)
+{
+    std::string dir = MakeTempDir();
+    ASSERT_FALSE(dir.empty());
+    std::string bundlePath = dir + "/paa.bundle";
+
+    {
+        ASSERT_TRUE(WriteBundle(bundlePath, kTestPAAs));
+        FileAttestationTrustStore store(bundlePath.c_str());
+        EXPECT_TRUE(store.IsInitialized());
+        EXPECT_EQ(store.paaCount(), kTestPAAs.size());
+        for (const auto & paa : kTestPAAs)
+        {
+            ExpectPAA(store, paa);
+        }
+    }
+
+    // Bundles with an unknown layout are rejected.
+    {
+        ASSERT_TRUE(WriteFile(bundlePath, sTestCert_PAA_FFF2_ValInPast_Cert));
+        FileAttestationTrustStore store(bundlePath.c_str());
+        EXPECT_FALSE(store.IsInitialized());
+        EXPECT_EQ(store.paaCount(), 0u);
+    }
+
+    // Truncated bundles are rejected as a whole.
+    {
+        ASSERT_TRUE(WriteBundle(bundlePath, kTestPAAs));
+        ASSERT_EQ(truncate(bundlePath.c_str(), 40), 0);
+        FileAttestationTrustStore store(bundlePath.c_str());
+        EXPECT_FALSE(store.IsInitialized());
+        EXPECT_EQ(store.paaCount(), 0u);
+    }
+
+    // An entry whose certificate does not have the SKID recorded for it in the bundle is never returned.
+    {
+        ASSERT_TRUE(WriteBundle(bundlePath, { { kTestPAAs[0].skid, kTestPAAs[1].der } }));
+        FileAttestationTrustStore store(bundlePath.c_str());
+        EXPECT_TRUE(store.IsInitialized());
+
+        uint8_t buf[kMaxDERCertLength];
+        MutableByteSpan paaSpan(buf);
+        EXPECT_EQ(store.GetProductAttestationAuthorityCert(kTestPAAs[0].skid, paaSpan), CHIP_ERROR_CA_CERT_NOT_FOUND);
+    }
+
+    RemoveDir(dir);
+}
+
+TEST_F(TestFileAttestationTrustStore, TestLookupManyPAAs)
+{
+    constexpr size_t kPAACount = 32;
+
+    std::string dir = MakeTempDir();
+    ASSERT_FALSE(dir.empty());
+
+    // Generate a trust store of distinct self-signed roots.
+    std::vector<std::vector<uint8_t>> ders;
+    std::vector<std::vector<uint8_t>> skids;
+    for (size_t i = 0; i < kPAACount; i++)
+    {
+        P256Keypair keypair;
+        ASSERT_EQ(keypair.Initialize(ECPKeyTarget::ECDSA), CHIP_NO_ERROR);
+
+        ChipDN dn;
+        ASSERT_EQ(dn.AddAttribute_MatterRCACId(i + 1), CHIP_NO_ERROR);
+        X509CertRequestParams params = { static_cast<int64_t>(i + 1), 631161876, 729942000, dn, dn };
+
+        std::vector<uint8_t> der(kMaxDERCertLength);
+        MutableByteSpan derSpan(der.data(), der.size());
+        ASSERT_EQ(NewRootX509Cert(params, keypair, derSpan), CHIP_NO_ERROR);
+        der.resize(derSpan.size());
+
+        std::vector<uint8_t> skid(kSubjectKeyIdentifierLength);
+        MutableByteSpan skidSpan(skid.data(), skid.size());
+        ASSERT_EQ(ExtractSKIDFromX509Cert(derSpan, skidSpan), CHIP_NO_ERROR);
+
+        char name[32];
+        snprintf(name, sizeof(name), "/paa-%02u.der", static_cast<unsigned>(i));
+        ASSERT_TRUE(WriteFile(dir + name, derSpan));
+
+        ders.push_back(std::move(der));
+        skids.push_back(std::move(skid));
+    }
+
+    std::vector<TestPAA> bundled;
+    for (size_t i = 0; i < kPAACount; i++)
+    {
+        bundled.push_back({ ByteSpan(skids[i].data(), skids[i].size()), ByteSpan(ders[i].data(), ders[i].size()) });
+    }
+    std::string bundlePath = dir + ".bundle";
+    ASSERT_TRUE(WriteBundle(bundlePath, bundled));
+
+    const char * paths[] = { dir.c_str(), bundlePath.c_str() };
+    for (const char * path : paths)
+    {
+        FileAttestationTrustStore store(path);
+        EXPECT_EQ(store.paaCount(), kPAACount);
+        for (const auto & paa : bundled)
+        {
+            ExpectPAA(store, paa);
+        }
+    }
+
+    unlink(bundlePath.c_str());
+    RemoveDir(dir);
+}
@@ -28,6 +28,7 @@
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/core/TLV.h>
 #include <lib/support/CHIPMem.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <platform/KeyValueStoreManager.h>
 
@@ -1222,6 +1223,67 @@ TEST_F(TestGroupDataProvider, TestGroupDecryption)
     it->Release();
 }
 
+TEST_F(TestGroupDataProvider, TestGroupSessionsAfterKeyChanges)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 0, kGroup1Keyset2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset1), CHIP_NO_ERROR);
+
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(kFabric2, kGroup2);
+    ASSERT_NE(nullptr, key_context);
+    const uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    auto countSessions = [provider, session_id]() {
+        GroupSession session;
+        size_t count = 0;
+        auto it      = provider->IterateGroupSessions(session_id);
+        VerifyOrReturnValue(it != nullptr, SIZE_MAX);
+        while (it->Next(session))
+        {
+            EXPECT_EQ(session.fabric_index, kFabric2);
+            EXPECT_EQ(session.group_id, kGroup2);
+            count++;
+        }
+        EXPECT_EQ(count, it->Count());
+        it->Release();
+        return count;
+    };
+
+    EXPECT_EQ(countSessions(), 1u);
+
+#if CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE >= 3
+    // Once loaded, the group session cache (which fits the 3 keys above) is used without reading storage.
+    sDelegate.AddPoisonKey(DefaultStorageKeyAllocator::GroupFabricList().KeyName());
+    EXPECT_EQ(countSessions(), 1u);
+    sDelegate.ClearPoisonKeys();
+#endif // CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE >= 3
+
+    // Removing the mapping removes the session
+    EXPECT_EQ(provider->RemoveGroupKeyAt(kFabric2, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(), 0u);
+
+    // Restoring the mapping restores it
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset1), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(), 1u);
+
+    // Removing the key set (along with its mappings) or the fabric removes it as well
+    EXPECT_EQ(provider->RemoveKeySet(kFabric2, kKeySet1.keyset_id), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(), 0u);
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 0, kGroup2Keyset1), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(), 1u);
+    EXPECT_EQ(provider->RemoveFabric(kFabric2), CHIP_NO_ERROR);
+    EXPECT_EQ(countSessions(), 0u);
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
@@ -0,0 +1,225 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <credentials/CHIPCert.h>
+#include <credentials/CHIPCertificateSet.h>
+#include <credentials/FabricTable.h>
+#include <credentials/VerifiedCertificateCache.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include "CHIPCert_test_vectors.h"
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::ASN1;
+using namespace chip::Credentials;
+using namespace chip::TestCerts;
+
+namespace {
+
+constexpr BitFlags<CertDecodeFlags> sGenTBSHashFlag(CertDecodeFlags::kGenerateTBSHash);
+constexpr BitFlags<CertDecodeFlags> sTrustAnchorFlag(CertDecodeFlags::kIsTrustAnchor);
+constexpr BitFlags<TestCertLoadFlags> sNullLoadFlag;
+
+CHIP_ERROR SetCurrentTime(ValidationContext & validContext, uint16_t year)
+{
+    ASN1UniversalTime currentTime;
+
+    currentTime.Year   = year;
+    currentTime.Month  = 1;
+    currentTime.Day    = 1;
+    currentTime.Hour   = 0;
+    currentTime.Minute = 0;
+    currentTime.Second = 0;
+
+    return validContext.SetEffectiveTimeFromAsn1Time<CurrentChipEpochTime>(currentTime);
+}
+
+// Loads Root01 <- ICA01 <- Node01_01, in that order.
+void LoadTestChain(ChipCertificateSet & certSet)
+{
+    ASSERT_EQ(certSet.Init(3), CHIP_NO_ERROR);
+    ASSERT_EQ(LoadTestCert(certSet, TestCert::kRoot01, sNullLoadFlag, sTrustAnchorFlag), CHIP_NO_ERROR);
+    ASSERT_EQ(LoadTestCert(certSet, TestCert::kICA01, sNullLoadFlag, sGenTBSHashFlag), CHIP_NO_ERROR);
+    ASSERT_EQ(LoadTestCert(certSet, TestCert::kNode01_01, sNullLoadFlag, sGenTBSHashFlag), CHIP_NO_ERROR);
+}
+
+} // namespace
+
+class TestVerifiedCertificateCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestVerifiedCertificateCache, TestContainsOnlyAddedSignatures)
+{
+    ChipCertificateSet certSet;
+    LoadTestChain(certSet);
+    const ChipCertificateData & root = certSet.GetCertSet()[0];
+    const ChipCertificateData & ica  = certSet.GetCertSet()[1];
+    const ChipCertificateData & node = certSet.GetCertSet()[2];
+
+    ValidationContext validContext;
+    validContext.Reset();
+    ASSERT_EQ(SetCurrentTime(validContext, 2021), CHIP_NO_ERROR);
+
+    VerifiedCertificateCache cache;
+
+    // Uninitialized caches never remember anything.
+    cache.Add(ica, root);
+    EXPECT_FALSE(cache.Contains(ica, root, validContext.mEffectiveTime));
+
+    ASSERT_EQ(cache.Init(), CHIP_NO_ERROR);
+    EXPECT_FALSE(cache.Contains(ica, root, validContext.mEffectiveTime));
+
+    cache.Add(ica, root);
+    EXPECT_TRUE(cache.Contains(ica, root, validContext.mEffectiveTime));
+    EXPECT_FALSE(cache.Contains(ica, node, validContext.mEffectiveTime));
+    EXPECT_FALSE(cache.Contains(node, ica, validContext.mEffectiveTime));
+
+    // Certificates without a TBS hash cannot be looked up.
+    EXPECT_FALSE(cache.Contains(root, root, validContext.mEffectiveTime));
+
+    cache.Clear();
+    EXPECT_FALSE(cache.Contains(ica, root, validContext.mEffectiveTime));
+
+    certSet.Release();
+}
+
+TEST_F(TestVerifiedCertificateCache, TestDropsExpiredCertificates)
+{
+    ChipCertificateSet certSet;
+    LoadTestChain(certSet);
+    const ChipCertificateData & root = certSet.GetCertSet()[0];
+    const ChipCertificateData & ica  = certSet.GetCertSet()[1];
+    ASSERT_NE(ica.mNotAfterTime, kNullCertTime);
+
+    VerifiedCertificateCache cache;
+    ASSERT_EQ(cache.Init(), CHIP_NO_ERROR);
+    cache.Add(ica, root);
+
+    ValidationContext validContext;
+    validContext.Reset();
+    validContext.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(ica.mNotAfterTime));
+    EXPECT_TRUE(cache.Contains(ica, root, validContext.mEffectiveTime));
+
+    validContext.SetEffectiveTime<LastKnownGoodChipEpochTime>(System::Clock::Seconds32(ica.mNotAfterTime + 1));
+    EXPECT_FALSE(cache.Contains(ica, root, validContext.mEffectiveTime));
+
+    // The entry is gone, even for a time at which the certificate is valid.
+    ASSERT_EQ(SetCurrentTime(validContext, 2021), CHIP_NO_ERROR);
+    EXPECT_FALSE(cache.Contains(ica, root, validContext.mEffectiveTime));
+
+    certSet.Release();
+}
+
+TEST_F(TestVerifiedCertificateCache, TestEvictsLeastRecentlyUsed)
+{
+    ChipCertificateSet certSet;
+    LoadTestChain(certSet);
+    const ChipCertificateData & root = certSet.GetCertSet()[0];
+
+    // Certificates that only differ by their TBS hash.
+    constexpr size_t kCertCount = CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE + 1;
+    ChipCertificateData certs[kCertCount];
+    for (size_t i = 0; i < kCertCount; i++)
+    {
+        certs[i].mCertFlags.Set(CertFlags::kTBSHashPresent);
+        certs[i].mTBSHash[0] = static_cast<uint8_t>(i);
+    }
+
+    ValidationContext validContext;
+    validContext.Reset();
+
+    VerifiedCertificateCache cache;
+    ASSERT_EQ(cache.Init(), CHIP_NO_ERROR);
+    for (size_t i = 0; i < CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE; i++)
+    {
+        cache.Add(certs[i], root);
+    }
+
+    // Use the oldest entry, so that the second oldest one is evicted instead.
+    EXPECT_TRUE(cache.Contains(certs[0], root, validContext.mEffectiveTime));
+    cache.Add(certs[kCertCount - 1], root);
+
+    EXPECT_TRUE(cache.Contains(certs[0], root, validContext.mEffectiveTime));
+    EXPECT_FALSE(cache.Contains(certs[1], root, validContext.mEffectiveTime));
+    for (size_t i = 2; i < kCertCount; i++)
+    {
+        EXPECT_TRUE(cache.Contains(certs[i], root, validContext.mEffectiveTime));
+    }
+
+    certSet.Release();
+}
+
+TEST_F(TestVerifiedCertificateCache, TestVerifyCredentialsWithCache)
+{
+    ByteSpan rcac;
+    ByteSpan icac;
+    ByteSpan noc;
+    ASSERT_EQ(GetTestCert(TestCert::kRoot01, sNullLoadFlag, rcac), CHIP_NO_ERROR);
+    ASSERT_EQ(GetTestCert(TestCert::kICA01, sNullLoadFlag, icac), CHIP_NO_ERROR);
+    ASSERT_EQ(GetTestCert(TestCert::kNode01_01, sNullLoadFlag, noc), CHIP_NO_ERROR);
+
+    VerifiedCertificateCache cache;
+    ASSERT_EQ(cache.Init(), CHIP_NO_ERROR);
+
+    // The genuine chain is accepted, both before and once its signatures are cached.
+    for (size_t i = 0; i < 2; i++)
+    {
+        ValidationContext validContext;
+        validContext.Reset();
+        ASSERT_EQ(SetCurrentTime(validContext, 2021), CHIP_NO_ERROR);
+        validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+        validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+        validContext.mVerifiedCertCache = &cache;
+
+        CompressedFabricId compressedFabricId;
+        FabricId fabricId;
+        NodeId nodeId;
+        Crypto::P256PublicKey nocPubkey;
+        EXPECT_EQ(FabricTable::VerifyCredentials(noc, icac, rcac, validContext, compressedFabricId, fabricId, nodeId, nocPubkey),
+                  CHIP_NO_ERROR);
+    }
+
+    // A chain whose ICAC signature was tampered with is not accepted, even once the genuine chain is cached.
+    uint8_t tamperedIcacBuf[kMaxCHIPCertLength];
+    ASSERT_LE(icac.size(), sizeof(tamperedIcacBuf));
+    memcpy(tamperedIcacBuf, icac.data(), icac.size());
+    // The signature is the last element of the certificate, right before the end of container.
+    tamperedIcacBuf[icac.size() - 2] ^= 0x01;
+
+    ValidationContext validContext;
+    validContext.Reset();
+    ASSERT_EQ(SetCurrentTime(validContext, 2021), CHIP_NO_ERROR);
+    validContext.mVerifiedCertCache = &cache;
+
+    CompressedFabricId compressedFabricId;
+    FabricId fabricId;
+    NodeId nodeId;
+    Crypto::P256PublicKey nocPubkey;
+    EXPECT_NE(FabricTable::VerifyCredentials(noc, ByteSpan(tamperedIcacBuf, icac.size()), rcac, validContext, compressedFabricId,
+                                             fabricId, nodeId, nocPubkey),
+              CHIP_NO_ERROR);
+}
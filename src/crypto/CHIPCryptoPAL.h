@@ -786,6 +786,60 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
                            size_t nonce_length, uint8_t * plaintext);
 
+/**
+ * @brief An AES-CCM cipher bound to one key, to encrypt or decrypt many messages with it.
+ *
+ * Encrypt and Decrypt behave as AES_CCM_encrypt and AES_CCM_decrypt, but the backend sets up its cipher
+ * context and key schedule once in Init rather than for every message. Backends that keep keys in a key
+ * store (PSA, platform implementations) simply use the key handle for every message.
+ *
+ * The key handle must outlive the cipher, or the cipher must be released first.
+ */
+class Aes128CcmCipher
+{
+public:
+    Aes128CcmCipher() = default;
+    ~Aes128CcmCipher() { Release(); }
+
+    Aes128CcmCipher(const Aes128CcmCipher &)             = delete;
+    Aes128CcmCipher & operator=(const Aes128CcmCipher &) = delete;
+
+    /**
+     * @brief Binds the cipher to a key, releasing any previously set up context.
+     *
+     * @return CHIP_ERROR_NO_MEMORY if the cipher context could not be allocated,
+     *         CHIP_ERROR_INTERNAL if the key could not be set, CHIP_NO_ERROR otherwise.
+     */
+    CHIP_ERROR Init(const Aes128KeyHandle & key);
+
+    /**
+     * @brief Releases the cipher context. The cipher must be initialized again before use.
+     */
+    void Release();
+
+    bool IsInitialized() const { return mKey != nullptr; }
+
+    /**
+     * @brief Same as AES_CCM_encrypt, with the key of the cipher.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if the cipher is not initialized, see AES_CCM_encrypt otherwise.
+     */
+    CHIP_ERROR Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length);
+
+    /**
+     * @brief Same as AES_CCM_decrypt, with the key of the cipher.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if the cipher is not initialized, see AES_CCM_decrypt otherwise.
+     */
+    CHIP_ERROR Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length, uint8_t * plaintext);
+
+private:
+    const Aes128KeyHandle * mKey = nullptr;
+    void * mContext              = nullptr; // Backend cipher context with the key set up, if any.
+};
+
 /**
  * @brief A function that implements AES-CTR encryption/decryption
  *
@@ -48,6 +48,7 @@
 #include <lib/support/BufferWriter.h>
 #include <lib/support/BytesToHex.h>
 #include <lib/support/CHIPArgParser.hpp>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/SafePointerCast.h>
@@ -146,22 +147,94 @@ static int _compareDaysAndSeconds(const int days, const int seconds)
     return 0;
 }
 
-CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
-                           const Aes128KeyHandle & key, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext,
-                           uint8_t * tag, size_t tag_length)
+namespace {
+
+#if CHIP_CRYPTO_BORINGSSL
+using AesCcmContext = EVP_AEAD_CTX;
+#else
+using AesCcmContext = EVP_CIPHER_CTX;
+#endif // CHIP_CRYPTO_BORINGSSL
+
+bool IsValidAesCcmTagLength(size_t tag_length)
+{
+#if CHIP_CRYPTO_BORINGSSL
+    return tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES;
+#else
+    return tag_length == 8 || tag_length == 12 || tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES;
+#endif // CHIP_CRYPTO_BORINGSSL
+}
+
+// Contexts of an Aes128CcmCipher, for the nonce and tag lengths used by Matter messages.
+struct AesCcmCipherContexts
+{
+    AesCcmContext * encrypt = nullptr;
+    AesCcmContext * decrypt = nullptr;
+};
+
+void FreeAesCcmContext(AesCcmContext * context)
+{
+#if CHIP_CRYPTO_BORINGSSL
+    EVP_AEAD_CTX_free(context);
+#else
+    EVP_CIPHER_CTX_free(context);
+#endif // CHIP_CRYPTO_BORINGSSL
+}
+
+/**
+ * Allocates an AES-CCM context and sets it up with key. The direction and the nonce and tag lengths
+ * are part of the key setup, so the context can only be used for messages in that direction with
+ * these lengths.
+ */
+CHIP_ERROR NewAesCcmContext(const Aes128KeyHandle & key, bool encrypt, size_t nonce_length, size_t tag_length,
+                            AesCcmContext *& outContext)
+{
+    VerifyOrReturnError(nonce_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(nonce_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(IsValidAesCcmTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
+
+#if CHIP_CRYPTO_BORINGSSL
+    // BoringSSL AEAD contexts work in both directions
+    (void) encrypt;
+    outContext = EVP_AEAD_CTX_new(EVP_aead_aes_128_ccm_matter(), key.As<Symmetric128BitsKeyByteArray>(),
+                                  sizeof(Symmetric128BitsKeyByteArray), tag_length);
+    VerifyOrReturnError(outContext != nullptr, CHIP_ERROR_NO_MEMORY);
+#else
+    EVP_CIPHER_CTX * context = EVP_CIPHER_CTX_new();
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    // Pass in cipher and direction, then nonce length and tag length (casts are safe, see above), then key
+    const int enc = encrypt ? 1 : 0;
+    bool success  = (EVP_CipherInit_ex(context, EVP_aes_128_ccm(), nullptr, nullptr, nullptr, enc) == 1) &&
+        (EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr) == 1) &&
+        (EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr) == 1) &&
+        (EVP_CipherInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), nullptr, enc) == 1);
+    if (!success)
+    {
+        EVP_CIPHER_CTX_free(context);
+        return CHIP_ERROR_INTERNAL;
+    }
+    outContext = context;
+#endif // CHIP_CRYPTO_BORINGSSL
+
+    return CHIP_NO_ERROR;
+}
+
+/**
+ * Encrypts one message with a context set up by NewAesCcmContext for encryption, with the same nonce and tag lengths.
+ */
+CHIP_ERROR AesCcmEncrypt(AesCcmContext * context, const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad,
+                         size_t aad_length, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                         size_t tag_length)
 {
 #if CHIP_CRYPTO_BORINGSSL
-    EVP_AEAD_CTX * context = nullptr;
     size_t written_tag_len = 0;
-    const EVP_AEAD * aead  = nullptr;
 #else
-    EVP_CIPHER_CTX * context = nullptr;
     int bytesWritten         = 0;
     size_t ciphertext_length = 0;
-    const EVP_CIPHER * type  = nullptr;
 #endif
-    CHIP_ERROR error = CHIP_NO_ERROR;
-    int result       = 1;
+    int result = 1;
 
     // Placeholder location for avoiding null params for plaintexts when
     // size is zero.
@@ -187,115 +260,66 @@ CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, c
         }
     }
 
-    VerifyOrExit((plaintext_length != 0) || ciphertext_was_null, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(plaintext != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(ciphertext != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(nonce != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(nonce_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(tag != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-#if CHIP_CRYPTO_BORINGSSL
-    VerifyOrExit(tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, error = CHIP_ERROR_INVALID_ARGUMENT);
-#else
-    VerifyOrExit(tag_length == 8 || tag_length == 12 || tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES,
-                              error = CHIP_ERROR_INVALID_ARGUMENT);
-#endif // CHIP_CRYPTO_BORINGSSL
+    VerifyOrReturnError((plaintext_length != 0) || ciphertext_was_null, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
 #if CHIP_CRYPTO_BORINGSSL
-    aead = EVP_aead_aes_128_ccm_matter();
-
-    context = EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
-
     result = EVP_AEAD_CTX_seal_scatter(context, ciphertext, tag, &written_tag_len, tag_length, nonce, nonce_length, plaintext,
                                        plaintext_length, nullptr, 0, aad, aad_length);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-    VerifyOrExit(written_tag_len == tag_length, error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(written_tag_len == tag_length, CHIP_ERROR_INTERNAL);
 #else
-
-    type = EVP_aes_128_ccm();
-
-    context = EVP_CIPHER_CTX_new();
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
-
-    // Pass in cipher
-    result = EVP_EncryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in nonce length.  Cast is safe because we checked with CanCastTo.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in tag length. Cast is safe because we checked against CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES.
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in key + nonce
-    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
-    result = EVP_EncryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    // Pass in nonce
+    result = EVP_EncryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
 
     // Pass in plain text length
-    VerifyOrExit(CanCastTo<int>(plaintext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(plaintext_length), CHIP_ERROR_INVALID_ARGUMENT);
     result = EVP_EncryptUpdate(context, nullptr, &bytesWritten, nullptr, static_cast<int>(plaintext_length));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
 
     // Pass in AAD
     if (aad_length > 0 && aad != nullptr)
     {
-        VerifyOrExit(CanCastTo<int>(aad_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
         result = EVP_EncryptUpdate(context, nullptr, &bytesWritten, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
-        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+        VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
     }
 
     // Encrypt
-    VerifyOrExit(CanCastTo<int>(plaintext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
     result = EVP_EncryptUpdate(context, Uint8::to_uchar(ciphertext), &bytesWritten, Uint8::to_const_uchar(plaintext),
-                                            static_cast<int>(plaintext_length));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-    VerifyOrExit((ciphertext_was_null && bytesWritten == 0) || (bytesWritten >= 0), error = CHIP_ERROR_INTERNAL);
+                               static_cast<int>(plaintext_length));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError((ciphertext_was_null && bytesWritten == 0) || (bytesWritten >= 0), CHIP_ERROR_INTERNAL);
     ciphertext_length = static_cast<unsigned int>(bytesWritten);
 
     // Finalize encryption
     result = EVP_EncryptFinal_ex(context, ciphertext + ciphertext_length, &bytesWritten);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-    VerifyOrExit(bytesWritten >= 0 && bytesWritten <= static_cast<int>(plaintext_length), error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesWritten >= 0 && bytesWritten <= static_cast<int>(plaintext_length), CHIP_ERROR_INTERNAL);
 
-    // Get tag
-    VerifyOrExit(CanCastTo<int>(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+    // Get tag. Cast is safe because the tag length was checked by NewAesCcmContext.
     result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_GET_TAG, static_cast<int>(tag_length), Uint8::to_uchar(tag));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-#endif // CHIP_CRYPTO_BORINGSSL
-
-exit:
-    if (context != nullptr)
-    {
-#if CHIP_CRYPTO_BORINGSSL
-        EVP_AEAD_CTX_free(context);
-#else
-        EVP_CIPHER_CTX_free(context);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
 #endif // CHIP_CRYPTO_BORINGSSL
-        context = nullptr;
-    }
 
-    return error;
+    return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
-                           const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
-                           size_t nonce_length, uint8_t * plaintext)
+/**
+ * Decrypts one message with a context set up by NewAesCcmContext for decryption, with the same nonce and tag lengths.
+ */
+CHIP_ERROR AesCcmDecrypt(AesCcmContext * context, const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad,
+                         size_t aad_length, const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                         uint8_t * plaintext)
 {
-#if CHIP_CRYPTO_BORINGSSL
-    EVP_AEAD_CTX * context = nullptr;
-    const EVP_AEAD * aead  = nullptr;
-#else
-
-    EVP_CIPHER_CTX * context = nullptr;
-    int bytesOutput          = 0;
-    const EVP_CIPHER * type  = nullptr;
-#endif // CHIP_CRYPTO_BORINGSSL
-    CHIP_ERROR error = CHIP_NO_ERROR;
-    int result       = 1;
+#if !CHIP_CRYPTO_BORINGSSL
+    int bytesOutput = 0;
+#endif // !CHIP_CRYPTO_BORINGSSL
+    int result = 1;
 
     // Placeholder location for avoiding null params for ciphertext when
     // size is zero.
@@ -321,94 +345,153 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
         }
     }
 
-    VerifyOrExit(ciphertext != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(plaintext != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(tag != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-#if CHIP_CRYPTO_BORINGSSL
-    VerifyOrExit(tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, error = CHIP_ERROR_INVALID_ARGUMENT);
-#else
-    VerifyOrExit(tag_length == 8 || tag_length == 12 || tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES,
-                              error = CHIP_ERROR_INVALID_ARGUMENT);
-#endif // CHIP_CRYPTO_BORINGSSL
-    VerifyOrExit(nonce != nullptr, error = CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrExit(nonce_length > 0, error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
 #if CHIP_CRYPTO_BORINGSSL
-    aead = EVP_aead_aes_128_ccm_matter();
-
-    context = EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
-
     result = EVP_AEAD_CTX_open_gather(context, plaintext, nonce, nonce_length, ciphertext, ciphertext_length, tag, tag_length, aad,
                                       aad_length);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
 #else
-    type = EVP_aes_128_ccm();
-
-    context = EVP_CIPHER_CTX_new();
-    VerifyOrExit(context != nullptr, error = CHIP_ERROR_NO_MEMORY);
-
-    // Pass in cipher
-    result = EVP_DecryptInit_ex(context, type, nullptr, nullptr, nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in nonce length
-    VerifyOrExit(CanCastTo<int>(nonce_length), error = CHIP_ERROR_INVALID_ARGUMENT);
-    result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr);
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-
-    // Pass in expected tag
+    // Pass in expected tag. Cast is safe because the tag length was checked by NewAesCcmContext.
     // Removing "const" from |tag| here should hopefully be safe as
     // we're writing the tag, not reading.
-    VerifyOrExit(CanCastTo<int>(tag_length), error = CHIP_ERROR_INVALID_ARGUMENT);
     result = EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
-                                              const_cast<void *>(static_cast<const void *>(tag)));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+                                 const_cast<void *>(static_cast<const void *>(tag)));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
 
-    // Pass in key + nonce
-    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
-    result = EVP_DecryptInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), Uint8::to_const_uchar(nonce));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    // Pass in nonce
+    result = EVP_DecryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce));
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
 
     // Pass in cipher text length
-    VerifyOrExit(CanCastTo<int>(ciphertext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(ciphertext_length), CHIP_ERROR_INVALID_ARGUMENT);
     result = EVP_DecryptUpdate(context, nullptr, &bytesOutput, nullptr, static_cast<int>(ciphertext_length));
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-    VerifyOrExit(bytesOutput <= static_cast<int>(ciphertext_length), error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesOutput <= static_cast<int>(ciphertext_length), CHIP_ERROR_INTERNAL);
 
     // Pass in aad
     if (aad_length > 0 && aad != nullptr)
     {
-        VerifyOrExit(CanCastTo<int>(aad_length), error = CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
         result = EVP_DecryptUpdate(context, nullptr, &bytesOutput, Uint8::to_const_uchar(aad), static_cast<int>(aad_length));
-        VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
-        VerifyOrExit(bytesOutput <= static_cast<int>(aad_length), error = CHIP_ERROR_INTERNAL);
+        VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
+        VerifyOrReturnError(bytesOutput <= static_cast<int>(aad_length), CHIP_ERROR_INTERNAL);
     }
 
     // Pass in ciphertext. We wont get anything if validation fails.
-    VerifyOrExit(CanCastTo<int>(ciphertext_length), error = CHIP_ERROR_INVALID_ARGUMENT);
     result = EVP_DecryptUpdate(context, Uint8::to_uchar(plaintext), &bytesOutput, Uint8::to_const_uchar(ciphertext),
-                                            static_cast<int>(ciphertext_length));
+                               static_cast<int>(ciphertext_length));
     if (plaintext_was_null)
     {
-        VerifyOrExit(bytesOutput <= static_cast<int>(sizeof(placeholder_plaintext)), error = CHIP_ERROR_INTERNAL);
+        VerifyOrReturnError(bytesOutput <= static_cast<int>(sizeof(placeholder_plaintext)), CHIP_ERROR_INTERNAL);
     }
-    VerifyOrExit(result == 1, error = CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(result == 1, CHIP_ERROR_INTERNAL);
 #endif // CHIP_CRYPTO_BORINGSSL
 
-exit:
-    if (context != nullptr)
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+CHIP_ERROR AES_CCM_encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                           const Aes128KeyHandle & key, const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext,
+                           uint8_t * tag, size_t tag_length)
+{
+    AesCcmContext * context = nullptr;
+    ReturnErrorOnFailure(NewAesCcmContext(key, true, nonce_length, tag_length, context));
+
+    CHIP_ERROR error =
+        AesCcmEncrypt(context, plaintext, plaintext_length, aad, aad_length, nonce, nonce_length, ciphertext, tag, tag_length);
+
+    FreeAesCcmContext(context);
+    return error;
+}
+
+CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                           const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
+                           size_t nonce_length, uint8_t * plaintext)
+{
+    AesCcmContext * context = nullptr;
+    ReturnErrorOnFailure(NewAesCcmContext(key, false, nonce_length, tag_length, context));
+
+    CHIP_ERROR error =
+        AesCcmDecrypt(context, ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, nonce, nonce_length, plaintext);
+
+    FreeAesCcmContext(context);
+    return error;
+}
+
+CHIP_ERROR Aes128CcmCipher::Init(const Aes128KeyHandle & key)
+{
+    Release();
+
+    // The contexts for each direction are only set up when first used, as a session key is
+    // typically used in one direction only.
+    AesCcmCipherContexts * contexts = Platform::New<AesCcmCipherContexts>();
+    VerifyOrReturnError(contexts != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    mContext = contexts;
+    mKey     = &key;
+    return CHIP_NO_ERROR;
+}
+
+void Aes128CcmCipher::Release()
+{
+    if (mContext != nullptr)
     {
-#if CHIP_CRYPTO_BORINGSSL
-        EVP_AEAD_CTX_free(context);
-#else
-        EVP_CIPHER_CTX_free(context);
-#endif // CHIP_CRYPTO_BORINGSSL
+        AesCcmCipherContexts * contexts = static_cast<AesCcmCipherContexts *>(mContext);
+        FreeAesCcmContext(contexts->encrypt);
+        FreeAesCcmContext(contexts->decrypt);
+        Platform::Delete(contexts);
+        mContext = nullptr;
+    }
+    mKey = nullptr;
+}
 
-        context = nullptr;
+CHIP_ERROR Aes128CcmCipher::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                    const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                    size_t tag_length)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    if ((nonce_length != kAES_CCM128_Nonce_Length) || (tag_length != kAES_CCM128_Tag_Length))
+    {
+        return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, *mKey, nonce, nonce_length, ciphertext, tag,
+                               tag_length);
     }
 
-    return error;
+    AesCcmContext *& context = static_cast<AesCcmCipherContexts *>(mContext)->encrypt;
+    if (context == nullptr)
+    {
+        ReturnErrorOnFailure(NewAesCcmContext(*mKey, true, kAES_CCM128_Nonce_Length, kAES_CCM128_Tag_Length, context));
+    }
+
+    return AesCcmEncrypt(context, plaintext, plaintext_length, aad, aad_length, nonce, nonce_length, ciphertext, tag, tag_length);
+}
+
+CHIP_ERROR Aes128CcmCipher::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                    const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                    uint8_t * plaintext)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    if ((nonce_length != kAES_CCM128_Nonce_Length) || (tag_length != kAES_CCM128_Tag_Length))
+    {
+        return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, *mKey, nonce, nonce_length,
+                               plaintext);
+    }
+
+    AesCcmContext *& context = static_cast<AesCcmCipherContexts *>(mContext)->decrypt;
+    if (context == nullptr)
+    {
+        ReturnErrorOnFailure(NewAesCcmContext(*mKey, false, kAES_CCM128_Nonce_Length, kAES_CCM128_Tag_Length, context));
+    }
+
+    return AesCcmDecrypt(context, ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, nonce, nonce_length,
+                         plaintext);
 }
 
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
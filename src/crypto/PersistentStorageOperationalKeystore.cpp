@@ -27,6 +27,8 @@
 
 #include "PersistentStorageOperationalKeystore.h"
 
+#include <mutex>
+
 namespace chip {
 
 using namespace chip::Crypto;
@@ -175,9 +177,12 @@ bool PersistentStorageOperationalKeystore::HasOpKeypairForFabric(FabricIndex fab
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex), false);
 
     // If there was a pending keypair, then there's really a usable key
-    if (mIsPendingKeypairActive && (fabricIndex == mPendingFabricIndex) && (mPendingKeypair != nullptr))
     {
-        return true;
+        std::lock_guard<System::Mutex> lock(mLock);
+        if (mIsPendingKeypairActive && (fabricIndex == mPendingFabricIndex) && (mPendingKeypair != nullptr))
+        {
+            return true;
+        }
     }
 
     // TODO(#16958): need to actually read the key to know if it's there due to platforms not
@@ -199,6 +204,7 @@ CHIP_ERROR PersistentStorageOperationalKeystore::NewOpKeypairForFabric(FabricInd
 {
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex), CHIP_ERROR_INVALID_FABRIC_INDEX);
+    std::lock_guard<System::Mutex> lock(mLock);
     // If a key is pending, we cannot generate for a different fabric index until we commit or revert.
     if ((mPendingFabricIndex != kUndefinedFabricIndex) && (fabricIndex != mPendingFabricIndex))
     {
@@ -231,6 +237,7 @@ CHIP_ERROR PersistentStorageOperationalKeystore::ActivateOpKeypairForFabric(Fabr
                                                                             const Crypto::P256PublicKey & nocPublicKey)
 {
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    std::lock_guard<System::Mutex> lock(mLock);
     VerifyOrReturnError(mPendingKeypair != nullptr, CHIP_ERROR_INVALID_FABRIC_INDEX);
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex) && (fabricIndex == mPendingFabricIndex), CHIP_ERROR_INVALID_FABRIC_INDEX);
 
@@ -245,6 +252,7 @@ CHIP_ERROR PersistentStorageOperationalKeystore::ActivateOpKeypairForFabric(Fabr
 CHIP_ERROR PersistentStorageOperationalKeystore::CommitOpKeypairForFabric(FabricIndex fabricIndex)
 {
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    std::lock_guard<System::Mutex> lock(mLock);
     VerifyOrReturnError(mPendingKeypair != nullptr, CHIP_ERROR_INVALID_FABRIC_INDEX);
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex) && (fabricIndex == mPendingFabricIndex), CHIP_ERROR_INVALID_FABRIC_INDEX);
     VerifyOrReturnError(mIsPendingKeypairActive == true, CHIP_ERROR_INCORRECT_STATE);
@@ -271,9 +279,12 @@ CHIP_ERROR PersistentStorageOperationalKeystore::RemoveOpKeypairForFabric(Fabric
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex), CHIP_ERROR_INVALID_FABRIC_INDEX);
 
     // Remove pending state if matching
-    if ((mPendingKeypair != nullptr) && (fabricIndex == mPendingFabricIndex))
     {
-        RevertPendingKeypair();
+        std::lock_guard<System::Mutex> lock(mLock);
+        if ((mPendingKeypair != nullptr) && (fabricIndex == mPendingFabricIndex))
+        {
+            ResetPendingKey();
+        }
     }
 
     CHIP_ERROR err = mStorage->SyncDeleteKeyValue(DefaultStorageKeyAllocator::FabricOpKey(fabricIndex).KeyName());
@@ -290,6 +301,7 @@ void PersistentStorageOperationalKeystore::RevertPendingKeypair()
     VerifyOrReturn(mStorage != nullptr);
 
     // Just reset the pending key, we never stored anything
+    std::lock_guard<System::Mutex> lock(mLock);
     ResetPendingKey();
 }
 
@@ -299,13 +311,18 @@ CHIP_ERROR PersistentStorageOperationalKeystore::SignWithOpKeypair(FabricIndex f
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(IsValidFabricIndex(fabricIndex), CHIP_ERROR_INVALID_FABRIC_INDEX);
 
-    if (mIsPendingKeypairActive && (fabricIndex == mPendingFabricIndex))
     {
-        VerifyOrReturnError(mPendingKeypair != nullptr, CHIP_ERROR_INTERNAL);
-        // We have an override key: sign with it!
-        return mPendingKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
+        // The pending keypair may be committed or reverted by the Matter thread while signing in the background.
+        std::lock_guard<System::Mutex> lock(mLock);
+        if (mIsPendingKeypairActive && (fabricIndex == mPendingFabricIndex))
+        {
+            VerifyOrReturnError(mPendingKeypair != nullptr, CHIP_ERROR_INTERNAL);
+            // We have an override key: sign with it!
+            return mPendingKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
+        }
     }
 
+    // The stored key is signed with outside of the lock, so that background signatures may run in parallel.
     return SignWithStoredOpKey(fabricIndex, mStorage, message, outSignature);
 }
 
@@ -23,6 +23,7 @@
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
+#include <system/SystemMutex.h>
 
 namespace chip {
 
@@ -56,6 +57,11 @@ public:
     CHIP_ERROR Init(PersistentStorageDelegate * storage)
     {
         VerifyOrReturnError(mStorage == nullptr, CHIP_ERROR_INCORRECT_STATE);
+        if (!mLockInitialized)
+        {
+            ReturnErrorOnFailure(System::Mutex::Init(mLock));
+            mLockInitialized = true;
+        }
         mPendingFabricIndex       = kUndefinedFabricIndex;
         mIsExternallyOwnedKeypair = false;
         mStorage                  = storage;
@@ -71,10 +77,26 @@ public:
     {
         VerifyOrReturn(mStorage != nullptr);
 
+        mLock.Lock();
         ResetPendingKey();
+        mLock.Unlock();
         mStorage = nullptr;
     }
 
+    /**
+     * @brief Allow `CASESession` to call `SignWithOpKeypair` from a background task.
+     *
+     * Signing reads the operational key from the storage delegate, so only enable this
+     * if that delegate may be read from another thread while the Matter thread uses it
+     * (e.g. the Linux KeyValueStoreManager, which takes its own lock). The pending
+     * keypair is protected by this keystore.
+     *
+     * @param supported true to allow signing in the background
+     */
+    void SetSupportsSignWithOpKeypairInBackground(bool supported) { mSupportsSignInBackground = supported; }
+
+    bool SupportsSignWithOpKeypairInBackground() const override { return mSupportsSignInBackground; }
+
     bool HasPendingOpKeypair() const override { return (mPendingKeypair != nullptr); }
 
     bool HasOpKeypairForFabric(FabricIndex fabricIndex) const override;
@@ -113,6 +135,11 @@ protected:
     // If overridding NewOpKeypairForFabric method in a subclass, set this to true in
     // `NewOpKeypairForFabric` if the mPendingKeypair should not be deleted when no longer in use.
     bool mIsExternallyOwnedKeypair = false;
+
+    // Guards the pending keypair state against `SignWithOpKeypair` calls from background tasks.
+    mutable System::Mutex mLock;
+    bool mLockInitialized          = false;
+    bool mSupportsSignInBackground = false;
 };
 
 } // namespace chip
@@ -0,0 +1,128 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <string.h>
+
+#if CHIP_CRYPTO_PSA
+#include <psa/crypto.h>
+#endif
+
+using namespace chip;
+using namespace chip::Crypto;
+
+namespace {
+
+struct TestAesKey
+{
+public:
+    TestAesKey(const uint8_t * keyBytes, size_t keyLength)
+    {
+        Crypto::Symmetric128BitsKeyByteArray keyMaterial;
+        memcpy(&keyMaterial, keyBytes, keyLength);
+
+        CHIP_ERROR err = keystore.CreateKey(keyMaterial, key);
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+    }
+
+    ~TestAesKey() { keystore.DestroyKey(key); }
+
+    DefaultSessionKeystore keystore;
+    Aes128KeyHandle key;
+};
+
+struct BenchmarkChipCryptoPAL : public ::testing::Test
+{
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+#if CHIP_CRYPTO_PSA
+        psa_crypto_init();
+#endif
+    }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+/**
+ * Compares the throughput of AES_CCM_encrypt / AES_CCM_decrypt, which set up the cipher for every message,
+ * with the one of an Aes128CcmCipher set up once, for a few message sizes. The results are only logged.
+ */
+TEST_F(BenchmarkChipCryptoPAL, AES_CCM_128CipherThroughput)
+{
+    constexpr size_t kMessageSizes[] = { 16, 64, 256, 1024 };
+    constexpr uint32_t kIterations   = 256;
+    constexpr size_t kTagLength      = kAES_CCM128_Tag_Length;
+
+    const uint8_t keyBytes[CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES] = { 0x5e, 0xde, 0xd2, 0x44, 0xe5, 0x53, 0x2b, 0x3c,
+                                                                       0xdc, 0x23, 0x40, 0x9d, 0xba, 0xd0, 0x52, 0xd2 };
+    const uint8_t nonce[kAES_CCM128_Nonce_Length]                  = { 0 };
+    const uint8_t aad[8]                                           = { 0 };
+    uint8_t tag[kTagLength];
+
+    TestAesKey key(keyBytes, sizeof(keyBytes));
+    Aes128CcmCipher cipher;
+    ASSERT_EQ(cipher.Init(key.key), CHIP_NO_ERROR);
+
+    chip::Platform::ScopedMemoryBuffer<uint8_t> plaintext;
+    chip::Platform::ScopedMemoryBuffer<uint8_t> ciphertext;
+    ASSERT_TRUE(plaintext.Calloc(kMessageSizes[ArraySize(kMessageSizes) - 1]));
+    ASSERT_TRUE(ciphertext.Calloc(kMessageSizes[ArraySize(kMessageSizes) - 1]));
+
+    for (size_t size : kMessageSizes)
+    {
+        uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (uint32_t i = 0; i < kIterations; i++)
+        {
+            ASSERT_EQ(AES_CCM_encrypt(plaintext.Get(), size, aad, sizeof(aad), key.key, nonce, sizeof(nonce), ciphertext.Get(),
+                                      tag, kTagLength),
+                      CHIP_NO_ERROR);
+            ASSERT_EQ(AES_CCM_decrypt(ciphertext.Get(), size, aad, sizeof(aad), tag, kTagLength, key.key, nonce, sizeof(nonce),
+                                      plaintext.Get()),
+                      CHIP_NO_ERROR);
+        }
+        const uint64_t oneShotMicros = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+
+        start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (uint32_t i = 0; i < kIterations; i++)
+        {
+            ASSERT_EQ(
+                cipher.Encrypt(plaintext.Get(), size, aad, sizeof(aad), nonce, sizeof(nonce), ciphertext.Get(), tag, kTagLength),
+                CHIP_NO_ERROR);
+            ASSERT_EQ(
+                cipher.Decrypt(ciphertext.Get(), size, aad, sizeof(aad), tag, kTagLength, nonce, sizeof(nonce), plaintext.Get()),
+                CHIP_NO_ERROR);
+        }
+        const uint64_t cachedMicros = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+
+        ChipLogProgress(Crypto, "AES-CCM %4u byte messages, encrypt + decrypt: one-shot %" PRIu64 "us, cipher %" PRIu64 "us (x%u)",
+                        static_cast<unsigned>(size), oneShotMicros, cachedMicros, static_cast<unsigned>(kIterations));
+    }
+}
+
+} // namespace
@@ -476,6 +476,66 @@ TEST_F(TestChipCryptoPAL, TestAES_CCM_128DecryptInvalidNonceLen)
     EXPECT_GT(numOfTestsRan, 0);
 }
 
+TEST_F(TestChipCryptoPAL, TestAES_CCM_128CipherTestVectors)
+{
+    HeapChecker heapChecker;
+    int numOfTestVectors = ArraySize(ccm_128_test_vectors);
+    int numOfTestsRan    = 0;
+    for (int vectorIndex = 0; vectorIndex < numOfTestVectors; vectorIndex++)
+    {
+        const ccm_128_test_vector * vector = ccm_128_test_vectors[vectorIndex];
+        if (vector->pt_len > 0)
+        {
+            numOfTestsRan++;
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_ct;
+            out_ct.Alloc(vector->ct_len);
+            EXPECT_TRUE(out_ct);
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_tag;
+            out_tag.Alloc(vector->tag_len);
+            EXPECT_TRUE(out_tag);
+            chip::Platform::ScopedMemoryBuffer<uint8_t> out_pt;
+            out_pt.Alloc(vector->pt_len);
+            EXPECT_TRUE(out_pt);
+
+            TestAesKey key(vector->key, vector->key_len);
+            Aes128CcmCipher cipher;
+            EXPECT_EQ(cipher.Init(key.key), CHIP_NO_ERROR);
+
+            // A failed authentication must not break the following operations.
+            uint8_t bad_tag[kAES_CCM128_Tag_Length];
+            memcpy(bad_tag, vector->tag, vector->tag_len);
+            bad_tag[0] ^= 0x01;
+            CHIP_ERROR err = cipher.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, bad_tag, vector->tag_len,
+                                            vector->nonce, vector->nonce_len, out_pt.Get());
+            EXPECT_NE(err, CHIP_NO_ERROR);
+
+            err = cipher.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce, vector->nonce_len,
+                                 out_ct.Get(), out_tag.Get(), vector->tag_len);
+            EXPECT_EQ(err, vector->result);
+            if (vector->result == CHIP_NO_ERROR)
+            {
+                EXPECT_EQ(memcmp(out_ct.Get(), vector->ct, vector->ct_len), 0);
+                EXPECT_EQ(memcmp(out_tag.Get(), vector->tag, vector->tag_len), 0);
+            }
+
+            err = cipher.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                 vector->nonce, vector->nonce_len, out_pt.Get());
+            EXPECT_EQ(err, vector->result);
+            if (vector->result == CHIP_NO_ERROR)
+            {
+                EXPECT_EQ(memcmp(out_pt.Get(), vector->pt, vector->pt_len), 0);
+            }
+
+            cipher.Release();
+            EXPECT_FALSE(cipher.IsInitialized());
+            err = cipher.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce, vector->nonce_len,
+                                 out_ct.Get(), out_tag.Get(), vector->tag_len);
+            EXPECT_EQ(err, CHIP_ERROR_INCORRECT_STATE);
+        }
+    }
+    EXPECT_GT(numOfTestsRan, 0);
+}
+
 TEST_F(TestChipCryptoPAL, TestSensitiveDataBuffer)
 {
     HeapChecker heapChecker;
@@ -29,6 +29,11 @@
 #include <lib/support/Span.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
+#include <thread>
+#endif
+
 using namespace chip;
 using namespace chip::Crypto;
 
@@ -304,6 +309,76 @@ TEST_F(TestPersistentStorageOpKeyStore, TestBasicLifeCycle)
     opKeystore.Finish();
 }
 
+TEST_F(TestPersistentStorageOpKeyStore, TestSignInBackground)
+{
+    TestPersistentStorageDelegate storageDelegate;
+    PersistentStorageOperationalKeystore opKeystore;
+
+    // Background signing is opt-in, since it depends on the storage delegate.
+    EXPECT_FALSE(opKeystore.SupportsSignWithOpKeypairInBackground());
+    opKeystore.SetSupportsSignWithOpKeypairInBackground(true);
+    EXPECT_TRUE(opKeystore.SupportsSignWithOpKeypairInBackground());
+
+    ASSERT_EQ(opKeystore.Init(&storageDelegate), CHIP_NO_ERROR);
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    constexpr FabricIndex kFabricIndex = 111;
+    const uint8_t message[]            = { 1, 2, 3, 4 };
+
+    // Sign from another thread while the pending keypair is replaced and reverted, as when a CASE
+    // session is established on a fabric that is being commissioned.
+    std::atomic<bool> done{ false };
+    std::atomic<size_t> signatureCount{ 0 };
+    std::atomic<size_t> unexpectedErrorCount{ 0 };
+    std::thread signer([&]() {
+        while (!done)
+        {
+            P256ECDSASignature signature;
+            CHIP_ERROR err = opKeystore.SignWithOpKeypair(kFabricIndex, ByteSpan{ message }, signature);
+            if (err == CHIP_NO_ERROR)
+            {
+                signatureCount++;
+            }
+            else if (err != CHIP_ERROR_INVALID_FABRIC_INDEX)
+            {
+                unexpectedErrorCount++;
+            }
+        }
+    });
+
+    for (int i = 0; i < 20; i++)
+    {
+        uint8_t csrBuf[kMIN_CSR_Buffer_Size];
+        MutableByteSpan csrSpan{ csrBuf };
+        P256PublicKey csrPublicKey;
+        bool activated = (opKeystore.NewOpKeypairForFabric(kFabricIndex, csrSpan) == CHIP_NO_ERROR) &&
+            (VerifyCertificateSigningRequest(csrSpan.data(), csrSpan.size(), csrPublicKey) == CHIP_NO_ERROR) &&
+            (opKeystore.ActivateOpKeypairForFabric(kFabricIndex, csrPublicKey) == CHIP_NO_ERROR);
+        EXPECT_TRUE(activated);
+        if (!activated)
+        {
+            break;
+        }
+
+        // Give the signer a chance to use the active pending keypair before it goes away.
+        for (size_t startCount = signatureCount; signatureCount == startCount;)
+        {
+            std::this_thread::yield();
+        }
+        opKeystore.RevertPendingKeypair();
+    }
+
+    done = true;
+    signer.join();
+
+    EXPECT_GE(signatureCount.load(), 20u);
+    EXPECT_EQ(unexpectedErrorCount.load(), 0u);
+    EXPECT_EQ(storageDelegate.GetNumKeys(), 0u);
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    opKeystore.Finish();
+}
+
 TEST_F(TestPersistentStorageOpKeyStore, TestEphemeralKeys)
 {
     chip::TestPersistentStorageDelegate storage;
@@ -40,8 +40,13 @@
 #include <fcntl.h>
 #include <poll.h>
 #include <sched.h>
+#include <string.h>
 #include <unistd.h>
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING && CHIP_SYSTEM_CONFIG_USE_LIBEV
+#error "Background event processing posts events from other threads, which is not supported with libev"
+#endif
+
 namespace chip {
 namespace DeviceLayer {
 namespace Internal {
@@ -72,6 +77,10 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_InitChipStack()
     VerifyOrReturnError(ret == 0, CHIP_ERROR_POSIX(ret));
 #endif
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    ReturnErrorOnFailure(Impl()->StartBackgroundEventLoopTask());
+#endif
+
     return CHIP_NO_ERROR;
 }
 
@@ -383,6 +392,118 @@ exit:
 #endif // CHIP_SYSTEM_CONFIG_USE_LIBEV
 }
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostBackgroundEvent(const ChipDeviceEvent * event)
+{
+    VerifyOrReturnError(event->Type == DeviceEventType::kCallWorkFunct || event->Type == DeviceEventType::kNoOp,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    pthread_mutex_lock(&mBackgroundEventLock);
+    const bool running = mShouldRunBackgroundEventLoop;
+    if (running)
+    {
+        mBackgroundEventQueue.push(*event);
+        pthread_cond_signal(&mBackgroundEventCond);
+    }
+    pthread_mutex_unlock(&mBackgroundEventLock);
+
+    // Without background tasks, use the foreground event loop for background events
+    return running ? CHIP_NO_ERROR : _PostEvent(event);
+}
+
+template <class ImplClass>
+void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunBackgroundEventLoop()
+{
+    pthread_mutex_lock(&mBackgroundEventLock);
+    while (mShouldRunBackgroundEventLoop)
+    {
+        if (mBackgroundEventQueue.empty())
+        {
+            pthread_cond_wait(&mBackgroundEventCond, &mBackgroundEventLock);
+            continue;
+        }
+
+        const ChipDeviceEvent event = mBackgroundEventQueue.front();
+        mBackgroundEventQueue.pop();
+
+        // Dispatch without holding the lock, so that the other tasks can process events meanwhile.
+        pthread_mutex_unlock(&mBackgroundEventLock);
+        Impl()->DispatchEvent(&event);
+        pthread_mutex_lock(&mBackgroundEventLock);
+    }
+    pthread_mutex_unlock(&mBackgroundEventLock);
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartBackgroundEventLoopTask()
+{
+    pthread_mutex_lock(&mBackgroundEventLock);
+    const bool alreadyRunning     = mShouldRunBackgroundEventLoop;
+    mShouldRunBackgroundEventLoop = true;
+    pthread_mutex_unlock(&mBackgroundEventLock);
+
+    if (alreadyRunning)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    int err = 0;
+    while (mBackgroundEventLoopTaskCount < ArraySize(mBackgroundEventLoopTasks))
+    {
+        err = pthread_create(&mBackgroundEventLoopTasks[mBackgroundEventLoopTaskCount], nullptr, BackgroundEventLoopTaskMain, this);
+        if (err != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to start background task: %s", strerror(err));
+            Impl()->StopBackgroundEventLoopTask();
+            break;
+        }
+        mBackgroundEventLoopTaskCount++;
+    }
+
+    return CHIP_ERROR_POSIX(err);
+}
+
+template <class ImplClass>
+CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StopBackgroundEventLoopTask()
+{
+    std::queue<ChipDeviceEvent> pendingEvents;
+
+    pthread_mutex_lock(&mBackgroundEventLock);
+    mShouldRunBackgroundEventLoop = false;
+    pendingEvents.swap(mBackgroundEventQueue);
+    pthread_cond_broadcast(&mBackgroundEventCond);
+    pthread_mutex_unlock(&mBackgroundEventLock);
+
+    // Wait for the events being processed, which must not stop the tasks themselves.
+    int err = 0;
+    while (mBackgroundEventLoopTaskCount > 0)
+    {
+        mBackgroundEventLoopTaskCount--;
+        int joinErr = pthread_join(mBackgroundEventLoopTasks[mBackgroundEventLoopTaskCount], nullptr);
+        err         = (err != 0) ? err : joinErr;
+    }
+
+    // Run the work that was still queued rather than dropping it: its owner may only release its
+    // resources from the work function (e.g. a CASE session waiting for its Sigma2 work to complete).
+    while (!pendingEvents.empty())
+    {
+        Impl()->DispatchEvent(&pendingEvents.front());
+        pendingEvents.pop();
+    }
+
+    return CHIP_ERROR_POSIX(err);
+}
+
+template <class ImplClass>
+void * GenericPlatformManagerImpl_POSIX<ImplClass>::BackgroundEventLoopTaskMain(void * arg)
+{
+    ChipLogDetail(DeviceLayer, "CHIP background task running");
+    static_cast<GenericPlatformManagerImpl_POSIX<ImplClass> *>(arg)->Impl()->RunBackgroundEventLoop();
+    return nullptr;
+}
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
 {
@@ -393,6 +514,10 @@ void GenericPlatformManagerImpl_POSIX<ImplClass>::_Shutdown()
     //
     VerifyOrDie(mState.load(std::memory_order_relaxed) == State::kStopped);
 
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    Impl()->StopBackgroundEventLoopTask();
+#endif
+
 #if !CHIP_SYSTEM_CONFIG_USE_LIBEV
     pthread_mutex_destroy(&mStateLock);
     pthread_cond_destroy(&mEventQueueStoppedCond);
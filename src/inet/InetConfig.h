@@ -272,6 +272,26 @@
 #endif
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE
+ *
+ *  @brief
+ *    Maximum number of datagrams that the socket-based implementation of UDP
+ *    endpoints reads per readiness event.
+ *
+ *  @details
+ *    Values greater than 1 make UDP endpoints drain up to this many pending
+ *    datagrams with a single recvmmsg() call and dispatch them together, so
+ *    that a burst of packets does not cost one event loop wakeup per packet.
+ *    A packet buffer is allocated for each slot before every read, and each
+ *    slot also takes close to 500 bytes of stack (I/O vector, source address,
+ *    control data and message header), so keep this small. This is only
+ *    supported on Linux; other platforms always read one datagram.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE 1
+#endif // INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE
+
 /**
  *  @def HAVE_SO_BINDTODEVICE
  *
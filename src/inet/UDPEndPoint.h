@@ -214,6 +214,10 @@ public:
      *  If \c pktInfo contains an interface id, the message will be sent over the specified interface.
      *  If \c pktInfo contains a source address, the given address will be used as the source of the UDP message.
      *
+     *  On sockets, a chain of packet buffers is sent as a single datagram without being flattened first. Only
+     *  direct users of the Inet layer benefit from this: Matter messages are always a single buffer, since
+     *  SecureMessageCodec encrypts in place and SessionManager and TransportMgrBase reject chained buffers.
+     *
      * @param[in]   pktInfo     Source and destination information for the UDP message.
      * @param[in]   msg         Packet buffer containing the UDP message.
      *
@@ -29,6 +29,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemStats.h>
 
 #if CHIP_SYSTEM_CONFIG_USE_POSIX_SOCKETS
 #if HAVE_SYS_SOCKET_H
@@ -86,11 +87,21 @@
     "Neither IPV6_DROP_MEMBERSHIP nor IPV6_LEAVE_GROUP are defined which are required for generalized IPv6 multicast group support."
 #endif // IPV6_DROP_MEMBERSHIP
 
+// Batched receive uses recvmmsg, which is Linux specific.
+#if INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE > 1 && defined(__linux__) && CHIP_SYSTEM_CONFIG_USE_POSIX_SOCKETS
+#define INET_UDP_SOCKET_RECEIVE_BATCH 1
+#else
+#define INET_UDP_SOCKET_RECEIVE_BATCH 0
+#endif
+
 namespace chip {
 namespace Inet {
 
 namespace {
 
+// Maximum number of buffers of a PacketBuffer chain that SendMsgImpl gathers into a single datagram.
+constexpr size_t kMaxSendBuffers = 8;
+
 CHIP_ERROR IPv6Bind(int socket, const IPAddress & address, uint16_t port, InterfaceId interface)
 {
     struct sockaddr_in6 sa;
@@ -293,12 +304,21 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     // Ensure the destination address type is compatible with the endpoint address type.
     VerifyOrReturnError(mAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
 
-    // For now the entire message must fit within a single buffer.
-    VerifyOrReturnError(!msg->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
-
-    struct iovec msgIOV;
-    msgIOV.iov_base = msg->Start();
-    msgIOV.iov_len  = msg->DataLength();
+    // Gather the buffers of a chained message directly rather than flattening it first. Messages from the
+    // Matter transports are never chained (see UDPEndPoint::SendMsg), so they always take a single iovec.
+    struct iovec msgIOV[kMaxSendBuffers];
+    size_t msgIOVLen = 0;
+    for (System::PacketBufferHandle buf = msg.Retain(); !buf.IsNull(); buf.Advance())
+    {
+        if (buf->DataLength() == 0)
+        {
+            continue;
+        }
+        VerifyOrReturnError(msgIOVLen < kMaxSendBuffers, CHIP_ERROR_MESSAGE_TOO_LONG);
+        msgIOV[msgIOVLen].iov_base = buf->Start();
+        msgIOV[msgIOVLen].iov_len  = buf->DataLength();
+        msgIOVLen++;
+    }
 
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
     uint8_t controlData[256];
@@ -307,8 +327,8 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
 
     struct msghdr msgHeader;
     memset(&msgHeader, 0, sizeof(msgHeader));
-    msgHeader.msg_iov    = &msgIOV;
-    msgHeader.msg_iovlen = 1;
+    msgHeader.msg_iov    = msgIOV;
+    msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(msgIOVLen);
 
     // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
     SockAddr peerSockAddr;
@@ -416,14 +436,16 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     // Send IP packet.
     // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
     const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
+    SYSTEM_STATS_COUNT(System::Stats::kInetLayer_UDPSendSyscalls, 1);
     if (lenSent == -1)
     {
         return CHIP_ERROR_POSIX(errno);
     }
+    SYSTEM_STATS_COUNT(System::Stats::kInetLayer_UDPSendPacketBuffers, msgIOVLen);
 
     size_t len = static_cast<size_t>(lenSent);
 
-    if (len != msg->DataLength())
+    if (len != msg->TotalLength())
     {
         return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
     }
@@ -575,6 +597,162 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events, intptr
     reinterpret_cast<UDPEndPointImplSockets *>(data)->HandlePendingIO(events);
 }
 
+namespace {
+
+// Fills in the source, and the destination and interface if known, of a datagram received with recvmsg or recvmmsg.
+CHIP_ERROR ParseReceivedMessageInfo(struct msghdr & msgHeader, IPPacketInfo & packetInfo)
+{
+    const SockAddr & peerSockAddr = *static_cast<const SockAddr *>(msgHeader.msg_name);
+    if (peerSockAddr.any.sa_family == AF_INET6)
+    {
+        packetInfo.SrcAddress = IPAddress(peerSockAddr.in6.sin6_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (peerSockAddr.any.sa_family == AF_INET)
+    {
+        packetInfo.SrcAddress = IPAddress(peerSockAddr.in.sin_addr);
+        packetInfo.SrcPort    = ntohs(peerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            packetInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            packetInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            packetInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+#if INET_UDP_SOCKET_RECEIVE_BATCH
+
+void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
+{
+    if (mState != State::kListening || OnMessageReceived == nullptr || !events.Has(System::SocketEventFlags::kRead))
+    {
+        return;
+    }
+
+    constexpr unsigned int kBatchSize = INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE;
+
+    System::PacketBufferHandle buffers[kBatchSize];
+    struct iovec msgIOVs[kBatchSize];
+    SockAddr peerSockAddrs[kBatchSize];
+    uint8_t controlData[kBatchSize][256];
+    struct mmsghdr msgHeaders[kBatchSize];
+
+    memset(peerSockAddrs, 0, sizeof(peerSockAddrs));
+    memset(msgHeaders, 0, sizeof(msgHeaders));
+
+    // Receive into as many buffers as are available, up to the batch size.
+    unsigned int numBuffers = 0;
+    for (; numBuffers < kBatchSize; numBuffers++)
+    {
+        buffers[numBuffers] = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+        if (buffers[numBuffers].IsNull())
+        {
+            break;
+        }
+
+        msgIOVs[numBuffers].iov_base = buffers[numBuffers]->Start();
+        msgIOVs[numBuffers].iov_len  = buffers[numBuffers]->AvailableDataLength();
+
+        struct msghdr & msgHeader = msgHeaders[numBuffers].msg_hdr;
+        msgHeader.msg_name        = &peerSockAddrs[numBuffers];
+        msgHeader.msg_namelen     = sizeof(peerSockAddrs[numBuffers]);
+        msgHeader.msg_iov         = &msgIOVs[numBuffers];
+        msgHeader.msg_iovlen      = 1;
+        msgHeader.msg_control     = controlData[numBuffers];
+        msgHeader.msg_controllen  = sizeof(controlData[numBuffers]);
+    }
+
+    if (numBuffers == 0)
+    {
+        if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, CHIP_ERROR_NO_MEMORY, nullptr);
+        }
+        return;
+    }
+
+    const int numReceived = recvmmsg(mSocket, msgHeaders, numBuffers, MSG_DONTWAIT, nullptr);
+    SYSTEM_STATS_COUNT(System::Stats::kInetLayer_UDPReceiveSyscalls, 1);
+    if (numReceived == -1)
+    {
+        const CHIP_ERROR status = CHIP_ERROR_POSIX(errno);
+        if (OnReceiveError != nullptr && status != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, status, nullptr);
+        }
+        return;
+    }
+    SYSTEM_STATS_COUNT(System::Stats::kInetLayer_UDPReceivePackets, numReceived);
+
+    // The handlers may close or free this endpoint; keep it alive until the whole batch has been dispatched, and stop
+    // dispatching once it is no longer listening.
+    Retain();
+    for (int i = 0; i < numReceived && mState == State::kListening && OnMessageReceived != nullptr; i++)
+    {
+        IPPacketInfo packetInfo;
+        packetInfo.Clear();
+        packetInfo.DestPort  = mBoundPort;
+        packetInfo.Interface = mBoundIntfId;
+
+        CHIP_ERROR status = CHIP_NO_ERROR;
+        if ((msgHeaders[i].msg_hdr.msg_flags & MSG_TRUNC) || buffers[i]->AvailableDataLength() < msgHeaders[i].msg_len)
+        {
+            status = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
+        }
+        else
+        {
+            buffers[i]->SetDataLength(msgHeaders[i].msg_len);
+            status = ParseReceivedMessageInfo(msgHeaders[i].msg_hdr, packetInfo);
+        }
+
+        if (status == CHIP_NO_ERROR)
+        {
+            buffers[i].RightSize();
+            OnMessageReceived(this, std::move(buffers[i]), &packetInfo);
+        }
+        else if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, status, nullptr);
+        }
+    }
+    Release();
+}
+
+#else // INET_UDP_SOCKET_RECEIVE_BATCH
+
 void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 {
     if (mState != State::kListening || OnMessageReceived == nullptr || !events.Has(System::SocketEventFlags::kRead))
@@ -614,6 +792,7 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         msgHeader.msg_controllen = sizeof(controlData);
 
         ssize_t rcvLen = recvmsg(mSocket, &msgHeader, MSG_DONTWAIT);
+        SYSTEM_STATS_COUNT(System::Stats::kInetLayer_UDPReceiveSyscalls, 1);
 
         if (rcvLen == -1)
         {
@@ -625,63 +804,9 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         }
         else
         {
+            SYSTEM_STATS_COUNT(System::Stats::kInetLayer_UDPReceivePackets, 1);
             lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
-
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
-        }
-
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
-
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+            lStatus = ParseReceivedMessageInfo(msgHeader, lPacketInfo);
         }
     }
     else
@@ -703,6 +828,8 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
     }
 }
 
+#endif // INET_UDP_SOCKET_RECEIVE_BATCH
+
 #ifdef IPV6_MULTICAST_LOOP
 static CHIP_ERROR SocketsSetMulticastLoopback(int aSocket, bool aLoopback, int aProtocol, int aOption)
 {
@@ -0,0 +1,125 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Timing benchmark of how fast a burst of datagrams is drained from a UDP
+ *      endpoint, in event loop wakeups, wall time and CPU time. Compare builds
+ *      with different INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE values.
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <inet/InetConfig.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+#include <system/SystemStats.h>
+
+#include "TestInetCommon.h"
+
+#if INET_CONFIG_ENABLE_UDP_ENDPOINT
+
+using namespace chip;
+using namespace chip::Inet;
+using namespace chip::System;
+
+namespace {
+
+constexpr size_t kNumPackets = 256;
+
+void HandleBurstMessageReceived(UDPEndPoint * endPoint, PacketBufferHandle && msg, const IPPacketInfo * pktInfo)
+{
+    ++*static_cast<size_t *>(endPoint->mAppState);
+}
+
+class BenchmarkInetUDPReceive : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        InitSystemLayer();
+        InitNetwork();
+    }
+    static void TearDownTestSuite()
+    {
+        ShutdownNetwork();
+        ShutdownSystemLayer();
+        Platform::MemoryShutdown();
+    }
+};
+
+TEST_F(BenchmarkInetUDPReceive, DrainBurst)
+{
+    IPAddress loopback;
+    ASSERT_TRUE(IPAddress::FromString("::1", loopback));
+
+    size_t received        = 0;
+    UDPEndPoint * receiver = nullptr;
+    UDPEndPoint * sender   = nullptr;
+    ASSERT_EQ(gUDP.NewEndPoint(&receiver), CHIP_NO_ERROR);
+    ASSERT_EQ(gUDP.NewEndPoint(&sender), CHIP_NO_ERROR);
+
+    ASSERT_EQ(receiver->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+    ASSERT_EQ(receiver->Listen(HandleBurstMessageReceived, nullptr, &received), CHIP_NO_ERROR);
+
+    uint8_t payload[100] = { 0 };
+    for (size_t i = 0; i < kNumPackets; i++)
+    {
+        PacketBufferHandle buf = PacketBufferHandle::NewWithData(payload, sizeof(payload));
+        ASSERT_FALSE(buf.IsNull());
+        ASSERT_EQ(sender->SendTo(loopback, receiver->GetBoundPort(), std::move(buf)), CHIP_NO_ERROR);
+    }
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    Stats::ResetCounters();
+#endif
+    const uint64_t start   = SystemClock().GetMonotonicMicroseconds64().count();
+    const clock_t cpuStart = clock();
+    size_t wakeups         = 0;
+    while (received < kNumPackets && wakeups < 10 * kNumPackets)
+    {
+        ServiceEvents(10);
+        wakeups++;
+    }
+    const uint64_t elapsedUs = SystemClock().GetMonotonicMicroseconds64().count() - start;
+    const clock_t cpuUsed    = clock() - cpuStart;
+    EXPECT_EQ(received, kNumPackets);
+
+    ChipLogProgress(Inet, "UDP burst of %u packets: %u event loop wakeups, %u us, %u us CPU, batch size %u",
+                    static_cast<unsigned>(received), static_cast<unsigned>(wakeups), static_cast<unsigned>(elapsedUs),
+                    static_cast<unsigned>(static_cast<uint64_t>(cpuUsed) * 1000000 / CLOCKS_PER_SEC),
+                    static_cast<unsigned>(INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE));
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    ChipLogProgress(Inet, "UDP burst: %u packets in %u receive syscalls",
+                    static_cast<unsigned>(Stats::GetCounters()[Stats::kInetLayer_UDPReceivePackets]),
+                    static_cast<unsigned>(Stats::GetCounters()[Stats::kInetLayer_UDPReceiveSyscalls]));
+#endif
+
+    sender->Free();
+    receiver->Free();
+}
+
+} // namespace
+
+#endif // INET_CONFIG_ENABLE_UDP_ENDPOINT
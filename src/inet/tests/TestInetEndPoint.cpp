@@ -29,6 +29,8 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <algorithm>
+
 #include <pw_unit_test/framework.h>
 
 #include <CHIPVersion.h>
@@ -39,6 +41,7 @@
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <system/SystemError.h>
+#include <system/SystemStats.h>
 
 #include "TestInetCommon.h"
 #include "TestSetupSignalling.h"
@@ -370,6 +373,134 @@ TEST_F(TestInetEndPoint, TestInetEndPointInternal)
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && INET_CONFIG_ENABLE_UDP_ENDPOINT
+namespace {
+
+struct ChainedReceiveState
+{
+    size_t receivedLength = 0;
+    uint8_t received[64];
+};
+
+void HandleChainedMessageReceived(UDPEndPoint * endPoint, PacketBufferHandle && msg, const IPPacketInfo * pktInfo)
+{
+    auto * state = static_cast<ChainedReceiveState *>(endPoint->mAppState);
+    EXPECT_FALSE(msg->HasChainedBuffer());
+    state->receivedLength = msg->DataLength();
+    memcpy(state->received, msg->Start(), std::min(msg->DataLength(), sizeof(state->received)));
+}
+
+} // namespace
+
+// Test that a chain of packet buffers is sent as a single datagram.
+TEST_F(TestInetEndPoint, TestInetUDPSendChainedBuffer)
+{
+    IPAddress loopback;
+    ASSERT_TRUE(IPAddress::FromString("::1", loopback));
+
+    ChainedReceiveState state;
+    UDPEndPoint * receiver = nullptr;
+    UDPEndPoint * sender   = nullptr;
+    ASSERT_EQ(gUDP.NewEndPoint(&receiver), CHIP_NO_ERROR);
+    ASSERT_EQ(gUDP.NewEndPoint(&sender), CHIP_NO_ERROR);
+
+    ASSERT_EQ(receiver->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+    ASSERT_EQ(receiver->Listen(HandleChainedMessageReceived, nullptr, &state), CHIP_NO_ERROR);
+
+    const char * const parts[] = { "chained ", "packet ", "buffers" };
+    PacketBufferHandle msg;
+    for (const char * part : parts)
+    {
+        PacketBufferHandle buf = PacketBufferHandle::NewWithData(part, strlen(part));
+        ASSERT_FALSE(buf.IsNull());
+        if (msg.IsNull())
+        {
+            msg = std::move(buf);
+        }
+        else
+        {
+            msg->AddToEnd(std::move(buf));
+        }
+    }
+    EXPECT_TRUE(msg->HasChainedBuffer());
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    System::Stats::ResetCounters();
+#endif
+    EXPECT_EQ(sender->SendTo(loopback, receiver->GetBoundPort(), std::move(msg)), CHIP_NO_ERROR);
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    EXPECT_EQ(System::Stats::GetCounters()[System::Stats::kInetLayer_UDPSendSyscalls], 1u);
+    EXPECT_EQ(System::Stats::GetCounters()[System::Stats::kInetLayer_UDPSendPacketBuffers], 3u);
+#endif
+
+    for (int i = 0; i < 100 && state.receivedLength == 0; i++)
+    {
+        ServiceEvents(10);
+    }
+    ASSERT_EQ(state.receivedLength, strlen("chained packet buffers"));
+    EXPECT_EQ(memcmp(state.received, "chained packet buffers", state.receivedLength), 0);
+
+    sender->Free();
+    receiver->Free();
+}
+
+namespace {
+
+void HandleBurstMessageReceived(UDPEndPoint * endPoint, PacketBufferHandle && msg, const IPPacketInfo * pktInfo)
+{
+    ++*static_cast<size_t *>(endPoint->mAppState);
+}
+
+} // namespace
+
+// Test that a burst of datagrams is fully drained from a UDP endpoint, in fewer reads than
+// packets when receive batching is enabled.
+TEST_F(TestInetEndPoint, TestInetUDPReceiveBurst)
+{
+    constexpr size_t kNumPackets = 64;
+
+    IPAddress loopback;
+    ASSERT_TRUE(IPAddress::FromString("::1", loopback));
+
+    size_t received        = 0;
+    UDPEndPoint * receiver = nullptr;
+    UDPEndPoint * sender   = nullptr;
+    ASSERT_EQ(gUDP.NewEndPoint(&receiver), CHIP_NO_ERROR);
+    ASSERT_EQ(gUDP.NewEndPoint(&sender), CHIP_NO_ERROR);
+
+    ASSERT_EQ(receiver->Bind(IPAddressType::kIPv6, loopback, 0), CHIP_NO_ERROR);
+    ASSERT_EQ(receiver->Listen(HandleBurstMessageReceived, nullptr, &received), CHIP_NO_ERROR);
+
+    uint8_t payload[100] = { 0 };
+    for (size_t i = 0; i < kNumPackets; i++)
+    {
+        PacketBufferHandle buf = PacketBufferHandle::NewWithData(payload, sizeof(payload));
+        ASSERT_FALSE(buf.IsNull());
+        ASSERT_EQ(sender->SendTo(loopback, receiver->GetBoundPort(), std::move(buf)), CHIP_NO_ERROR);
+    }
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    System::Stats::ResetCounters();
+#endif
+    for (size_t i = 0; i < 10 * kNumPackets && received < kNumPackets; i++)
+    {
+        ServiceEvents(10);
+    }
+    EXPECT_EQ(received, kNumPackets);
+
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    const System::Stats::counter_value_t * counters = System::Stats::GetCounters();
+    EXPECT_EQ(counters[System::Stats::kInetLayer_UDPReceivePackets], kNumPackets);
+#if INET_CONFIG_UDP_SOCKET_RECEIVE_BATCH_SIZE > 1 && defined(__linux__) && CHIP_SYSTEM_CONFIG_USE_POSIX_SOCKETS
+    EXPECT_LT(counters[System::Stats::kInetLayer_UDPReceiveSyscalls], counters[System::Stats::kInetLayer_UDPReceivePackets]);
+#endif
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+
+    sender->Free();
+    receiver->Free();
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && INET_CONFIG_ENABLE_UDP_ENDPOINT
+
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 // Test the Inet resource limitations.
 TEST_F(TestInetEndPoint, TestInetEndPointLimit)
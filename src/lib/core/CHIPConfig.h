@@ -82,6 +82,7 @@
  *      * #CHIP_CONFIG_MEMORY_MGMT_PLATFORM
  *      * #CHIP_CONFIG_MEMORY_MGMT_SIMPLE
  *      * #CHIP_CONFIG_MEMORY_MGMT_MALLOC
+ *      * #CHIP_CONFIG_MEMORY_MGMT_SLAB (on top of malloc)
  *
  *    Note that these options are mutually exclusive and only one
  *    of these options should be set.
@@ -121,6 +122,34 @@
 #define CHIP_CONFIG_MEMORY_MGMT_MALLOC 1
 #endif // CHIP_CONFIG_MEMORY_MGMT_MALLOC
 
+/**
+ *  @def CHIP_CONFIG_MEMORY_MGMT_SLAB
+ *
+ *  @brief
+ *    Enable (1) or disable (0) the chip-provided size-class slab
+ *    allocator for Matter memory-management functions. Small
+ *    allocations are served in constant time from per size class
+ *    slabs; slabs and larger allocations come from malloc.
+ *
+ *  @note This configuration requires #CHIP_CONFIG_MEMORY_MGMT_MALLOC.
+ *
+ */
+#ifndef CHIP_CONFIG_MEMORY_MGMT_SLAB
+#define CHIP_CONFIG_MEMORY_MGMT_SLAB 0
+#endif // CHIP_CONFIG_MEMORY_MGMT_SLAB
+
+/**
+ *  @def CHIP_CONFIG_MEMORY_SLAB_SIZE
+ *
+ *  @brief
+ *    Size in bytes of the slabs that #CHIP_CONFIG_MEMORY_MGMT_SLAB
+ *    allocates from malloc and divides into blocks of one size class.
+ *
+ */
+#ifndef CHIP_CONFIG_MEMORY_SLAB_SIZE
+#define CHIP_CONFIG_MEMORY_SLAB_SIZE 4096
+#endif // CHIP_CONFIG_MEMORY_SLAB_SIZE
+
 /**
  *  @}
  */
@@ -129,6 +158,10 @@
 #error "Please assert exactly one of CHIP_CONFIG_MEMORY_MGMT_PLATFORM or CHIP_CONFIG_MEMORY_MGMT_MALLOC."
 #endif // ((CHIP_CONFIG_MEMORY_MGMT_PLATFORM + CHIP_CONFIG_MEMORY_MGMT_MALLOC) != 1)
 
+#if CHIP_CONFIG_MEMORY_MGMT_SLAB && !CHIP_CONFIG_MEMORY_MGMT_MALLOC
+#error "CHIP_CONFIG_MEMORY_MGMT_SLAB requires CHIP_CONFIG_MEMORY_MGMT_MALLOC"
+#endif
+
 #if !CHIP_CONFIG_MEMORY_MGMT_MALLOC && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 #error "!CHIP_CONFIG_MEMORY_MGMT_MALLOC but getifaddrs() uses malloc()"
 #endif
@@ -383,6 +416,20 @@
 #define CHIP_CONFIG_CERT_MAX_RDN_ATTRIBUTES 5
 #endif // CHIP_CONFIG_CERT_MAX_RDN_ATTRIBUTES
 
+/**
+ *  @def CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE
+ *
+ *  @brief
+ *    The number of certificate signatures the fabric table remembers as
+ *    already verified, so that operational certificate chains seen again
+ *    (e.g. the ICAC of a peer in every CASE handshake) skip the ECDSA
+ *    verification. Each entry takes about 40 bytes.
+ *
+ */
+#ifndef CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE 8
+#endif // CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE
+
 /**
  *  @def CHIP_ERROR_LOGGING
  *
@@ -672,6 +719,31 @@
 #define CHIP_CONFIG_PERSISTED_STORAGE_MAX_KEY_LENGTH 16
 #endif
 
+/**
+ * @def CHIP_CONFIG_COALESCING_STORAGE_MAX_PENDING_WRITES
+ *
+ * @brief The number of distinct keys whose mutations a CoalescingPersistentStorageDelegate
+ *   buffers before it flushes them to the backing storage without waiting for its flush window.
+ */
+#ifndef CHIP_CONFIG_COALESCING_STORAGE_MAX_PENDING_WRITES
+#define CHIP_CONFIG_COALESCING_STORAGE_MAX_PENDING_WRITES 16
+#endif
+
+/**
+ * @def CHIP_CONFIG_SERVER_COALESCING_STORAGE
+ *
+ * @brief Wrap the KVS storage that CommonCaseDeviceServerInitParams gives the server in a
+ *   CoalescingPersistentStorageDelegate, so the writes made within one event loop turn reach the
+ *   KVS together and repeated writes to a key are written once.
+ *
+ *   The KVS has no multi-key transaction, so each flushed write is still a separate KVS commit and
+ *   a reboot during a flush can leave part of the batch applied. Enable with the
+ *   chip_config_server_coalescing_storage GN arg.
+ */
+#ifndef CHIP_CONFIG_SERVER_COALESCING_STORAGE
+#define CHIP_CONFIG_SERVER_COALESCING_STORAGE 0
+#endif
+
 /**
  * @def CHIP_CONFIG_PERSISTED_COUNTER_DEBUG_LOGGING
  *
@@ -769,6 +841,37 @@
 #define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + 2)
 #endif // CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+ *
+ * @brief Enables hash indexes over the secure session table, keyed by local session ID
+ * and by peer ScopedNodeId, so per-message session lookup does not scan the whole table.
+ *
+ * Each of the two indexes holds the smallest power of two that is at least
+ * 2 * CHIP_CONFIG_SECURE_SESSION_POOL_SIZE slots, each slot being a session pointer and a
+ * uint32_t hash (e.g. 2 * 128 * 16 = 4 KB on 64-bit targets for the default pool of 50).
+ * This is disabled by default; platforms with large session pools can enable it (the GN build
+ * sets it with chip_config_secure_session_table_index).
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+#define CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX 0
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS
+ *
+ * @brief Keeps an AES-CCM cipher set up with each session key (see Crypto::Aes128CcmCipher),
+ * so that encrypting or decrypting a message does not set up the cipher context and key
+ * schedule again.
+ *
+ * Depending on the crypto backend, each session then holds two cipher contexts allocated from
+ * the heap (e.g. two mbedtls_ccm_context with mbedTLS), so this is disabled by default; platforms
+ * with heap to spare can opt in.
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS
+#define CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS 0
+#endif // CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS
+
 /**
  *  @def CHIP_CONFIG_MAX_GROUP_DATA_PEERS
  *
@@ -931,6 +1034,39 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_INDEX
+ *
+ * @brief Enables a reverse index from (endpoint, cluster) to the read handlers whose attribute paths
+ * cover it, so that marking an attribute dirty only visits the interested read handlers instead of
+ * every path of every active read and subscription.
+ *
+ * The index costs one small entry per attribute path group (see CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS
+ * and CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS). It is disabled by default; platforms that
+ * serve many subscriptions can enable it (the GN build sets it with chip_config_im_attribute_interest_index).
+ */
+#ifndef CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_INDEX
+#define CHIP_CONFIG_IM_ATTRIBUTE_INTEREST_INDEX 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE
+ *
+ * @brief Size, in bytes, of the cache of encoded AttributeReportIBs shared by the read handlers
+ * reported in a single reporting engine run. When several subscribers report the same attribute,
+ * it is read and encoded once and copied into the other reports.
+ *
+ * Attributes whose encoding depends on the reader (fabric-scoped or fabric-sensitive data, the
+ * accessing fabric) are never cached.
+ *
+ * Defaults to 0, which disables the cache. Platforms that serve many subscriptions to the same
+ * attributes can enable it (the GN build sets it with chip_config_im_encoded_report_cache_size,
+ * e.g. 2048).
+ */
+#ifndef CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE
+#define CHIP_CONFIG_IM_ENCODED_REPORT_CACHE_SIZE 0
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1107,6 +1243,20 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE
+ *
+ * @brief Defines the number of group operational keys the GroupDataProviderImpl keeps in RAM, indexed by group
+ *        session ID, to find the candidate keys of incoming group messages without reading persistent storage.
+ *
+ * Each entry holds one operational key of one group-key mapping, so up to 3 entries are needed per mapping. If the
+ * configured keys do not fit, incoming group messages fall back to reading the keys from persistent storage.
+ * Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE
+#define CHIP_CONFIG_GROUP_SESSION_CACHE_SIZE 0
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_NAME_LENGTH
  *
@@ -1116,6 +1266,34 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_NAME_LENGTH 16
 #endif
 
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_ENTRY_INDEX
+ *
+ * @brief
+ *   Enables a compiled, heap-allocated copy of the access control list that
+ *   AccessControl::Check consults instead of iterating entries through the
+ *   delegate. The copy is rebuilt after any change made through AccessControl;
+ *   when entries change by other means (e.g. in the storage of the delegate),
+ *   AccessControl::OnEntriesChangedExternally() must be called.
+ *
+ *   Worth its RAM on devices with many fabrics and large access control lists.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_ENTRY_INDEX
+#define CHIP_CONFIG_ACCESS_CONTROL_ENTRY_INDEX 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+ *
+ * @brief
+ *   Number of (endpoint, cluster, privilege) access decisions an
+ *   Access::AccessDecisionCache remembers. Interactions keep one cache each,
+ *   so checks for the attributes of a cluster instance are only made once.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE 4
+#endif
+
 /**
  * @def CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_ENTRIES_PER_FABRIC
  *
@@ -1257,6 +1435,22 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD 512
 #endif /* CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD */
 
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+ *
+ * @brief The number of most recent events indexed, by event number, in
+ *   each event logging buffer.
+ *
+ * The index lets EventManagement::FetchEventsSince skip the events a
+ * reader has already been sent without decoding them, so that a report
+ * only walks the events that are new to its subscription.  Each entry
+ * takes 12 bytes per buffer.  Set to 0 to disable the index.
+ *
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE 16
+#endif /* CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE */
+
 /**
  * @def CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
  *
@@ -110,6 +110,19 @@ public:
         CHIP_ERROR err = SyncGetKeyValue(key, nullptr, size);
         return (err == CHIP_ERROR_BUFFER_TOO_SMALL) || (err == CHIP_NO_ERROR);
     }
+
+    /**
+     * @brief
+     *   Barrier: returns once every mutation made so far has been handed to durable storage.
+     *
+     *   Implementations that buffer mutations (see app::CoalescingPersistentStorageDelegate) flush
+     *   them here. Callers use this before acting on the assumption that a write survives a reboot,
+     *   e.g. before handing out values above a persisted counter epoch. The default implementation
+     *   applies mutations immediately and has nothing to do.
+     *
+     * @return CHIP_NO_ERROR on success, or the error from the first mutation that could not be persisted.
+     */
+    virtual CHIP_ERROR SyncFlush() { return CHIP_NO_ERROR; }
 };
 
 } // namespace chip
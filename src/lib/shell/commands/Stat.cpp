@@ -46,6 +46,14 @@ CHIP_ERROR StatPeakHandler(int argc, char ** argv)
         streamer_printf(streamer_get(), "%s: %i\r\n", labels[i], static_cast<int>(watermarks[i]));
     }
 
+    auto counterLabels = System::Stats::GetCounterStrings();
+    auto counters      = System::Stats::GetCounters();
+
+    for (int i = 0; i < System::Stats::kNumCounters; i++)
+    {
+        streamer_printf(streamer_get(), "%s: %lu\r\n", counterLabels[i], static_cast<unsigned long>(counters[i]));
+    }
+
     if (DeviceLayer::GetDiagnosticDataProvider().SupportsWatermarks())
     {
         uint64_t heapWatermark;
@@ -75,6 +83,8 @@ CHIP_ERROR StatResetHandler(int argc, char ** argv)
         watermarks[i] = current[i];
     }
 
+    System::Stats::ResetCounters();
+
     if (DeviceLayer::GetDiagnosticDataProvider().SupportsWatermarks())
     {
         ReturnErrorOnFailure(DeviceLayer::GetDiagnosticDataProvider().ResetWatermarks());
@@ -0,0 +1,403 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements heap memory allocation APIs for CHIP with a size-class slab allocator.
+ *
+ *      Allocations up to the largest size class are rounded up to a size class and served from a free list of
+ *      blocks of that class, which is refilled one slab (of CHIP_CONFIG_MEMORY_SLAB_SIZE bytes) at a time from
+ *      malloc. Both allocation and release are constant time. Slabs are kept for reuse once allocated. Larger
+ *      allocations go straight to malloc.
+ *
+ *      Every block starts with a header recording its size class and requested size, so that MemoryFree and
+ *      MemoryRealloc do not need to search for the owning slab.
+ */
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/VerificationMacrosNoLogging.h>
+#include <system/SystemMutex.h>
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if CHIP_CONFIG_MEMORY_MGMT_SLAB
+
+namespace chip {
+namespace Platform {
+
+namespace {
+
+struct alignas(max_align_t) BlockHeader
+{
+    size_t size;      // size requested by the caller
+    size_t sizeClass; // index in kClassSizes, or kLargeClass
+};
+
+struct alignas(max_align_t) Slab
+{
+    Slab * next;
+};
+
+struct FreeBlock
+{
+    FreeBlock * next;
+};
+
+// Usable block sizes. They are multiples of kGranularity, so that blocks stay aligned for any type.
+constexpr size_t kClassSizes[]   = { 16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024 };
+constexpr size_t kSlabClassCount = sizeof(kClassSizes) / sizeof(kClassSizes[0]);
+constexpr size_t kLargeClass     = kSlabClassCount;
+constexpr size_t kGranularity    = alignof(max_align_t);
+constexpr size_t kMaxSlabSize    = kClassSizes[kSlabClassCount - 1];
+
+static_assert(sizeof(BlockHeader) % kGranularity == 0, "Block header breaks block alignment");
+static_assert(kMaxSlabSize % kGranularity == 0, "Size classes must be multiples of the alignment");
+
+// Maps (size + kGranularity - 1) / kGranularity to the smallest size class that fits it.
+struct ClassLookup
+{
+    uint8_t classFor[kMaxSlabSize / kGranularity + 1];
+
+    constexpr ClassLookup() : classFor()
+    {
+        size_t sizeClass = 0;
+        for (size_t i = 0; i < sizeof(classFor); i++)
+        {
+            while (kClassSizes[sizeClass] < i * kGranularity)
+            {
+                sizeClass++;
+            }
+            classFor[i] = static_cast<uint8_t>(sizeClass);
+        }
+    }
+};
+
+constexpr ClassLookup kClassLookup;
+
+struct SizeClass
+{
+    FreeBlock * freeList;
+    Slab * slabs;
+    MemorySlabStats stats;
+};
+
+SizeClass gClasses[kSlabClassCount + 1];
+bool gInitialized = false;
+
+#ifndef NDEBUG
+std::atomic_int gMemoryInitCount{ 0 };
+#endif
+
+#if CHIP_SYSTEM_CONFIG_NO_LOCKING
+
+class HeapLocked
+{
+public:
+    HeapLocked() {}
+    ~HeapLocked() {}
+};
+
+#else
+
+chip::System::Mutex gHeapLock;
+bool gHeapLockInitialized = false;
+
+class HeapLocked
+{
+public:
+    HeapLocked() { gHeapLock.Lock(); }
+    ~HeapLocked() { gHeapLock.Unlock(); }
+};
+#endif
+
+size_t BlockStride(size_t sizeClass)
+{
+    return sizeof(BlockHeader) + kClassSizes[sizeClass];
+}
+
+bool AddSlab(size_t sizeClass)
+{
+    SizeClass & cls     = gClasses[sizeClass];
+    const size_t stride = BlockStride(sizeClass);
+
+    Slab * slab = static_cast<Slab *>(malloc(sizeof(Slab) + cls.stats.blocksPerSlab * stride));
+    if (slab == nullptr)
+    {
+        return false;
+    }
+    slab->next = cls.slabs;
+    cls.slabs  = slab;
+    cls.stats.slabCount++;
+
+    uint8_t * block = reinterpret_cast<uint8_t *>(slab + 1);
+    for (size_t i = 0; i < cls.stats.blocksPerSlab; i++, block += stride)
+    {
+        FreeBlock * freeBlock = reinterpret_cast<FreeBlock *>(block);
+        freeBlock->next       = cls.freeList;
+        cls.freeList          = freeBlock;
+    }
+    return true;
+}
+
+void RecordAllocation(MemorySlabStats & stats, size_t size)
+{
+    stats.allocations++;
+    stats.blocksInUse++;
+    stats.bytesRequested += size;
+    if (stats.blocksInUse > stats.peakBlocksInUse)
+    {
+        stats.peakBlocksInUse = stats.blocksInUse;
+    }
+}
+
+BlockHeader * HeaderOf(void * p)
+{
+    return static_cast<BlockHeader *>(p) - 1;
+}
+
+} // namespace
+
+CHIP_ERROR MemoryAllocatorInit(void * buf, size_t bufSize)
+{
+    // Logging can use Memory::Alloc, so we can't use logging with our
+    // VerifyOrDie bits here.
+#ifndef NDEBUG
+    VerifyOrDieWithoutLogging(gMemoryInitCount++ == 0);
+#endif
+
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    // Slabs outlive MemoryAllocatorShutdown() if blocks are still allocated, and so does the lock protecting them.
+    if (!gHeapLockInitialized)
+    {
+        CHIP_ERROR err = chip::System::Mutex::Init(gHeapLock);
+        if (err != CHIP_NO_ERROR)
+        {
+            return err;
+        }
+        gHeapLockInitialized = true;
+    }
+#endif
+
+    HeapLocked lock;
+
+    for (size_t sizeClass = 0; sizeClass <= kSlabClassCount; sizeClass++)
+    {
+        MemorySlabStats & stats = gClasses[sizeClass].stats;
+        stats.allocations       = 0;
+        stats.peakBlocksInUse   = stats.blocksInUse;
+        if (sizeClass < kSlabClassCount)
+        {
+            const size_t stride = BlockStride(sizeClass);
+            stats.blockSize     = kClassSizes[sizeClass];
+            stats.blocksPerSlab = (CHIP_CONFIG_MEMORY_SLAB_SIZE > sizeof(Slab) + stride)
+                ? (CHIP_CONFIG_MEMORY_SLAB_SIZE - sizeof(Slab)) / stride
+                : 1;
+        }
+    }
+    gInitialized = true;
+    return CHIP_NO_ERROR;
+}
+
+void MemoryAllocatorShutdown()
+{
+    // Logging can use Memory::Alloc, so we can't use logging with our
+    // VerifyOrDie bits here.
+#ifndef NDEBUG
+    VerifyOrDieWithoutLogging(--gMemoryInitCount == 0);
+#endif
+
+    HeapLocked lock;
+
+    gInitialized = false;
+
+    // Blocks that are still allocated may be released later on; their slabs must then stay around.
+    for (const SizeClass & cls : gClasses)
+    {
+        if (cls.stats.blocksInUse > 0)
+        {
+            return;
+        }
+    }
+
+    for (size_t sizeClass = 0; sizeClass < kSlabClassCount; sizeClass++)
+    {
+        SizeClass & cls = gClasses[sizeClass];
+        while (cls.slabs != nullptr)
+        {
+            Slab * slab = cls.slabs;
+            cls.slabs   = slab->next;
+            free(slab);
+        }
+        cls.freeList        = nullptr;
+        cls.stats.slabCount = 0;
+    }
+}
+
+void * MemoryAlloc(size_t size)
+{
+    HeapLocked lock;
+
+    if (!gInitialized)
+    {
+        return nullptr;
+    }
+
+    BlockHeader * header;
+    size_t sizeClass;
+    if (size <= kMaxSlabSize)
+    {
+        sizeClass       = kClassLookup.classFor[(size + kGranularity - 1) / kGranularity];
+        SizeClass & cls = gClasses[sizeClass];
+        if ((cls.freeList == nullptr) && !AddSlab(sizeClass))
+        {
+            return nullptr;
+        }
+        header       = reinterpret_cast<BlockHeader *>(cls.freeList);
+        cls.freeList = cls.freeList->next;
+    }
+    else
+    {
+        if (size > SIZE_MAX - sizeof(BlockHeader))
+        {
+            return nullptr;
+        }
+        sizeClass = kLargeClass;
+        header    = static_cast<BlockHeader *>(malloc(sizeof(BlockHeader) + size));
+        if (header == nullptr)
+        {
+            return nullptr;
+        }
+    }
+
+    header->size      = size;
+    header->sizeClass = sizeClass;
+    RecordAllocation(gClasses[sizeClass].stats, size);
+    return header + 1;
+}
+
+void * MemoryCalloc(size_t num, size_t size)
+{
+    size_t total = num * size;
+
+    // check for multiplication overflow
+    if ((num != 0) && (size != total / num))
+    {
+        return nullptr;
+    }
+
+    void * result = MemoryAlloc(total);
+    if (result != nullptr)
+    {
+        memset(result, 0, total);
+    }
+    return result;
+}
+
+void * MemoryRealloc(void * p, size_t size)
+{
+    if (p == nullptr)
+    {
+        return MemoryAlloc(size);
+    }
+
+    size_t oldSize;
+    {
+        HeapLocked lock;
+
+        BlockHeader * header = HeaderOf(p);
+        if ((header->sizeClass < kSlabClassCount) && (size <= kClassSizes[header->sizeClass]))
+        {
+            // Still fits in the same block.
+            MemorySlabStats & stats = gClasses[header->sizeClass].stats;
+            stats.bytesRequested    = stats.bytesRequested - header->size + size;
+            header->size            = size;
+            return p;
+        }
+        oldSize = header->size;
+    }
+
+    void * result = MemoryAlloc(size);
+    if (result != nullptr)
+    {
+        memcpy(result, p, (oldSize < size) ? oldSize : size);
+        MemoryFree(p);
+    }
+    return result;
+}
+
+void MemoryFree(void * p)
+{
+    if (p == nullptr)
+    {
+        return;
+    }
+
+    HeapLocked lock;
+
+    BlockHeader * header    = HeaderOf(p);
+    const size_t sizeClass  = header->sizeClass;
+    MemorySlabStats & stats = gClasses[sizeClass].stats;
+    stats.blocksInUse--;
+    stats.bytesRequested -= header->size;
+
+    if (sizeClass == kLargeClass)
+    {
+        free(header);
+        return;
+    }
+
+    FreeBlock * freeBlock        = reinterpret_cast<FreeBlock *>(header);
+    freeBlock->next              = gClasses[sizeClass].freeList;
+    gClasses[sizeClass].freeList = freeBlock;
+}
+
+bool MemoryInternalCheckPointer(const void * p, size_t min_size)
+{
+    if (p == nullptr)
+    {
+        return false;
+    }
+    const BlockHeader * header = static_cast<const BlockHeader *>(p) - 1;
+    return (header->sizeClass <= kLargeClass) && (header->size >= min_size);
+}
+
+size_t MemorySlabClassCount()
+{
+    return kSlabClassCount + 1;
+}
+
+CHIP_ERROR MemorySlabGetStats(size_t sizeClass, MemorySlabStats & stats)
+{
+    if (sizeClass > kLargeClass)
+    {
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    HeapLocked lock;
+    stats = gClasses[sizeClass].stats;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Platform
+} // namespace chip
+
+#endif // CHIP_CONFIG_MEMORY_MGMT_SLAB
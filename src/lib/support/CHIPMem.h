@@ -234,5 +234,44 @@ inline bool MemoryDebugCheckPointer(const void * p, size_t min_size = 0)
 #endif // CHIP_CONFIG_MEMORY_DEBUG_CHECKS
 }
 
+#if CHIP_CONFIG_MEMORY_MGMT_SLAB
+
+/**
+ * Usage of one size class of the slab allocator (see #CHIP_CONFIG_MEMORY_MGMT_SLAB).
+ *
+ * The last size class, after all the slab size classes, accounts for the allocations too large for any slab. It
+ * has a zero blockSize and no slabs.
+ */
+struct MemorySlabStats
+{
+    size_t blockSize;       ///< Usable size of each block, zero for the large allocations.
+    size_t blocksPerSlab;   ///< Number of blocks in each slab.
+    size_t slabCount;       ///< Number of slabs currently allocated.
+    size_t blocksInUse;     ///< Number of blocks currently allocated.
+    size_t peakBlocksInUse; ///< Highest value of blocksInUse since MemoryInit().
+    size_t bytesRequested;  ///< Sum of the sizes requested for the blocks currently allocated.
+    size_t allocations;     ///< Number of allocations since MemoryInit().
+
+    /// Bytes lost to rounding the blocks in use up to the block size (internal fragmentation).
+    size_t RoundingBytes() const { return blockSize * blocksInUse - (blockSize > 0 ? bytesRequested : 0); }
+
+    /// Bytes of free blocks held in slabs, unusable by other size classes (external fragmentation).
+    size_t IdleBytes() const { return blockSize * (blocksPerSlab * slabCount - blocksInUse); }
+};
+
+/**
+ * Returns the number of size classes reported by MemorySlabGetStats(), including the large allocations.
+ */
+extern size_t MemorySlabClassCount();
+
+/**
+ * Copies the current usage of a size class to \a stats.
+ *
+ * @retval  #CHIP_ERROR_INVALID_ARGUMENT  If \a sizeClass is not less than MemorySlabClassCount().
+ */
+extern CHIP_ERROR MemorySlabGetStats(size_t sizeClass, MemorySlabStats & stats);
+
+#endif // CHIP_CONFIG_MEMORY_MGMT_SLAB
+
 } // namespace Platform
 } // namespace chip
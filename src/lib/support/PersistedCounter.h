@@ -213,7 +213,10 @@ private:
 #endif
 
         T valueLE = Encoding::LittleEndian::HostSwap<T>(aStartValue);
-        return mStorage->SyncSetKeyValue(mKey.KeyName(), &valueLE, sizeof(valueLE));
+        ReturnErrorOnFailure(mStorage->SyncSetKeyValue(mKey.KeyName(), &valueLE, sizeof(valueLE)));
+
+        // Values below the new epoch are handed out as soon as this returns, so it must not be lost on reboot.
+        return mStorage->SyncFlush();
     }
 
     /**
@@ -51,6 +51,27 @@ void HeapObjectPoolExitHandling::ExitHandler()
 
 namespace internal {
 
+namespace {
+
+/// Returns the index of the lowest set bit of a non-zero usage word.
+template <typename Word>
+inline size_t LowestSetBit(Word value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    static_assert(sizeof(Word) == sizeof(unsigned long), "Usage words are expected to be unsigned long");
+    return static_cast<size_t>(__builtin_ctzl(value));
+#else
+    size_t bit = 0;
+    for (; (value & 1) == 0; value >>= 1)
+    {
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+} // namespace
+
 StaticAllocatorBitmap::StaticAllocatorBitmap(void * storage, std::atomic<tBitChunkType> * usage, size_t capacity,
                                              size_t elementSize) :
     StaticAllocatorBase(capacity),
@@ -62,24 +83,35 @@ StaticAllocatorBitmap::StaticAllocatorBitmap(void * storage, std::atomic<tBitChu
     }
 }
 
+StaticAllocatorBitmap::tBitChunkType StaticAllocatorBitmap::UsableBits(size_t word) const
+{
+    const size_t remaining = Capacity() - word * kBitChunkSize;
+    return (remaining >= kBitChunkSize) ? ~tBitChunkType(0) : ((kBit1 << remaining) - 1);
+}
+
 void * StaticAllocatorBitmap::Allocate()
 {
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    const size_t wordCount = WordCount();
+    const size_t hint      = mFreeWordHint.load(std::memory_order_relaxed);
+
+    // Start from the word a slot was last released in (or allocated from), as it is the most likely to have room.
+    for (size_t i = 0; i < wordCount; ++i)
     {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+        const size_t word = (hint + i < wordCount) ? hint + i : hint + i - wordCount;
+        auto & usage      = mUsage[word];
+        auto value        = usage.load(std::memory_order_relaxed);
+        auto free         = ~value & UsableBits(word);
+        while (free != 0)
         {
-            if ((value & (kBit1 << offset)) == 0)
+            const size_t offset = LowestSetBit(free);
+            if (usage.compare_exchange_strong(value, value | (kBit1 << offset)))
             {
-                if (usage.compare_exchange_strong(value, value | (kBit1 << offset)))
-                {
-                    IncreaseUsage();
-                    return At(word * kBitChunkSize + offset);
-                }
-
-                value = usage.load(std::memory_order_relaxed); // if there is a race, update new usage
+                mFreeWordHint.store(word, std::memory_order_relaxed);
+                IncreaseUsage();
+                return At(word * kBitChunkSize + offset);
             }
+            // There was a race, value now holds the new usage.
+            free = ~value & UsableBits(word);
         }
     }
     return nullptr;
@@ -96,6 +128,7 @@ void StaticAllocatorBitmap::Deallocate(void * element)
 
     auto value = mUsage[word].fetch_and(~(kBit1 << offset));
     VerifyOrDie((value & (kBit1 << offset)) != 0); // assert fail when free an unused slot
+    mFreeWordHint.store(word, std::memory_order_relaxed);
     DecreaseUsage();
 }
 
@@ -111,17 +144,17 @@ size_t StaticAllocatorBitmap::IndexOf(void * element)
 
 Loop StaticAllocatorBitmap::ForEachActiveObjectInner(void * context, Lambda lambda)
 {
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    const size_t wordCount = WordCount();
+    for (size_t word = 0; word < wordCount; ++word)
     {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+        // Visit the slots active when the word is loaded, lowest first, skipping empty words altogether.
+        auto value = mUsage[word].load(std::memory_order_relaxed);
+        while (value != 0)
         {
-            if ((value & (kBit1 << offset)) != 0)
-            {
-                if (lambda(context, At(word * kBitChunkSize + offset)) == Loop::Break)
-                    return Loop::Break;
-            }
+            const size_t offset = LowestSetBit(value);
+            value &= value - 1;
+            if (lambda(context, At(word * kBitChunkSize + offset)) == Loop::Break)
+                return Loop::Break;
         }
     }
     return Loop::Finish;
@@ -129,42 +162,32 @@ Loop StaticAllocatorBitmap::ForEachActiveObjectInner(void * context, Lambda lamb
 
 size_t StaticAllocatorBitmap::FirstActiveIndex()
 {
-    size_t idx = 0;
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
-    {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
-        {
-            if ((value & (kBit1 << offset)) != 0)
-            {
-                return idx;
-            }
-            idx++;
-        }
-    }
-    VerifyOrDie(idx == mCapacity);
-    return mCapacity;
+    return NextActiveIndexFrom(0);
 }
 
 size_t StaticAllocatorBitmap::NextActiveIndexAfter(size_t start)
 {
-    size_t idx = 0;
-    for (size_t word = 0; word * kBitChunkSize < Capacity(); ++word)
+    VerifyOrReturnValue(start < mCapacity, mCapacity);
+    return NextActiveIndexFrom(start + 1);
+}
+
+size_t StaticAllocatorBitmap::NextActiveIndexFrom(size_t index)
+{
+    VerifyOrReturnValue(index < mCapacity, mCapacity);
+
+    const size_t wordCount = WordCount();
+    size_t word            = index / kBitChunkSize;
+    // Ignore the slots of the first word before index.
+    auto value = mUsage[word].load(std::memory_order_relaxed) & (~tBitChunkType(0) << (index - word * kBitChunkSize));
+    while (value == 0)
     {
-        auto & usage = mUsage[word];
-        auto value   = usage.load(std::memory_order_relaxed);
-        for (size_t offset = 0; offset < kBitChunkSize && offset + word * kBitChunkSize < Capacity(); ++offset)
+        if (++word == wordCount)
         {
-            if (((value & (kBit1 << offset)) != 0) && (start < idx))
-            {
-                return idx;
-            }
-            idx++;
+            return mCapacity;
         }
+        value = mUsage[word].load(std::memory_order_relaxed);
     }
-    VerifyOrDie(idx == mCapacity);
-    return mCapacity;
+    return word * kBitChunkSize + LowestSetBit(value);
 }
 
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
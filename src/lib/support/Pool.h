@@ -113,9 +113,14 @@ protected:
     }
 
 private:
+    size_t WordCount() const { return (Capacity() + kBitChunkSize - 1) / kBitChunkSize; }
+    tBitChunkType UsableBits(size_t word) const;
+    size_t NextActiveIndexFrom(size_t index);
+
     void * mElements;
     const size_t mElementSize;
     std::atomic<tBitChunkType> * mUsage;
+    std::atomic<size_t> mFreeWordHint{ 0 }; // word in which a slot was most recently released or allocated
 
     /// allow accessing direct At() calls
     template <class T>
@@ -256,6 +261,9 @@ private:
 /**
  * A class template used for allocating objects from a fixed-size static pool.
  *
+ * Objects are visited in slot order, which is not necessarily creation order: CreateObject() does not return the lowest
+ * free slot, but searches from the usage word in which a slot was most recently released or allocated.
+ *
  *  @tparam     T   type of element to be allocated.
  *  @tparam     N   a positive integer max number of elements the pool provides.
  */
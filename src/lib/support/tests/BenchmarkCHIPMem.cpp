@@ -0,0 +1,123 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Timing benchmark of chip::Platform memory allocation, replaying the
+ *      allocation trace of a wildcard read.
+ *
+ */
+
+#include <string.h>
+
+#include <chrono>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+using namespace chip;
+using namespace chip::Platform;
+
+class BenchmarkCHIPMem : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+namespace {
+
+// Allocation trace of a wildcard read of a small device: sizes are those of the objects the interaction model and
+// messaging layers allocate for it (message buffers, read handler and path lists, TLV scratch buffers), in order.
+// A zero size frees the block held in the slot.
+struct TraceEntry
+{
+    uint8_t slot;
+    uint16_t size;
+};
+
+constexpr TraceEntry kWildcardReadTrace[] = {
+    // Incoming ReadRequest, session lookup, exchange
+    { 0, 1318 }, { 1, 112 }, { 2, 48 }, { 3, 232 },
+    // Read handler and its attribute / event path lists
+    { 4, 600 }, { 5, 40 }, { 6, 40 }, { 7, 32 },
+    { 0, 0 },
+    // Report chunks: packet buffer, TLV scratch, attribute value encodings, released after each chunk is acked
+    { 8, 1318 }, { 9, 256 }, { 10, 24 }, { 11, 64 }, { 10, 0 }, { 11, 0 }, { 12, 136 }, { 12, 0 }, { 9, 0 },
+    { 13, 96 }, { 8, 0 }, { 13, 0 },
+    { 8, 1318 }, { 9, 256 }, { 10, 24 }, { 11, 72 }, { 10, 0 }, { 11, 0 }, { 12, 512 }, { 12, 0 }, { 9, 0 },
+    { 13, 96 }, { 8, 0 }, { 13, 0 },
+    { 8, 1318 }, { 9, 256 }, { 10, 16 }, { 11, 40 }, { 10, 0 }, { 11, 0 }, { 12, 200 }, { 12, 0 }, { 9, 0 },
+    { 13, 96 }, { 8, 0 }, { 13, 0 },
+    // Status response, interaction done
+    { 14, 1318 }, { 14, 0 },
+    { 7, 0 }, { 6, 0 }, { 5, 0 }, { 4, 0 }, { 3, 0 }, { 2, 0 }, { 1, 0 },
+};
+
+} // namespace
+
+TEST_F(BenchmarkCHIPMem, ReplayWildcardReadTrace)
+{
+    constexpr unsigned kIterations = 2000;
+    void * slots[16]               = {};
+
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < kIterations; i++)
+    {
+        for (const TraceEntry & entry : kWildcardReadTrace)
+        {
+            ASSERT_LT(entry.slot, ArraySize(slots));
+            if (entry.size == 0)
+            {
+                MemoryFree(slots[entry.slot]);
+                slots[entry.slot] = nullptr;
+            }
+            else
+            {
+                ASSERT_EQ(slots[entry.slot], nullptr);
+                slots[entry.slot] = MemoryAlloc(entry.size);
+                ASSERT_NE(slots[entry.slot], nullptr);
+                memset(slots[entry.slot], entry.slot, entry.size);
+            }
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    for (void * slot : slots)
+    {
+        EXPECT_EQ(slot, nullptr);
+    }
+
+    ChipLogProgress(Support, "Replayed %u wildcard read allocation traces in %u us", kIterations,
+                    static_cast<unsigned>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()));
+
+#if CHIP_CONFIG_MEMORY_MGMT_SLAB
+    for (size_t i = 0; i < MemorySlabClassCount(); i++)
+    {
+        MemorySlabStats stats;
+        EXPECT_EQ(MemorySlabGetStats(i, stats), CHIP_NO_ERROR);
+        ChipLogProgress(Support, "Size class %u: %u slabs, peak %u blocks, %u allocations, %u idle bytes",
+                        static_cast<unsigned>(stats.blockSize), static_cast<unsigned>(stats.slabCount),
+                        static_cast<unsigned>(stats.peakBlocksInUse), static_cast<unsigned>(stats.allocations),
+                        static_cast<unsigned>(stats.IdleBytes()));
+    }
+#endif // CHIP_CONFIG_MEMORY_MGMT_SLAB
+}
@@ -170,3 +170,70 @@ TEST_F(TestCHIPMem, TestMemAlloc_SharedPtr)
     EXPECT_EQ(otherInstanceConstructorCalled, 1);
     EXPECT_EQ(otherInstanceDestructorCalled, 0);
 }
+
+#if CHIP_CONFIG_MEMORY_MGMT_SLAB
+
+TEST_F(TestCHIPMem, TestMemAlloc_SlabStats)
+{
+    const size_t largeClass = MemorySlabClassCount() - 1;
+
+    // Find the size class of 40 byte allocations from its usage.
+    MemorySlabStats before[16];
+    ASSERT_LE(MemorySlabClassCount(), ArraySize(before));
+    for (size_t i = 0; i < MemorySlabClassCount(); i++)
+    {
+        EXPECT_EQ(MemorySlabGetStats(i, before[i]), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(MemorySlabGetStats(MemorySlabClassCount(), before[0]), CHIP_ERROR_INVALID_ARGUMENT);
+
+    void * small = MemoryAlloc(40);
+    void * large = MemoryAlloc(4000);
+    ASSERT_NE(small, nullptr);
+    ASSERT_NE(large, nullptr);
+
+    size_t smallClass = largeClass;
+    MemorySlabStats stats;
+    for (size_t i = 0; i < largeClass; i++)
+    {
+        EXPECT_EQ(MemorySlabGetStats(i, stats), CHIP_NO_ERROR);
+        if (stats.blocksInUse != before[i].blocksInUse)
+        {
+            EXPECT_EQ(smallClass, largeClass);
+            smallClass = i;
+        }
+    }
+    ASSERT_LT(smallClass, largeClass);
+
+    EXPECT_EQ(MemorySlabGetStats(smallClass, stats), CHIP_NO_ERROR);
+    EXPECT_GE(stats.blockSize, 40u);
+    EXPECT_GE(stats.slabCount, 1u);
+    EXPECT_EQ(stats.blocksInUse, before[smallClass].blocksInUse + 1);
+    EXPECT_EQ(stats.bytesRequested, before[smallClass].bytesRequested + 40);
+    EXPECT_EQ(stats.RoundingBytes(), before[smallClass].RoundingBytes() + stats.blockSize - 40);
+    EXPECT_LE(stats.IdleBytes(), stats.blockSize * stats.blocksPerSlab * stats.slabCount);
+
+    EXPECT_EQ(MemorySlabGetStats(largeClass, stats), CHIP_NO_ERROR);
+    EXPECT_EQ(stats.blockSize, 0u);
+    EXPECT_EQ(stats.blocksInUse, before[largeClass].blocksInUse + 1);
+    EXPECT_EQ(stats.bytesRequested, before[largeClass].bytesRequested + 4000);
+
+    // Growing within the block keeps it.
+    EXPECT_EQ(MemoryRealloc(small, 48), small);
+    memset(small, 0x5a, 48);
+
+    // A freed block is the next one handed out for its size class.
+    MemoryFree(small);
+    void * again = MemoryAlloc(33);
+    EXPECT_EQ(again, small);
+
+    MemoryFree(again);
+    MemoryFree(large);
+    for (size_t i = 0; i < MemorySlabClassCount(); i++)
+    {
+        EXPECT_EQ(MemorySlabGetStats(i, stats), CHIP_NO_ERROR);
+        EXPECT_EQ(stats.blocksInUse, before[i].blocksInUse);
+        EXPECT_EQ(stats.bytesRequested, before[i].bytesRequested);
+    }
+}
+
+#endif // CHIP_CONFIG_MEMORY_MGMT_SLAB
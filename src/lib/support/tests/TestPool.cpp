@@ -23,7 +23,9 @@
  *
  */
 
+#include <algorithm>
 #include <set>
+#include <vector>
 
 #include <pw_unit_test/framework.h>
 
@@ -471,6 +473,93 @@ void TestForEachActiveObject()
     pool.ReleaseAll();
 }
 
+TEST_F(TestPool, TestSparseIterationStatic)
+{
+    // Spans several usage words, with a partial last word.
+    constexpr size_t kSize = 200;
+    ObjectPool<size_t, kSize, ObjectPoolMem::kInline> pool;
+    size_t * objs[kSize];
+
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        objs[i] = pool.CreateObject(i);
+        ASSERT_NE(objs[i], nullptr);
+    }
+    EXPECT_EQ(pool.CreateObject(kSize), nullptr);
+
+    // Keep a few objects in the first and last words only, and a lone one in the middle.
+    std::vector<size_t> kept = { 0, 3, 63, 100, 192, 199 };
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        if (std::find(kept.begin(), kept.end(), i) == kept.end())
+        {
+            pool.ReleaseObject(objs[i]);
+        }
+    }
+
+    std::vector<size_t> visited;
+    pool.ForEachActiveObject([&visited](size_t * object) {
+        visited.push_back(*object);
+        return Loop::Continue;
+    });
+    EXPECT_EQ(visited, kept);
+
+    visited.clear();
+    for (size_t * object : pool)
+    {
+        visited.push_back(*object);
+    }
+    EXPECT_EQ(visited, kept);
+
+    // Released slots are found again wherever they are, up to the capacity.
+    for (size_t i = kept.size(); i < kSize; ++i)
+    {
+        EXPECT_NE(pool.CreateObject(i), nullptr);
+    }
+    EXPECT_EQ(pool.CreateObject(kSize), nullptr);
+    EXPECT_EQ(GetNumObjectsInUse(pool), kSize);
+
+    pool.ReleaseAll();
+}
+
+TEST_F(TestPool, TestAllocationStartsAtLastUsedWordStatic)
+{
+    // Two usage words.
+    constexpr size_t kSize = 2 * sizeof(unsigned long) * 8;
+    ObjectPool<size_t, kSize, ObjectPoolMem::kInline> pool;
+    size_t * objs[kSize];
+
+    for (size_t i = 0; i < kSize; ++i)
+    {
+        objs[i] = pool.CreateObject(i);
+        ASSERT_NE(objs[i], nullptr);
+    }
+
+    // Free a slot in each word, the one in the second word last.
+    constexpr size_t kLow  = 5;
+    constexpr size_t kHigh = kSize - 3;
+    pool.ReleaseObject(objs[kLow]);
+    pool.ReleaseObject(objs[kHigh]);
+
+    // The search starts at the word of the most recently released slot, not at the lowest free slot.
+    objs[kHigh] = pool.CreateObject(kSize);
+    objs[kLow]  = pool.CreateObject(kSize + 1);
+    EXPECT_EQ(pool.CreateObject(kSize + 2), nullptr);
+
+    // Iteration is in slot order, so the newer object is visited first.
+    std::vector<size_t> visited;
+    pool.ForEachActiveObject([&visited](size_t * object) {
+        if (*object >= kSize)
+        {
+            visited.push_back(*object);
+        }
+        return Loop::Continue;
+    });
+    EXPECT_EQ(visited, (std::vector<size_t>{ kSize + 1, kSize }));
+
+    pool.ReleaseAll();
+}
+
 TEST_F(TestPool, TestForEachActiveObjectStatic)
 {
     TestForEachActiveObject<ObjectPoolMem::kInline>();
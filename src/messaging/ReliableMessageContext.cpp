@@ -41,7 +41,9 @@ using namespace chip::DeviceLayer;
 namespace chip {
 namespace Messaging {
 
-ReliableMessageContext::ReliableMessageContext() : mNextAckTime(0), mPendingPeerAckMessageCounter(0) {}
+ReliableMessageContext::ReliableMessageContext() :
+    mNextAckTime(0), mPendingPeerAckMessageCounter(0), mRetransQueueIndex(kNotInRetransQueue)
+{}
 
 ExchangeContext * ReliableMessageContext::GetExchangeContext()
 {
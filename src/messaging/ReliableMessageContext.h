@@ -214,8 +214,11 @@ private:
     friend class ::chip::app::TestReadInteraction;
     friend class ::chip::app::TestWriteInteraction;
 
+    static constexpr uint16_t kNotInRetransQueue = UINT16_MAX;
+
     System::Clock::Timestamp mNextAckTime; // Next time for triggering Solo Ack
     uint32_t mPendingPeerAckMessageCounter;
+    uint16_t mRetransQueueIndex; // Position of our retransmission entry in the ReliableMessageMgr queue, if any
 };
 
 inline bool ReliableMessageContext::AutoRequestAck() const
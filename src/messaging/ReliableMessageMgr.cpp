@@ -21,11 +21,13 @@
  *
  */
 
+#include <algorithm>
 #include <errno.h>
 #include <inttypes.h>
 
 #include <app/icd/server/ICDServerConfig.h>
 #include <lib/support/BitFlags.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CHIPFaultInjection.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
@@ -51,7 +53,7 @@ namespace Messaging {
 System::Clock::Timeout ReliableMessageMgr::sAdditionalMRPBackoffTime = CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST;
 
 ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
-    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
+    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0), scheduleSequence(0)
 {
     ec->SetWaitingForAck(true);
 }
@@ -78,10 +80,16 @@ void ReliableMessageMgr::Shutdown()
 
     // Clear the retransmit table
     mRetransTable.ForEachActiveObject([&](auto * entry) {
-        mRetransTable.ReleaseObject(entry);
+        ReleaseRetransEntry(*entry);
         return Loop::Continue;
     });
 
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    Platform::MemoryFree(mRetransQueue);
+    mRetransQueue         = nullptr;
+    mRetransQueueCapacity = 0;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
     mSystemLayer = nullptr;
 }
 
@@ -122,11 +130,13 @@ void ReliableMessageMgr::ExecuteActions()
         }
     });
 
-    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime > now)
-            return Loop::Continue;
-
+    // Retransmit / cancel anything in the retrans table whose retrans timeout has expired, in retrans time order. Entries
+    // rescheduled by this pass are not processed again by it, even if their new retrans time has already expired.
+    const uint32_t passSequence = mRetransScheduleSequence;
+    RetransTableEntry * entry;
+    while (((entry = RetransQueueTop()) != nullptr) && (entry->nextRetransTime <= now) &&
+           (static_cast<int32_t>(entry->scheduleSequence - passSequence) < 0))
+    {
         VerifyOrDie(!entry->retainedBuf.IsNull());
 
         // Don't check whether the session in the exchange is valid, because when the session is released, the retrans entry is
@@ -168,9 +178,9 @@ void ReliableMessageMgr::ExecuteActions()
             }
 
             // Do not StartTimer, we will schedule the timer at the end of the timer handler.
-            mRetransTable.ReleaseObject(entry);
+            ReleaseRetransEntry(*entry);
 
-            return Loop::Continue;
+            continue;
         }
 
         entry->sendCount++;
@@ -184,9 +194,7 @@ void ReliableMessageMgr::ExecuteActions()
 
         CalculateNextRetransTime(*entry);
         SendFromRetransTable(entry);
-
-        return Loop::Continue;
-    });
+    }
 
     TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
 }
@@ -212,13 +220,15 @@ CHIP_ERROR ReliableMessageMgr::AddToRetransTable(ReliableMessageContext * rc, Re
 {
     VerifyOrReturnError(!rc->IsWaitingForAck(), CHIP_ERROR_INCORRECT_STATE);
 
-    *rEntry = mRetransTable.CreateObject(rc);
+    *rEntry = RetransQueueReserve() ? mRetransTable.CreateObject(rc) : nullptr;
     if (*rEntry == nullptr)
     {
         ChipLogError(ExchangeManager, "mRetransTable Already Full");
         return CHIP_ERROR_RETRANS_TABLE_FULL;
     }
 
+    RetransQueuePush(**rEntry);
+
     return CHIP_NO_ERROR;
 }
 
@@ -285,30 +295,36 @@ System::Clock::Timeout ReliableMessageMgr::GetBackoff(System::Clock::Timeout bas
 
 void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
 {
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+    entry->firstSendTime = System::SystemClock().GetMonotonicTimestamp();
+#endif
     CalculateNextRetransTime(*entry);
     StartTimer();
 }
 
 bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, uint32_t ackMessageCounter)
 {
-    bool removed = false;
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
-        {
-            // Clear the entry from the retransmision table.
-            ClearRetransTable(*entry);
-
-            ChipLogDetail(ExchangeManager,
-                          "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
-                          " from Retrans Table on exchange " ChipLogFormatExchange,
-                          ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
-            removed = true;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    VerifyOrReturnValue(rc->mRetransQueueIndex != ReliableMessageContext::kNotInRetransQueue, false);
+
+    RetransTableEntry * entry = mRetransQueue[rc->mRetransQueueIndex];
+    VerifyOrReturnValue(entry->retainedBuf.GetMessageCounter() == ackMessageCounter, false);
+
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+    // Per Karn's algorithm, the ack of a retransmitted message says nothing about the round-trip time.
+    if (entry->sendCount == 0)
+    {
+        SampleRoundTripTime(*entry);
+    }
+#endif
+
+    // Clear the entry from the retransmision table.
+    ClearRetransTable(*entry);
 
-    return removed;
+    ChipLogDetail(ExchangeManager,
+                  "Rxd Ack; Removing MessageCounter:" ChipLogFormatMessageCounter
+                  " from Retrans Table on exchange " ChipLogFormatExchange,
+                  ackMessageCounter, ChipLogValueExchange(rc->GetExchangeContext()));
+    return true;
 }
 
 CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
@@ -367,23 +383,25 @@ CHIP_ERROR ReliableMessageMgr::SendFromRetransTable(RetransTableEntry * entry)
 
 void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 {
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->ec->GetReliableMessageContext() == rc)
-        {
-            ClearRetransTable(*entry);
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
+    if (rc->mRetransQueueIndex != ReliableMessageContext::kNotInRetransQueue)
+    {
+        ClearRetransTable(*mRetransQueue[rc->mRetransQueueIndex]);
+    }
 }
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
-    mRetransTable.ReleaseObject(&entry);
+    ReleaseRetransEntry(entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
 }
 
+void ReliableMessageMgr::ReleaseRetransEntry(RetransTableEntry & entry)
+{
+    RetransQueueRemove(entry);
+    mRetransTable.ReleaseObject(&entry);
+}
+
 void ReliableMessageMgr::StartTimer()
 {
     // When do we need to next wake up to send an ACK?
@@ -397,13 +415,11 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
-    mRetransTable.ForEachActiveObject([&](auto * entry) {
-        if (entry->nextRetransTime < nextWakeTime)
-        {
-            nextWakeTime = entry->nextRetransTime;
-        }
-        return Loop::Continue;
-    });
+    const RetransTableEntry * nextRetrans = RetransQueueTop();
+    if ((nextRetrans != nullptr) && (nextRetrans->nextRetransTime < nextWakeTime))
+    {
+        nextWakeTime = nextRetrans->nextRetransTime;
+    }
 
     StopTimer();
 
@@ -473,6 +489,23 @@ void ReliableMessageMgr::SetAdditionalMRPBackoffTime(const Optional<System::Cloc
     sAdditionalMRPBackoffTime = additionalTime.ValueOr(CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST);
 }
 
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+void ReliableMessageMgr::SampleRoundTripTime(const RetransTableEntry & entry)
+{
+    VerifyOrReturn(entry.ec->HasSessionHandle());
+    const auto sessionHandle = entry.ec->GetSessionHandle();
+    VerifyOrReturn(sessionHandle->IsSecureSession());
+
+    const auto roundTripTime = std::chrono::duration_cast<System::Clock::Milliseconds32>(
+        System::SystemClock().GetMonotonicTimestamp() - entry.firstSendTime);
+    RoundTripTimeEstimator & estimator = sessionHandle->AsSecureSession()->GetRoundTripTimeEstimator();
+    estimator.AddSample(roundTripTime);
+
+    MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRoundTripTime, roundTripTime.count());
+    MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPSmoothedRoundTripTime, estimator.GetSmoothedRoundTripTime().count());
+}
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+
 void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
 {
     System::Clock::Timeout baseTimeout = System::Clock::Timeout(0);
@@ -482,7 +515,8 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
     if (entry.ec->HasReceivedAtLeastOneMessage())
     {
         // If we have received at least one message, assume peer is active and use ActiveRetransTimeout
-        baseTimeout = sessionHandle->GetRemoteMRPConfig().mActiveRetransTimeout;
+        baseTimeout = sessionHandle->IsSecureSession() ? sessionHandle->AsSecureSession()->GetActiveRetransTimeout()
+                                                       : sessionHandle->GetRemoteMRPConfig().mActiveRetransTimeout;
     }
     else
     {
@@ -493,6 +527,7 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
 
     System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
     entry.nextRetransTime          = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    RetransQueueUpdate(entry);
 
 #if CHIP_PROGRESS_LOGGING
     const auto config       = sessionHandle->GetRemoteMRPConfig();
@@ -522,6 +557,124 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
 #endif // CHIP_PROGRESS_LOGGING
 }
 
+bool ReliableMessageMgr::IsScheduledBefore(const RetransTableEntry & a, const RetransTableEntry & b)
+{
+    if (a.nextRetransTime != b.nextRetransTime)
+    {
+        return a.nextRetransTime < b.nextRetransTime;
+    }
+    // Sequence numbers may wrap around, but live entries are never 2^31 schedulings apart.
+    return static_cast<int32_t>(a.scheduleSequence - b.scheduleSequence) < 0;
+}
+
+uint16_t & ReliableMessageMgr::RetransQueueIndexOf(RetransTableEntry & entry)
+{
+    return entry.ec->GetReliableMessageContext()->mRetransQueueIndex;
+}
+
+bool ReliableMessageMgr::RetransQueueReserve()
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    VerifyOrReturnValue(mRetransQueueSize == mRetransQueueCapacity, true);
+
+    // kNotInRetransQueue is not a valid position.
+    constexpr size_t kMaxCapacity = ReliableMessageContext::kNotInRetransQueue;
+    VerifyOrReturnValue(mRetransQueueCapacity < kMaxCapacity, false);
+
+    const size_t newCapacity = std::min(std::max(2 * mRetransQueueCapacity, kRetransQueueCapacity), kMaxCapacity);
+    auto * newQueue =
+        static_cast<RetransTableEntry **>(Platform::MemoryRealloc(mRetransQueue, newCapacity * sizeof(*mRetransQueue)));
+    VerifyOrReturnValue(newQueue != nullptr, false);
+
+    mRetransQueue         = newQueue;
+    mRetransQueueCapacity = newCapacity;
+    return true;
+#else
+    return mRetransQueueSize < kRetransQueueCapacity;
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+}
+
+void ReliableMessageMgr::RetransQueuePush(RetransTableEntry & entry)
+{
+    VerifyOrDie(RetransQueueReserve());
+
+    entry.scheduleSequence = mRetransScheduleSequence++;
+    RetransQueuePlace(mRetransQueueSize, &entry);
+    RetransQueueSiftUp(mRetransQueueSize++);
+}
+
+void ReliableMessageMgr::RetransQueueRemove(RetransTableEntry & entry)
+{
+    const size_t index = RetransQueueIndexOf(entry);
+    VerifyOrDie((index < mRetransQueueSize) && (mRetransQueue[index] == &entry));
+
+    RetransQueueIndexOf(entry) = ReliableMessageContext::kNotInRetransQueue;
+    mRetransQueueSize--;
+    if (index != mRetransQueueSize)
+    {
+        // Move the last entry into the hole, then restore the heap order from there.
+        RetransQueuePlace(index, mRetransQueue[mRetransQueueSize]);
+        RetransQueueSiftDown(RetransQueueSiftUp(index));
+    }
+}
+
+void ReliableMessageMgr::RetransQueueUpdate(RetransTableEntry & entry)
+{
+    const size_t index = RetransQueueIndexOf(entry);
+    VerifyOrDie((index < mRetransQueueSize) && (mRetransQueue[index] == &entry));
+
+    entry.scheduleSequence = mRetransScheduleSequence++;
+    RetransQueueSiftDown(RetransQueueSiftUp(index));
+}
+
+void ReliableMessageMgr::RetransQueuePlace(size_t index, RetransTableEntry * entry)
+{
+    mRetransQueue[index] = entry;
+    RetransQueueIndexOf(*entry) = static_cast<uint16_t>(index);
+}
+
+size_t ReliableMessageMgr::RetransQueueSiftUp(size_t index)
+{
+    RetransTableEntry * entry = mRetransQueue[index];
+    while (index > 0)
+    {
+        const size_t parent = (index - 1) / 2;
+        if (!IsScheduledBefore(*entry, *mRetransQueue[parent]))
+        {
+            break;
+        }
+        RetransQueuePlace(index, mRetransQueue[parent]);
+        index = parent;
+    }
+    RetransQueuePlace(index, entry);
+    return index;
+}
+
+size_t ReliableMessageMgr::RetransQueueSiftDown(size_t index)
+{
+    RetransTableEntry * entry = mRetransQueue[index];
+    while (true)
+    {
+        size_t child = 2 * index + 1;
+        if (child >= mRetransQueueSize)
+        {
+            break;
+        }
+        if ((child + 1 < mRetransQueueSize) && IsScheduledBefore(*mRetransQueue[child + 1], *mRetransQueue[child]))
+        {
+            child++;
+        }
+        if (!IsScheduledBefore(*mRetransQueue[child], *entry))
+        {
+            break;
+        }
+        RetransQueuePlace(index, mRetransQueue[child]);
+        index = child;
+    }
+    RetransQueuePlace(index, entry);
+    return index;
+}
+
 #if CHIP_CONFIG_TEST
 int ReliableMessageMgr::TestGetCountRetransTable()
 {
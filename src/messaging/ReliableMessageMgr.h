@@ -55,6 +55,10 @@ public:
      *    acknowledgment back. If the acknowledgment is not received within a
      *    specific timeout, the message would be retransmitted from this table.
      *
+     *    Entries are also kept in a queue ordered by their next retransmission
+     *    time, so that the manager does not need to scan the table to find the
+     *    entries that are due.
+     *
      */
     struct RetransTableEntry
     {
@@ -66,6 +70,10 @@ public:
         System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
         uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
                                                        including both successfully and failure send. */
+        uint32_t scheduleSequence;                /**< Order in which nextRetransTime was set, breaks ties in the queue. */
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+        System::Clock::Timestamp firstSendTime; /**< Time of the initial transmission, to measure the round-trip time. */
+#endif
     };
 
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
@@ -125,8 +133,8 @@ public:
     void StartRetransmision(RetransTableEntry * entry);
 
     /**
-     *  Iterate through active exchange contexts and retrans table entries. Clear the entry matching
-     *  the specified ExchangeContext and the message ID from the retransmision table.
+     *  Clear the entry matching the specified ExchangeContext and the message ID from the retransmision table.
+     *  The entry of an exchange is found directly from the exchange, without scanning the table.
      *
      *  @param[in]    rc                 A pointer to the ExchangeContext object.
      *  @param[in]    ackMessageCounter  The acknowledged message counter of the received packet.
@@ -230,6 +238,41 @@ private:
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+    /**
+     * Adds the round-trip time of an entry acknowledged on its first transmission to the estimator of its session.
+     */
+    void SampleRoundTripTime(const RetransTableEntry & entry);
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+
+    /**
+     * Removes the entry from the retransmission queue and releases it, without restarting the timer.
+     */
+    void ReleaseRetransEntry(RetransTableEntry & entry);
+
+    // Retransmission queue: a binary min-heap of the retransmission table entries, ordered by
+    // nextRetransTime and then scheduleSequence. Each exchange records the position of its entry
+    // (there is at most one per exchange) in ReliableMessageContext::mRetransQueueIndex.
+    //
+    // With static pools the queue has one slot per table entry. With heap pools the table is not
+    // bounded, so the queue starts at that size and grows as needed.
+    static constexpr size_t kRetransQueueCapacity = CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE;
+    static_assert(kRetransQueueCapacity < ReliableMessageContext::kNotInRetransQueue, "Retransmission queue index overflow");
+
+    static bool IsScheduledBefore(const RetransTableEntry & a, const RetransTableEntry & b);
+    static uint16_t & RetransQueueIndexOf(RetransTableEntry & entry);
+    /**
+     * Makes room in the retransmission queue for one more entry, if possible.
+     */
+    bool RetransQueueReserve();
+    RetransTableEntry * RetransQueueTop() const { return (mRetransQueueSize > 0) ? mRetransQueue[0] : nullptr; }
+    void RetransQueuePush(RetransTableEntry & entry);
+    void RetransQueueRemove(RetransTableEntry & entry);
+    void RetransQueueUpdate(RetransTableEntry & entry);
+    void RetransQueuePlace(size_t index, RetransTableEntry * entry);
+    size_t RetransQueueSiftUp(size_t index);
+    size_t RetransQueueSiftDown(size_t index);
+
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
     chip::System::Layer * mSystemLayer;
 
@@ -247,6 +290,14 @@ private:
 
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    RetransTableEntry ** mRetransQueue = nullptr;
+    size_t mRetransQueueCapacity       = 0;
+#else
+    RetransTableEntry * mRetransQueue[kRetransQueueCapacity];
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    size_t mRetransQueueSize          = 0;
+    uint32_t mRetransScheduleSequence = 0;
 
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 
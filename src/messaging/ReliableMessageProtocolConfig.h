@@ -183,6 +183,32 @@ namespace chip {
 #endif
 #endif // CHIP_CONFIG_MRP_RETRY_INTERVAL_SENDER_BOOST
 
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+ *
+ *  @brief
+ *    Derive the base retransmission interval for an active peer from the round-trip
+ *    times measured on the secure session, rather than only from the active interval
+ *    advertised by the peer.
+ *
+ *  Round-trip times are sampled from messages acknowledged on their first
+ *  transmission (Karn's algorithm) and smoothed as in RFC 6298. The resulting
+ *  interval is never shorter than the active interval advertised by the peer, which
+ *  is the minimum time between retries the peer allows, nor longer than its
+ *  advertised idle interval. The backoff, margin and jitter of the spec still apply
+ *  on top of it, and ack timeouts of the session use the same interval. Sleepy
+ *  (idle) peers always use their advertised idle interval.
+ *
+ *  Because of that floor, measured round-trip times can only lengthen the interval
+ *  (back off); they never shorten it. Nodes on fast links (Wi-Fi, Ethernet) whose
+ *  peers advertise conservative intervals do not retransmit any sooner with this
+ *  option. It helps on high-latency links (e.g. multi-hop Thread routes), where
+ *  retransmitting after the advertised active interval mostly produces duplicates.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+#define CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL 0
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+
 inline constexpr System::Clock::Milliseconds32 kDefaultActiveTime = System::Clock::Milliseconds16(4000);
 
 /**
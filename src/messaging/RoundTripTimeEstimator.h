@@ -0,0 +1,113 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <messaging/ReliableMessageProtocolConfig.h>
+#include <system/SystemClock.h>
+
+#include <algorithm>
+#include <stdint.h>
+
+namespace chip {
+
+/**
+ * Smoothed round-trip time (SRTT) and round-trip time variation (RTTVAR) of a session, computed as in
+ * RFC 6298 section 2, and the MRP base retransmission interval derived from them.
+ *
+ * Only round-trip times of messages acknowledged on their first transmission must be added (Karn's
+ * algorithm): the acknowledgement of a retransmitted message cannot be matched to one transmission.
+ */
+class RoundTripTimeEstimator
+{
+public:
+    /// Adds a measured round-trip time.
+    void AddSample(System::Clock::Milliseconds32 roundTripTime)
+    {
+        // Bounded so that the scaled values fit in 32 bits.
+        const int64_t sample = std::min<int64_t>(roundTripTime.count(), kMaxSample);
+
+        if (mSampleCount == 0)
+        {
+            // SRTT = R, RTTVAR = R / 2
+            mScaledSrtt   = static_cast<uint32_t>(sample * kSrttScale);
+            mScaledRttVar = static_cast<uint32_t>(sample * kRttVarScale / 2);
+        }
+        else
+        {
+            // RTTVAR = 3/4 RTTVAR + 1/4 |SRTT - R|, then SRTT = 7/8 SRTT + 1/8 R
+            const int64_t delta = sample - mScaledSrtt / kSrttScale;
+            mScaledRttVar = static_cast<uint32_t>(mScaledRttVar + ((delta < 0) ? -delta : delta) - mScaledRttVar / kRttVarScale);
+            mScaledSrtt   = static_cast<uint32_t>(mScaledSrtt + delta);
+        }
+
+        if (mSampleCount < UINT32_MAX)
+        {
+            mSampleCount++;
+        }
+    }
+
+    void Reset() { *this = RoundTripTimeEstimator(); }
+
+    bool HasEstimate() const { return mSampleCount > 0; }
+
+    uint32_t GetSampleCount() const { return mSampleCount; }
+
+    System::Clock::Milliseconds32 GetSmoothedRoundTripTime() const
+    {
+        return System::Clock::Milliseconds32(mScaledSrtt / kSrttScale);
+    }
+
+    System::Clock::Milliseconds32 GetRoundTripTimeVariation() const
+    {
+        return System::Clock::Milliseconds32(mScaledRttVar / kRttVarScale);
+    }
+
+    /**
+     * Returns the base retransmission interval to use for an active peer that advertised the given active
+     * and idle intervals: SRTT + 4 * RTTVAR, bounded below by activeInterval (the shortest interval the peer
+     * allows) and above by idleInterval. Returns activeInterval if no round-trip time was measured yet.
+     *
+     * The estimate can therefore only back off from the advertised active interval: a round trip faster than
+     * that interval does not shorten retransmission waits.
+     */
+    System::Clock::Milliseconds32 GetBaseRetransTimeout(System::Clock::Milliseconds32 activeInterval,
+                                                        System::Clock::Milliseconds32 idleInterval) const
+    {
+        if (!HasEstimate())
+        {
+            return activeInterval;
+        }
+
+        // RTTVAR is kept scaled by 4, which is its weight in the timeout.
+        const int64_t timeout = std::min<int64_t>(int64_t{ mScaledSrtt / kSrttScale } + mScaledRttVar, UINT32_MAX);
+        return std::clamp(System::Clock::Milliseconds32(static_cast<uint32_t>(timeout)), activeInterval,
+                          std::max(activeInterval, idleInterval));
+    }
+
+private:
+    // Scaled as in the classic BSD implementation, so that the 1/8 and 1/4 gains do not lose precision.
+    static constexpr uint32_t kSrttScale   = 8;
+    static constexpr uint32_t kRttVarScale = 4;
+    static constexpr int64_t kMaxSample    = UINT32_MAX / (kSrttScale * kRttVarScale);
+
+    uint32_t mScaledSrtt   = 0;
+    uint32_t mScaledRttVar = 0;
+    uint32_t mSampleCount  = 0;
+};
+
+} // namespace chip
@@ -0,0 +1,123 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Timing benchmark of the MRP retransmission queue with many concurrent
+ *      exchanges on a lossy link.
+ */
+
+#include <ctime>
+#include <inttypes.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeMgr.h>
+#include <messaging/ReliableMessageMgr.h>
+#include <messaging/tests/MessagingContext.h>
+#include <protocols/echo/Echo.h>
+#include <system/SystemConfig.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Messaging;
+using namespace chip::Protocols;
+using namespace chip::System::Clock::Literals;
+
+const char PAYLOAD[] = "Hello!";
+
+class BenchmarkReliableMessageProtocol : public chip::Test::LoopbackMessagingContext
+{
+};
+
+class SenderDelegate : public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+};
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+/**
+ * Sends one message on each of @a exchangeCount exchanges, drops the first @a lostAttempts transmissions of every
+ * message, and logs how long the retransmission queue took to get them all acknowledged. The CPU time is what the
+ * queue costs; the wall time is dominated by the retransmission intervals.
+ */
+void DeliverUnderLoss(BenchmarkReliableMessageProtocol & ctx, size_t exchangeCount, size_t lostAttempts)
+{
+    SenderDelegate sender;
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    ctx.GetSessionBobToAlice()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        64_ms32, // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        64_ms32, // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+
+    auto & loopback               = ctx.GetLoopback();
+    loopback.mNumMessagesToDrop   = static_cast<uint32_t>(exchangeCount * lostAttempts);
+    loopback.mDroppedMessageCount = 0;
+
+    const std::clock_t startCpu                  = std::clock();
+    const System::Clock::Timestamp startWallTime = System::SystemClock().GetMonotonicTimestamp();
+    for (size_t i = 0; i < exchangeCount; i++)
+    {
+        System::PacketBufferHandle buffer = MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        ASSERT_FALSE(buffer.IsNull());
+
+        ExchangeContext * exchange = ctx.NewExchangeToAlice(&sender);
+        ASSERT_NE(exchange, nullptr);
+        ASSERT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)), CHIP_NO_ERROR);
+    }
+    ctx.DrainAndServiceIO();
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(exchangeCount));
+
+    ctx.GetIOContext().DriveIOUntil(30000_ms32, [&] { return rm->TestGetCountRetransTable() == 0; });
+    ctx.DrainAndServiceIO();
+
+    const System::Clock::Milliseconds64 wallTime = System::SystemClock().GetMonotonicTimestamp() - startWallTime;
+    const std::clock_t cpuTime                   = std::clock() - startCpu;
+
+    EXPECT_EQ(loopback.mDroppedMessageCount, exchangeCount * lostAttempts);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    ChipLogProgress(Test, "%u exchanges, %u lost attempts each: %" PRIu64 " ms wall, %" PRIu64 " ms CPU",
+                    static_cast<unsigned>(exchangeCount), static_cast<unsigned>(lostAttempts), wallTime.count(),
+                    static_cast<uint64_t>(cpuTime) * 1000 / CLOCKS_PER_SEC);
+}
+
+TEST_F(BenchmarkReliableMessageProtocol, RetransmitQueueUnderLoss)
+{
+    for (size_t exchangeCount : { 64, 256, 1024, 4096 })
+    {
+        DeliverUnderLoss(*this, exchangeCount, 2);
+    }
+}
+
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+} // namespace
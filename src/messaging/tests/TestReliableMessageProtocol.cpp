@@ -563,6 +563,148 @@ TEST_F(TestReliableMessageProtocol, CheckCloseExchangeAndResendApplicationMessag
     EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
 }
 
+/**
+ * Simulates loss on many concurrent exchanges: the initial message and the first retransmission of every exchange are
+ * dropped, and the retransmission queue must then deliver every message on its third attempt.
+ *
+ * With heap pools the retransmission table is not bounded, so this uses more exchanges than
+ * CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE. Otherwise it uses as many as the exchange pool allows (half of it, the other half
+ * being used by the receiving side). See BenchmarkReliableMessageProtocol for timings at higher exchange counts.
+ */
+TEST_F(TestReliableMessageProtocol, CheckRetransmitQueueUnderLoss)
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    constexpr size_t kExchangeCount = 2 * CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE;
+#else
+    constexpr size_t kExchangeCount = std::min<size_t>(CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS / 2, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE);
+#endif
+    constexpr size_t kLostAttempts = 2;
+
+    MockAppDelegate mockSender(*this);
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    GetSessionBobToAlice()->AsSecureSession()->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        64_ms32, // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        64_ms32, // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = static_cast<uint32_t>(kExchangeCount * kLostAttempts);
+    loopback.mDroppedMessageCount = 0;
+
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    for (size_t i = 0; i < kExchangeCount; i++)
+    {
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        ASSERT_FALSE(buffer.IsNull());
+
+        ExchangeContext * exchange = NewExchangeToAlice(&mockSender);
+        ASSERT_NE(exchange, nullptr);
+
+        // No response is expected, so the exchange closes itself once the message is acknowledged.
+        EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)), CHIP_NO_ERROR);
+    }
+    DrainAndServiceIO();
+
+    EXPECT_EQ(loopback.mDroppedMessageCount, kExchangeCount);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), static_cast<int>(kExchangeCount));
+
+    GetIOContext().DriveIOUntil(5000_ms32, [&] { return rm->TestGetCountRetransTable() == 0; });
+    DrainAndServiceIO();
+
+    EXPECT_EQ(loopback.mNumMessagesToDrop, 0u);
+    EXPECT_EQ(loopback.mDroppedMessageCount, kExchangeCount * kLostAttempts);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+}
+
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+/**
+ * Measured round-trip times only back off from the active interval advertised by the peer: on a link much slower than
+ * that interval they delay retransmissions past it, while on a fast link the advertised interval is kept.
+ */
+TEST_F(TestReliableMessageProtocol, CheckAdaptiveRetransmitBackoff)
+{
+    constexpr System::Clock::Milliseconds32 kActiveInterval = 50_ms32;
+    constexpr System::Clock::Milliseconds32 kIdleInterval   = 2000_ms32;
+    constexpr System::Clock::Milliseconds32 kSlowRoundTrip  = 400_ms32;
+    constexpr size_t kSampleCount                           = 4;
+
+    MockAppDelegate mockSender(*this);
+    ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    ASSERT_NE(rm, nullptr);
+
+    SecureSession * session = GetSessionBobToAlice()->AsSecureSession();
+    session->SetRemoteSessionParameters(ReliableMessageProtocolConfig({
+        kIdleInterval,   // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        kActiveInterval, // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    }));
+    EXPECT_FALSE(session->GetRoundTripTimeEstimator().HasEstimate());
+
+    auto & loopback               = GetLoopback();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = 0;
+    loopback.mDroppedMessageCount = 0;
+
+    // Messages acknowledged on their first transmission give round-trip time samples. The loopback round trip is
+    // much shorter than the advertised active interval, which is still used: fast links do not retransmit sooner.
+    for (size_t i = 0; i < kSampleCount; i++)
+    {
+        chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        ASSERT_FALSE(buffer.IsNull());
+
+        ExchangeContext * exchange = NewExchangeToAlice(&mockSender);
+        ASSERT_NE(exchange, nullptr);
+        EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)), CHIP_NO_ERROR);
+        DrainAndServiceIO();
+        EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    }
+    EXPECT_EQ(session->GetRoundTripTimeEstimator().GetSampleCount(), kSampleCount);
+    EXPECT_EQ(session->GetActiveRetransTimeout(), kActiveInterval);
+
+    // Make the link look slow: retransmissions must now wait for about one measured round trip.
+    for (size_t i = 0; i < 16; i++)
+    {
+        session->GetRoundTripTimeEstimator().AddSample(kSlowRoundTrip);
+    }
+    EXPECT_GE(session->GetActiveRetransTimeout(), kSlowRoundTrip);
+    EXPECT_LT(session->GetActiveRetransTimeout(), kIdleInterval);
+
+    chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    ASSERT_FALSE(buffer.IsNull());
+    ExchangeContext * exchange = NewExchangeToAlice(&mockSender);
+    ASSERT_NE(exchange, nullptr);
+
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = 1;
+    loopback.mDroppedMessageCount = 0;
+
+    const System::Clock::Timestamp startTime = System::SystemClock().GetMonotonicTimestamp();
+    EXPECT_EQ(exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer)), CHIP_NO_ERROR);
+    DrainAndServiceIO();
+    EXPECT_EQ(loopback.mDroppedMessageCount, 1u);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 1);
+
+    // With the advertised active interval, the message would have been retransmitted several times by now.
+    GetIOContext().DriveIOUntil(kSlowRoundTrip / 2, [&] { return false; });
+    EXPECT_EQ(loopback.mSentMessageCount, 1u);
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 1);
+
+    GetIOContext().DriveIOUntil(kIdleInterval, [&] { return rm->TestGetCountRetransTable() == 0; });
+    DrainAndServiceIO();
+
+    System::Clock::Timeout elapsed = System::SystemClock().GetMonotonicTimestamp() - startTime;
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+    EXPECT_EQ(loopback.mSentMessageCount, 3u); // original, retransmission and its ack
+    EXPECT_GE(elapsed, System::Clock::Timeout(kSlowRoundTrip));
+
+    // The acknowledgement of the retransmission is not a sample.
+    EXPECT_EQ(session->GetRoundTripTimeEstimator().GetSampleCount(), kSampleCount + 16);
+}
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+
 TEST_F(TestReliableMessageProtocol, CheckFailedMessageRetainOnSend)
 {
     chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
@@ -0,0 +1,97 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <messaging/RoundTripTimeEstimator.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::System::Clock::Literals;
+
+TEST(TestRoundTripTimeEstimator, NoSampleUsesAdvertisedInterval)
+{
+    RoundTripTimeEstimator estimator;
+
+    EXPECT_FALSE(estimator.HasEstimate());
+    EXPECT_EQ(estimator.GetBaseRetransTimeout(300_ms32, 2000_ms32), 300_ms32);
+}
+
+TEST(TestRoundTripTimeEstimator, FirstSample)
+{
+    RoundTripTimeEstimator estimator;
+    estimator.AddSample(40_ms32);
+
+    // SRTT = R, RTTVAR = R / 2
+    EXPECT_TRUE(estimator.HasEstimate());
+    EXPECT_EQ(estimator.GetSampleCount(), 1u);
+    EXPECT_EQ(estimator.GetSmoothedRoundTripTime(), 40_ms32);
+    EXPECT_EQ(estimator.GetRoundTripTimeVariation(), 20_ms32);
+
+    // SRTT + 4 * RTTVAR
+    EXPECT_EQ(estimator.GetBaseRetransTimeout(100_ms32, 2000_ms32), 120_ms32);
+}
+
+TEST(TestRoundTripTimeEstimator, Smoothing)
+{
+    RoundTripTimeEstimator estimator;
+    estimator.AddSample(40_ms32);
+    estimator.AddSample(120_ms32);
+
+    // RTTVAR = 3/4 * 20 + 1/4 * |40 - 120| = 35, SRTT = 7/8 * 40 + 1/8 * 120 = 50
+    EXPECT_EQ(estimator.GetRoundTripTimeVariation(), 35_ms32);
+    EXPECT_EQ(estimator.GetSmoothedRoundTripTime(), 50_ms32);
+
+    // A steady round-trip time makes the variation decay towards zero.
+    for (int i = 0; i < 64; i++)
+    {
+        estimator.AddSample(120_ms32);
+    }
+    EXPECT_EQ(estimator.GetSmoothedRoundTripTime(), 120_ms32);
+    EXPECT_LE(estimator.GetRoundTripTimeVariation(), 1_ms32);
+}
+
+TEST(TestRoundTripTimeEstimator, BaseRetransTimeoutBounds)
+{
+    RoundTripTimeEstimator estimator;
+
+    // Never below the active interval advertised by the peer...
+    estimator.AddSample(1_ms32);
+    EXPECT_EQ(estimator.GetBaseRetransTimeout(300_ms32, 2000_ms32), 300_ms32);
+
+    // ...even if its idle interval is shorter...
+    EXPECT_EQ(estimator.GetBaseRetransTimeout(300_ms32, 10_ms32), 300_ms32);
+
+    // ...and never above its idle interval.
+    estimator.Reset();
+    estimator.AddSample(1000_ms32);
+    EXPECT_EQ(estimator.GetBaseRetransTimeout(300_ms32, 2000_ms32), 2000_ms32);
+}
+
+TEST(TestRoundTripTimeEstimator, LargeSamples)
+{
+    RoundTripTimeEstimator estimator;
+    estimator.AddSample(System::Clock::Milliseconds32(UINT32_MAX));
+    estimator.AddSample(0_ms32);
+    estimator.AddSample(System::Clock::Milliseconds32(UINT32_MAX));
+
+    EXPECT_EQ(estimator.GetSampleCount(), 3u);
+    EXPECT_EQ(estimator.GetBaseRetransTimeout(300_ms32, 2000_ms32), 2000_ms32);
+}
+
+} // namespace
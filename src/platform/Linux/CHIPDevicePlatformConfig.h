@@ -54,6 +54,17 @@
 // These are configuration options that are unique to Linux platforms.
 // These can be overridden by the application as needed.
 
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+ *
+ * Use the append-only journal (ChipLinuxStorageJournal) instead of the INI file (ChipLinuxStorage)
+ * as the KeyValueStoreManager backend. The two backends use different file formats, and the journal
+ * refuses to open an existing INI file.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL 0
+#endif
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
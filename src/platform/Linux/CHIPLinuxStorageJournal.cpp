@@ -0,0 +1,507 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         Append-only, journaled key-value store for Linux.
+ *
+ *         Journal file layout (all integers little-endian):
+ *
+ *           magic "CHIPKVJ1"
+ *           record*
+ *
+ *         where each record is
+ *
+ *           u32 crc32      CRC-32 of everything in the record after this field
+ *           u8  type       RecordType
+ *           u8  reserved   0
+ *           u16 key length
+ *           u32 value length (0 for deletions)
+ *           key bytes
+ *           value bytes
+ */
+
+#include <platform/Linux/CHIPLinuxStorageJournal.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+
+#include <algorithm>
+#include <array>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr uint8_t kJournalMagic[]  = { 'C', 'H', 'I', 'P', 'K', 'V', 'J', '1' };
+constexpr size_t kRecordHeaderSize = 12;
+constexpr size_t kRecordCrcSize    = 4;
+constexpr char kCompactionSuffix[] = ".compact";
+
+constexpr std::array<uint32_t, 256> MakeCrc32Table()
+{
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320u : (crc >> 1);
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+constexpr std::array<uint32_t, 256> kCrc32Table = MakeCrc32Table();
+
+// CRC-32 (IEEE 802.3) used to detect torn or corrupted records.
+uint32_t Crc32(const uint8_t * data, size_t length)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; i++)
+    {
+        crc = kCrc32Table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+CHIP_ERROR WriteAll(int fd, const uint8_t * data, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t written = write(fd, data, length);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return CHIP_ERROR_POSIX(errno);
+        }
+        data += written;
+        length -= static_cast<size_t>(written);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ReadAll(int fd, std::vector<uint8_t> & out)
+{
+    struct stat st;
+    VerifyOrReturnError(fstat(fd, &st) == 0, CHIP_ERROR_POSIX(errno));
+    out.resize(static_cast<size_t>(st.st_size));
+
+    size_t total = 0;
+    while (total < out.size())
+    {
+        ssize_t n = pread(fd, out.data() + total, out.size() - total, static_cast<off_t>(total));
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return CHIP_ERROR_POSIX(errno);
+        }
+        if (n == 0)
+        {
+            break;
+        }
+        total += static_cast<size_t>(n);
+    }
+    out.resize(total);
+    return CHIP_NO_ERROR;
+}
+
+// Make a rename within the journal's directory durable.
+void SyncParentDirectory(const std::string & path)
+{
+    const size_t slash = path.rfind('/');
+    std::string dir;
+    if (slash == std::string::npos)
+    {
+        dir = ".";
+    }
+    else
+    {
+        dir = (slash == 0) ? std::string("/") : path.substr(0, slash);
+    }
+
+    int dirFd = open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (dirFd >= 0)
+    {
+        fsync(dirFd);
+        close(dirFd);
+    }
+}
+
+} // namespace
+
+ChipLinuxStorageJournal::~ChipLinuxStorageJournal()
+{
+    Shutdown();
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Init(const char * journalFile)
+{
+    VerifyOrReturnError(journalFile != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd < 0, CHIP_ERROR_INCORRECT_STATE);
+
+    mPath = journalFile;
+    mFd   = open(journalFile, O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (mFd < 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to open KVS journal %s: %s", journalFile, strerror(errno));
+        return CHIP_ERROR_POSIX(errno);
+    }
+
+    CHIP_ERROR err = Replay();
+    if (err == CHIP_NO_ERROR)
+    {
+        err = CompactIfNeededLocked();
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        close(mFd);
+        mFd = -1;
+        mValues.clear();
+    }
+    return err;
+}
+
+void ChipLinuxStorageJournal::Shutdown()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+    mValues.clear();
+    mJournalSize = 0;
+    mLiveSize    = 0;
+}
+
+size_t ChipLinuxStorageJournal::RecordSize(size_t keyLength, size_t valueLength)
+{
+    return kRecordHeaderSize + keyLength + valueLength;
+}
+
+void ChipLinuxStorageJournal::EncodeRecord(std::vector<uint8_t> & out, RecordType type, const std::string & key,
+                                           const uint8_t * value, size_t valueLength)
+{
+    const size_t start = out.size();
+    out.resize(start + RecordSize(key.size(), valueLength));
+
+    uint8_t * p = out.data() + start;
+    p[4]        = to_underlying(type);
+    p[5]        = 0;
+    Encoding::LittleEndian::Put16(p + 6, static_cast<uint16_t>(key.size()));
+    Encoding::LittleEndian::Put32(p + 8, static_cast<uint32_t>(valueLength));
+    memcpy(p + kRecordHeaderSize, key.data(), key.size());
+    if (valueLength > 0)
+    {
+        memcpy(p + kRecordHeaderSize + key.size(), value, valueLength);
+    }
+    Encoding::LittleEndian::Put32(p, Crc32(p + kRecordCrcSize, RecordSize(key.size(), valueLength) - kRecordCrcSize));
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Replay()
+{
+    std::vector<uint8_t> contents;
+    ReturnErrorOnFailure(ReadAll(mFd, contents));
+
+    mValues.clear();
+
+    // An empty file has just been created; a non-empty file shorter than the magic can only be the
+    // result of an interrupted creation.
+    if (contents.size() < sizeof(kJournalMagic))
+    {
+        if (!contents.empty() && memcmp(contents.data(), kJournalMagic, contents.size()) != 0)
+        {
+            ChipLogError(DeviceLayer, "KVS file %s is not a journal", mPath.c_str());
+            return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+        }
+        VerifyOrReturnError(ftruncate(mFd, 0) == 0, CHIP_ERROR_POSIX(errno));
+        ReturnErrorOnFailure(WriteAll(mFd, kJournalMagic, sizeof(kJournalMagic)));
+        VerifyOrReturnError(fdatasync(mFd) == 0, CHIP_ERROR_POSIX(errno));
+        SyncParentDirectory(mPath);
+        mJournalSize = mLiveSize = sizeof(kJournalMagic);
+        return CHIP_NO_ERROR;
+    }
+
+    if (memcmp(contents.data(), kJournalMagic, sizeof(kJournalMagic)) != 0)
+    {
+        ChipLogError(DeviceLayer, "KVS file %s is not a journal", mPath.c_str());
+        return CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    }
+
+    size_t offset = sizeof(kJournalMagic);
+    mLiveSize     = sizeof(kJournalMagic);
+    while (contents.size() - offset >= kRecordHeaderSize)
+    {
+        const uint8_t * p        = contents.data() + offset;
+        const uint8_t type       = p[4];
+        const size_t keyLength   = Encoding::LittleEndian::Get16(p + 6);
+        const size_t valueLength = Encoding::LittleEndian::Get32(p + 8);
+        const size_t remaining   = contents.size() - offset;
+        if (keyLength > remaining - kRecordHeaderSize || valueLength > remaining - kRecordHeaderSize - keyLength)
+        {
+            break;
+        }
+        const size_t recordSize = RecordSize(keyLength, valueLength);
+        if (Encoding::LittleEndian::Get32(p) != Crc32(p + kRecordCrcSize, recordSize - kRecordCrcSize))
+        {
+            break;
+        }
+
+        std::string key(reinterpret_cast<const char *>(p + kRecordHeaderSize), keyLength);
+        auto existing = mValues.find(key);
+        if (existing != mValues.end())
+        {
+            mLiveSize -= RecordSize(existing->first.size(), existing->second.size());
+        }
+
+        if (type == to_underlying(RecordType::kPut))
+        {
+            const uint8_t * value = p + kRecordHeaderSize + keyLength;
+            mValues[std::move(key)].assign(value, value + valueLength);
+            mLiveSize += recordSize;
+        }
+        else if (type == to_underlying(RecordType::kDelete))
+        {
+            if (existing != mValues.end())
+            {
+                mValues.erase(existing);
+            }
+        }
+        else
+        {
+            break;
+        }
+
+        offset += recordSize;
+    }
+
+    mJournalSize = offset;
+    if (offset != contents.size())
+    {
+        ChipLogError(DeviceLayer, "KVS journal %s: discarding %u bytes of incomplete or corrupt records", mPath.c_str(),
+                     static_cast<unsigned>(contents.size() - offset));
+        VerifyOrReturnError(ftruncate(mFd, static_cast<off_t>(offset)) == 0, CHIP_ERROR_POSIX(errno));
+        VerifyOrReturnError(fdatasync(mFd) == 0, CHIP_ERROR_POSIX(errno));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::AppendRecord(RecordType type, const std::string & key, const uint8_t * value,
+                                                 size_t valueLength)
+{
+    mRecordBuffer.clear();
+    EncodeRecord(mRecordBuffer, type, key, value, valueLength);
+
+    CHIP_ERROR err = WriteAll(mFd, mRecordBuffer.data(), mRecordBuffer.size());
+    if (err == CHIP_NO_ERROR && fdatasync(mFd) != 0)
+    {
+        err = CHIP_ERROR_POSIX(errno);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        // Drop whatever part of the record made it to the file so later appends stay readable.
+        ChipLogError(DeviceLayer, "KVS journal %s: append failed: %" CHIP_ERROR_FORMAT, mPath.c_str(), err.Format());
+        if (ftruncate(mFd, static_cast<off_t>(mJournalSize)) != 0)
+        {
+            ChipLogError(DeviceLayer, "KVS journal %s: truncate failed: %s", mPath.c_str(), strerror(errno));
+        }
+        return err;
+    }
+
+    mJournalSize += mRecordBuffer.size();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Get(const char * key, void * value, size_t valueSize, size_t * readBytesSize,
+                                        size_t offsetBytes)
+{
+    VerifyOrReturnError(key != nullptr && value != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    auto it = mValues.find(key);
+    VerifyOrReturnError(it != mValues.end(), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    const std::vector<uint8_t> & stored = it->second;
+    VerifyOrReturnError(offsetBytes <= stored.size(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t totalSizeToRead = stored.size() - offsetBytes;
+    const size_t copySize        = std::min(valueSize, totalSizeToRead);
+    if (readBytesSize != nullptr)
+    {
+        *readBytesSize = copySize;
+    }
+    if (copySize > 0)
+    {
+        memcpy(value, stored.data() + offsetBytes, copySize);
+    }
+
+    return (valueSize < totalSizeToRead) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Put(const char * key, const void * value, size_t valueSize)
+{
+    VerifyOrReturnError(key != nullptr && (value != nullptr || valueSize == 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t keyLength = strlen(key);
+    VerifyOrReturnError(keyLength > 0 && keyLength <= std::numeric_limits<uint16_t>::max(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(valueSize <= std::numeric_limits<uint32_t>::max(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    std::string keyString(key, keyLength);
+    const uint8_t * bytes = static_cast<const uint8_t *>(value);
+    ReturnErrorOnFailure(AppendRecord(RecordType::kPut, keyString, bytes, valueSize));
+
+    auto it = mValues.find(keyString);
+    if (it != mValues.end())
+    {
+        mLiveSize -= RecordSize(keyLength, it->second.size());
+        it->second.assign(bytes, bytes + valueSize);
+    }
+    else
+    {
+        mValues.emplace(std::move(keyString), std::vector<uint8_t>(bytes, bytes + valueSize));
+    }
+    mLiveSize += RecordSize(keyLength, valueSize);
+
+    return CompactIfNeededLocked();
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Delete(const char * key)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    auto it = mValues.find(key);
+    VerifyOrReturnError(it != mValues.end(), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    ReturnErrorOnFailure(AppendRecord(RecordType::kDelete, it->first, nullptr, 0));
+
+    mLiveSize -= RecordSize(it->first.size(), it->second.size());
+    mValues.erase(it);
+
+    return CompactIfNeededLocked();
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Compact()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+    return CompactLocked();
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::CompactIfNeededLocked()
+{
+    if (mJournalSize < kCompactionMinJournalSize || mJournalSize - mLiveSize <= mLiveSize)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    // The triggering write is already durable, so a failed compaction is not reported to the caller;
+    // it is retried on a later write.
+    CHIP_ERROR err = CompactLocked();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "KVS journal %s: compaction failed: %" CHIP_ERROR_FORMAT, mPath.c_str(), err.Format());
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::CompactLocked()
+{
+    const std::string tmpPath = mPath + kCompactionSuffix;
+
+    int tmpFd = open(tmpPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    VerifyOrReturnError(tmpFd >= 0, CHIP_ERROR_POSIX(errno));
+
+    // Write the live records in bounded chunks so compaction does not need a copy of the whole store.
+    constexpr size_t kChunkSize = 16 * 1024;
+    std::vector<uint8_t> buffer(kJournalMagic, kJournalMagic + sizeof(kJournalMagic));
+    size_t written = 0;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    for (const auto & entry : mValues)
+    {
+        EncodeRecord(buffer, RecordType::kPut, entry.first, entry.second.data(), entry.second.size());
+        if (buffer.size() >= kChunkSize)
+        {
+            SuccessOrExit(err = WriteAll(tmpFd, buffer.data(), buffer.size()));
+            written += buffer.size();
+            buffer.clear();
+        }
+    }
+    SuccessOrExit(err = WriteAll(tmpFd, buffer.data(), buffer.size()));
+    written += buffer.size();
+    VerifyOrExit(fdatasync(tmpFd) == 0, err = CHIP_ERROR_POSIX(errno));
+    VerifyOrExit(rename(tmpPath.c_str(), mPath.c_str()) == 0, err = CHIP_ERROR_POSIX(errno));
+    SyncParentDirectory(mPath);
+
+    close(mFd);
+    mFd          = tmpFd;
+    mJournalSize = written;
+    mLiveSize    = written;
+    return CHIP_NO_ERROR;
+
+exit:
+    close(tmpFd);
+    unlink(tmpPath.c_str());
+    return err;
+}
+
+size_t ChipLinuxStorageJournal::GetKeyCount()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mValues.size();
+}
+
+size_t ChipLinuxStorageJournal::GetJournalSize()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mJournalSize;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
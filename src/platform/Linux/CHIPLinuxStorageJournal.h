@@ -0,0 +1,121 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file defines an append-only, journaled key-value store used as
+ *         an alternative KVS backend on Linux.
+ *
+ *         Every Put or Delete appends a single checksummed record to the
+ *         journal file and syncs it, so the cost of a write does not depend
+ *         on how many keys are stored. The live contents are kept in memory
+ *         and rebuilt by replaying the journal on Init(); a torn or corrupt
+ *         record at the end of the journal (e.g. after a power loss during
+ *         a write) is discarded together with anything that follows it.
+ *
+ *         Overwritten and deleted records are reclaimed by compaction, which
+ *         writes the live records to a temporary file and atomically renames
+ *         it over the journal once it has been synced.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxStorageJournal
+{
+public:
+    // Compaction runs once the journal is at least this large and more than half of it is
+    // occupied by overwritten or deleted records.
+    static constexpr size_t kCompactionMinJournalSize = 64 * 1024;
+
+    ChipLinuxStorageJournal() = default;
+    ~ChipLinuxStorageJournal();
+
+    ChipLinuxStorageJournal(const ChipLinuxStorageJournal &)             = delete;
+    ChipLinuxStorageJournal & operator=(const ChipLinuxStorageJournal &) = delete;
+
+    /**
+     * Open (creating it if needed) and replay the journal at the given path.
+     *
+     * Returns CHIP_ERROR_PERSISTED_STORAGE_FAILED if the file exists but is not a journal.
+     */
+    CHIP_ERROR Init(const char * journalFile);
+
+    /**
+     * Close the journal. The store can be initialized again afterwards.
+     */
+    void Shutdown();
+
+    /**
+     * Read a value, following the semantics of KeyValueStoreManager::Get().
+     */
+    CHIP_ERROR Get(const char * key, void * value, size_t valueSize, size_t * readBytesSize = nullptr, size_t offsetBytes = 0);
+    CHIP_ERROR Put(const char * key, const void * value, size_t valueSize);
+    CHIP_ERROR Delete(const char * key);
+
+    /**
+     * Rewrite the journal so that it only contains the live records.
+     */
+    CHIP_ERROR Compact();
+
+    size_t GetKeyCount();
+    size_t GetJournalSize();
+
+private:
+    enum class RecordType : uint8_t
+    {
+        kPut    = 1,
+        kDelete = 2,
+    };
+
+    static size_t RecordSize(size_t keyLength, size_t valueLength);
+    static void EncodeRecord(std::vector<uint8_t> & out, RecordType type, const std::string & key, const uint8_t * value,
+                             size_t valueLength);
+
+    CHIP_ERROR Replay();
+    CHIP_ERROR AppendRecord(RecordType type, const std::string & key, const uint8_t * value, size_t valueLength);
+    CHIP_ERROR CompactLocked();
+    CHIP_ERROR CompactIfNeededLocked();
+
+    std::mutex mLock;
+    std::string mPath;
+    int mFd = -1;
+
+    std::unordered_map<std::string, std::vector<uint8_t>> mValues;
+    // Size of the journal file and the part of it needed to represent mValues.
+    size_t mJournalSize = 0;
+    size_t mLiveSize    = 0;
+
+    std::vector<uint8_t> mRecordBuffer;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,142 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file reports the Put/Get/Delete latency of the append-only
+ *      journal KVS backend on Linux next to the INI backend at different
+ *      store sizes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <string>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageJournal.h>
+#include <system/SystemClock.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+constexpr size_t kStoreSizes[]   = { 1000, 10000 };
+constexpr int kOpsPerMeasurement = 50;
+
+class BenchmarkLinuxStorageJournal : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        char dirTemplate[] = "/tmp/chip_kvs_journal_XXXXXX";
+        ASSERT_NE(mkdtemp(dirTemplate), nullptr);
+        mDir  = dirTemplate;
+        mPath = mDir + "/kvs";
+    }
+
+    void TearDown() override
+    {
+        mJournal.Shutdown();
+        unlink(mPath.c_str());
+        unlink((mPath + ".compact").c_str());
+        unlink((mDir + "/kvs.ini").c_str());
+        rmdir(mDir.c_str());
+    }
+
+    std::string mDir;
+    std::string mPath;
+    ChipLinuxStorageJournal mJournal;
+};
+
+TEST_F(BenchmarkLinuxStorageJournal, LatencyVersusIniBackend)
+{
+    const std::string iniPath = mDir + "/kvs.ini";
+    const uint8_t value[32]   = {};
+    uint8_t readBuf[sizeof(value)];
+    char key[16];
+
+    for (size_t count : kStoreSizes)
+    {
+        unlink(iniPath.c_str());
+        unlink(mPath.c_str());
+
+        ChipLinuxStorage ini;
+        ASSERT_EQ(ini.Init(iniPath.c_str()), CHIP_NO_ERROR);
+        ASSERT_EQ(mJournal.Init(mPath.c_str()), CHIP_NO_ERROR);
+        for (size_t i = 0; i < count; i++)
+        {
+            snprintf(key, sizeof(key), "key%u", static_cast<unsigned>(i));
+            ASSERT_EQ(ini.WriteValueBin(key, value, sizeof(value)), CHIP_NO_ERROR);
+            ASSERT_EQ(mJournal.Put(key, value, sizeof(value)), CHIP_NO_ERROR);
+        }
+        ASSERT_EQ(ini.Commit(), CHIP_NO_ERROR);
+
+        // Each backend performs the same sequence the KVS manager issues: Put+Commit, Get, Delete+Commit.
+        uint64_t iniUs[3]     = {};
+        uint64_t journalUs[3] = {};
+        for (int i = 0; i < kOpsPerMeasurement; i++)
+        {
+            snprintf(key, sizeof(key), "key%u", static_cast<unsigned>(static_cast<size_t>(i) * count / kOpsPerMeasurement));
+            size_t readSize;
+
+            auto start = System::SystemClock().GetMonotonicMicroseconds64();
+            ASSERT_EQ(ini.WriteValueBin(key, value, sizeof(value)), CHIP_NO_ERROR);
+            ASSERT_EQ(ini.Commit(), CHIP_NO_ERROR);
+            auto mid = System::SystemClock().GetMonotonicMicroseconds64();
+            ASSERT_EQ(ini.ReadValueBin(key, readBuf, sizeof(readBuf), readSize), CHIP_NO_ERROR);
+            auto end = System::SystemClock().GetMonotonicMicroseconds64();
+            ASSERT_EQ(ini.ClearValue(key), CHIP_NO_ERROR);
+            ASSERT_EQ(ini.Commit(), CHIP_NO_ERROR);
+            iniUs[0] += (mid - start).count();
+            iniUs[1] += (end - mid).count();
+            iniUs[2] += (System::SystemClock().GetMonotonicMicroseconds64() - end).count();
+
+            start = System::SystemClock().GetMonotonicMicroseconds64();
+            ASSERT_EQ(mJournal.Put(key, value, sizeof(value)), CHIP_NO_ERROR);
+            mid = System::SystemClock().GetMonotonicMicroseconds64();
+            ASSERT_EQ(mJournal.Get(key, readBuf, sizeof(readBuf)), CHIP_NO_ERROR);
+            end = System::SystemClock().GetMonotonicMicroseconds64();
+            ASSERT_EQ(mJournal.Delete(key), CHIP_NO_ERROR);
+            journalUs[0] += (mid - start).count();
+            journalUs[1] += (end - mid).count();
+            journalUs[2] += (System::SystemClock().GetMonotonicMicroseconds64() - end).count();
+        }
+
+        ChipLogProgress(Test, "%u keys: INI put %u us, get %u us, delete %u us", static_cast<unsigned>(count),
+                        static_cast<unsigned>(iniUs[0] / kOpsPerMeasurement), static_cast<unsigned>(iniUs[1] / kOpsPerMeasurement),
+                        static_cast<unsigned>(iniUs[2] / kOpsPerMeasurement));
+        ChipLogProgress(Test, "%u keys: journal put %u us, get %u us, delete %u us", static_cast<unsigned>(count),
+                        static_cast<unsigned>(journalUs[0] / kOpsPerMeasurement),
+                        static_cast<unsigned>(journalUs[1] / kOpsPerMeasurement),
+                        static_cast<unsigned>(journalUs[2] / kOpsPerMeasurement));
+
+        mJournal.Shutdown();
+    }
+}
+
+} // namespace
@@ -0,0 +1,216 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the append-only journal
+ *      KVS backend on Linux.
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <platform/Linux/CHIPLinuxStorageJournal.h>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+class TestLinuxStorageJournal : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        char dirTemplate[] = "/tmp/chip_kvs_journal_XXXXXX";
+        ASSERT_NE(mkdtemp(dirTemplate), nullptr);
+        mDir  = dirTemplate;
+        mPath = mDir + "/kvs";
+    }
+
+    void TearDown() override
+    {
+        mJournal.Shutdown();
+        unlink(mPath.c_str());
+        unlink((mPath + ".compact").c_str());
+        rmdir(mDir.c_str());
+    }
+
+    off_t FileSize()
+    {
+        struct stat st;
+        return stat(mPath.c_str(), &st) == 0 ? st.st_size : -1;
+    }
+
+    std::string mDir;
+    std::string mPath;
+    ChipLinuxStorageJournal mJournal;
+};
+
+TEST_F(TestLinuxStorageJournal, PutGetDelete)
+{
+    ASSERT_EQ(mJournal.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    const char value[] = "hello";
+    char buf[16];
+    size_t readSize = 0;
+
+    EXPECT_EQ(mJournal.Get("k", buf, sizeof(buf)), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_EQ(mJournal.Put("k", value, sizeof(value)), CHIP_NO_ERROR);
+
+    EXPECT_EQ(mJournal.Get("k", buf, sizeof(buf), &readSize), CHIP_NO_ERROR);
+    EXPECT_EQ(readSize, sizeof(value));
+    EXPECT_STREQ(buf, value);
+
+    // Partial and offset reads behave like the other KVS implementations.
+    EXPECT_EQ(mJournal.Get("k", buf, 2, &readSize), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(readSize, 2u);
+    EXPECT_EQ(memcmp(buf, "he", 2), 0);
+    EXPECT_EQ(mJournal.Get("k", buf, sizeof(buf), &readSize, 3), CHIP_NO_ERROR);
+    EXPECT_EQ(readSize, sizeof(value) - 3);
+    EXPECT_STREQ(buf, "lo");
+    EXPECT_EQ(mJournal.Get("k", buf, sizeof(buf), &readSize, sizeof(value) + 1), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Empty values are allowed.
+    EXPECT_EQ(mJournal.Put("empty", nullptr, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(mJournal.Get("empty", buf, sizeof(buf), &readSize), CHIP_NO_ERROR);
+    EXPECT_EQ(readSize, 0u);
+
+    EXPECT_EQ(mJournal.Delete("k"), CHIP_NO_ERROR);
+    EXPECT_EQ(mJournal.Get("k", buf, sizeof(buf)), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_EQ(mJournal.Delete("k"), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_EQ(mJournal.GetKeyCount(), 1u);
+}
+
+TEST_F(TestLinuxStorageJournal, ReopenReplaysJournal)
+{
+    ASSERT_EQ(mJournal.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(mJournal.Put("a", "1", 1), CHIP_NO_ERROR);
+    EXPECT_EQ(mJournal.Put("b", "2", 1), CHIP_NO_ERROR);
+    EXPECT_EQ(mJournal.Put("a", "33", 2), CHIP_NO_ERROR);
+    EXPECT_EQ(mJournal.Delete("b"), CHIP_NO_ERROR);
+    EXPECT_EQ(mJournal.Put("c", "4", 1), CHIP_NO_ERROR);
+    mJournal.Shutdown();
+
+    ASSERT_EQ(mJournal.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(mJournal.GetKeyCount(), 2u);
+
+    char buf[4];
+    size_t readSize = 0;
+    EXPECT_EQ(mJournal.Get("a", buf, sizeof(buf), &readSize), CHIP_NO_ERROR);
+    EXPECT_EQ(readSize, 2u);
+    EXPECT_EQ(memcmp(buf, "33", 2), 0);
+    EXPECT_EQ(mJournal.Get("b", buf, sizeof(buf)), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_EQ(mJournal.Get("c", buf, sizeof(buf), &readSize), CHIP_NO_ERROR);
+    EXPECT_EQ(buf[0], '4');
+}
+
+TEST_F(TestLinuxStorageJournal, TornAndCorruptTailIsDiscarded)
+{
+    ASSERT_EQ(mJournal.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(mJournal.Put("a", "first", 5), CHIP_NO_ERROR);
+    const off_t sizeAfterFirst = FileSize();
+    EXPECT_EQ(mJournal.Put("b", "second", 6), CHIP_NO_ERROR);
+    mJournal.Shutdown();
+
+    // Simulate a write interrupted halfway through the second record.
+    ASSERT_EQ(truncate(mPath.c_str(), FileSize() - 4), 0);
+
+    ASSERT_EQ(mJournal.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(FileSize(), sizeAfterFirst);
+    char buf[8];
+    EXPECT_EQ(mJournal.Get("a", buf, sizeof(buf)), CHIP_NO_ERROR);
+    EXPECT_EQ(mJournal.Get("b", buf, sizeof(buf)), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    // Writes after recovery are appended to the truncated journal and survive a reopen.
+    EXPECT_EQ(mJournal.Put("c", "third", 5), CHIP_NO_ERROR);
+    mJournal.Shutdown();
+
+    // Flip a byte in the value of the last record so its checksum no longer matches.
+    int fd = open(mPath.c_str(), O_RDWR);
+    ASSERT_GE(fd, 0);
+    uint8_t byte;
+    ASSERT_EQ(pread(fd, &byte, 1, FileSize() - 1), 1);
+    byte ^= 0xFF;
+    ASSERT_EQ(pwrite(fd, &byte, 1, FileSize() - 1), 1);
+    close(fd);
+
+    ASSERT_EQ(mJournal.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(FileSize(), sizeAfterFirst);
+    EXPECT_EQ(mJournal.Get("a", buf, sizeof(buf)), CHIP_NO_ERROR);
+    EXPECT_EQ(mJournal.Get("c", buf, sizeof(buf)), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+}
+
+TEST_F(TestLinuxStorageJournal, RejectsNonJournalFile)
+{
+    FILE * file = fopen(mPath.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    fputs("[DEFAULT]\nkey=value\n", file);
+    fclose(file);
+
+    EXPECT_EQ(mJournal.Init(mPath.c_str()), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    EXPECT_EQ(mJournal.Put("a", "1", 1), CHIP_ERROR_INCORRECT_STATE);
+}
+
+TEST_F(TestLinuxStorageJournal, CompactionBoundsJournalSize)
+{
+    ASSERT_EQ(mJournal.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    uint8_t value[256];
+    for (unsigned i = 0; i < 2000; i++)
+    {
+        memset(value, static_cast<uint8_t>(i), sizeof(value));
+        char key[8];
+        snprintf(key, sizeof(key), "k%u", i % 4);
+        ASSERT_EQ(mJournal.Put(key, value, sizeof(value)), CHIP_NO_ERROR);
+        ASSERT_LT(mJournal.GetJournalSize(), 2 * ChipLinuxStorageJournal::kCompactionMinJournalSize);
+    }
+    EXPECT_EQ(static_cast<size_t>(FileSize()), mJournal.GetJournalSize());
+
+    // An explicit compaction leaves only the four live records.
+    EXPECT_EQ(mJournal.Compact(), CHIP_NO_ERROR);
+    EXPECT_LT(mJournal.GetJournalSize(), 4 * (sizeof(value) + 64));
+    EXPECT_EQ(static_cast<size_t>(FileSize()), mJournal.GetJournalSize());
+
+    // Writes after compaction go to the new file.
+    EXPECT_EQ(mJournal.Delete("k0"), CHIP_NO_ERROR);
+    mJournal.Shutdown();
+
+    ASSERT_EQ(mJournal.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(mJournal.GetKeyCount(), 3u);
+    size_t readSize = 0;
+    EXPECT_EQ(mJournal.Get("k3", value, sizeof(value), &readSize), CHIP_NO_ERROR);
+    EXPECT_EQ(readSize, sizeof(value));
+    EXPECT_EQ(value[0], static_cast<uint8_t>(1999));
+    EXPECT_EQ(mJournal.Get("k0", value, sizeof(value)), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+}
+
+} // namespace
@@ -29,6 +29,7 @@
 #include <string.h>
 
 #include <atomic>
+#include <thread>
 
 #include <pw_unit_test/framework.h>
 
@@ -212,6 +213,84 @@ TEST_F(TestPlatformMgr, TryLockChipStack)
         PlatformMgr().UnlockChipStack();
 }
 
+static constexpr size_t kBackgroundJobCount = 32;
+
+static std::atomic<size_t> sBackgroundJobsDone;
+static std::atomic<size_t> sBackgroundJobsOnMatterThread;
+static std::atomic<bool> sMatterThreadIdSet;
+static std::thread::id sMatterThreadId; // Written before sMatterThreadIdSet is set
+
+static void RecordMatterThreadId(intptr_t)
+{
+    sMatterThreadId    = std::this_thread::get_id();
+    sMatterThreadIdSet = true;
+}
+
+static void BackgroundJob(intptr_t)
+{
+    if (sMatterThreadIdSet && std::this_thread::get_id() == sMatterThreadId)
+    {
+        sBackgroundJobsOnMatterThread++;
+    }
+    sBackgroundJobsDone++;
+}
+
+TEST_F(TestPlatformMgr, BackgroundWorkRunsOffMatterThread)
+{
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+    // Without background event processing the work falls back to the main event loop.
+    EXPECT_EQ(PlatformMgr().StartEventLoopTask(), CHIP_NO_ERROR);
+
+    sMatterThreadIdSet = false;
+    EXPECT_EQ(PlatformMgr().ScheduleWork(RecordMatterThreadId), CHIP_NO_ERROR);
+    for (size_t t = 0; !sMatterThreadIdSet && t < 1000; t++)
+        chip::test_utils::SleepMillis(1);
+    EXPECT_TRUE(sMatterThreadIdSet);
+
+    sBackgroundJobsDone           = 0;
+    sBackgroundJobsOnMatterThread = 0;
+    for (size_t i = 0; i < kBackgroundJobCount; i++)
+    {
+        EXPECT_EQ(PlatformMgr().ScheduleBackgroundWork(BackgroundJob), CHIP_NO_ERROR);
+    }
+    for (size_t t = 0; sBackgroundJobsDone != kBackgroundJobCount && t < 10000; t++)
+        chip::test_utils::SleepMillis(1);
+
+    EXPECT_EQ(sBackgroundJobsDone, kBackgroundJobCount);
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    EXPECT_EQ(sBackgroundJobsOnMatterThread, 0u);
+#else
+    EXPECT_EQ(sBackgroundJobsOnMatterThread, kBackgroundJobCount);
+#endif
+
+    EXPECT_EQ(PlatformMgr().StopEventLoopTask(), CHIP_NO_ERROR);
+    PlatformMgr().Shutdown();
+}
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+static void SlowBackgroundJob(intptr_t)
+{
+    chip::test_utils::SleepMillis(10);
+    sBackgroundJobsDone++;
+}
+
+TEST_F(TestPlatformMgr, BackgroundWorkCompletesOnShutdown)
+{
+    EXPECT_EQ(PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+
+    // Keep the background tasks busy long enough for most of the jobs to still be queued at shutdown.
+    sBackgroundJobsDone = 0;
+    for (size_t i = 0; i < kBackgroundJobCount; i++)
+    {
+        EXPECT_EQ(PlatformMgr().ScheduleBackgroundWork(SlowBackgroundJob), CHIP_NO_ERROR);
+    }
+
+    // Work still queued when the background tasks stop must run, not be dropped.
+    PlatformMgr().Shutdown();
+    EXPECT_EQ(sBackgroundJobsDone, kBackgroundJobCount);
+}
+#endif // CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+
 static int sEventRecieved = 0;
 
 void DeviceEventHandler(const ChipDeviceEvent * event, intptr_t arg)
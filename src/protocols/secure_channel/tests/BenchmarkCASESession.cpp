@@ -0,0 +1,330 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Throughput benchmark of concurrent CASE session establishment, with the
+ *      handshake crypto run on the Matter thread and on the background tasks.
+ *
+ *      The number of background tasks is CHIP_DEVICE_CONFIG_BG_TASK_COUNT; build
+ *      with `chip_device_config_bg_task_count` set to 1 and to N to compare them.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <credentials/GroupDataProviderImpl.h>
+#include <credentials/PersistentStorageOpCertStore.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <messaging/tests/MessagingContext.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <protocols/secure_channel/CASESession.h>
+#include <system/SystemClock.h>
+
+#include "credentials/tests/CHIPCert_test_vectors.h"
+
+#include <inttypes.h>
+
+#include <algorithm>
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::Crypto;
+using namespace chip::Messaging;
+using namespace chip::TestCerts;
+
+namespace {
+
+constexpr size_t kConcurrentHandshakes = 8;
+constexpr size_t kRounds               = 8;
+constexpr size_t kMaxServiceLoops      = 100000;
+
+constexpr NodeId kResponderNodeId = 0xDEDEDEDE00010001;
+
+class HandshakeDelegate : public SessionEstablishmentDelegate
+{
+public:
+    void OnSessionEstablishmentError(CHIP_ERROR error) override { mNumErrors++; }
+    void OnSessionEstablished(const SessionHandle & session) override { mNumComplete++; }
+
+    size_t mNumErrors   = 0;
+    size_t mNumComplete = 0;
+};
+
+// Signs Sigma2 with an injected key, from the background tasks.
+class BackgroundOperationalKeystore : public OperationalKeystore
+{
+public:
+    void Init(FabricIndex fabricIndex, Platform::UniquePtr<P256Keypair> keypair)
+    {
+        mFabricIndex = fabricIndex;
+        mKeypair     = std::move(keypair);
+    }
+    void Shutdown() { mKeypair = nullptr; }
+
+    bool HasPendingOpKeypair() const override { return false; }
+    bool HasOpKeypairForFabric(FabricIndex fabricIndex) const override { return fabricIndex == mFabricIndex; }
+    CHIP_ERROR NewOpKeypairForFabric(FabricIndex fabricIndex, MutableByteSpan & outCertificateSigningRequest) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR ActivateOpKeypairForFabric(FabricIndex fabricIndex, const P256PublicKey & nocPublicKey) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR CommitOpKeypairForFabric(FabricIndex fabricIndex) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR RemoveOpKeypairForFabric(FabricIndex fabricIndex) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    void RevertPendingKeypair() override {}
+
+    bool SupportsSignWithOpKeypairInBackground() const override { return true; }
+
+    CHIP_ERROR SignWithOpKeypair(FabricIndex fabricIndex, const ByteSpan & message,
+                                 P256ECDSASignature & outSignature) const override
+    {
+        VerifyOrReturnError(mKeypair != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        VerifyOrReturnError(fabricIndex == mFabricIndex, CHIP_ERROR_INVALID_FABRIC_INDEX);
+        return mKeypair->ECDSA_sign_msg(message.data(), message.size(), outSignature);
+    }
+
+    P256Keypair * AllocateEphemeralKeypairForCASE() override { return Platform::New<P256Keypair>(); }
+    void ReleaseEphemeralKeypair(P256Keypair * keypair) override { Platform::Delete<P256Keypair>(keypair); }
+
+private:
+    Platform::UniquePtr<P256Keypair> mKeypair;
+    FabricIndex mFabricIndex = kUndefinedFabricIndex;
+};
+
+// Hands each incoming Sigma1 to the next prepared responder session.
+class ResponderPool : public UnsolicitedMessageHandler
+{
+public:
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        VerifyOrReturnError(mNextSession < kConcurrentHandshakes && mSessions[mNextSession] != nullptr, CHIP_ERROR_NO_MEMORY);
+        newDelegate = mSessions[mNextSession++];
+        return CHIP_NO_ERROR;
+    }
+
+    CASESession * mSessions[kConcurrentHandshakes] = {};
+    size_t mNextSession                            = 0;
+};
+
+struct Node
+{
+    FabricTable fabrics;
+    FabricIndex fabricIndex;
+    GroupDataProviderImpl groupDataProvider;
+    TestPersistentStorageDelegate storage;
+    DefaultSessionKeystore sessionKeystore;
+    PersistentStorageOpCertStore opCertStore;
+};
+
+Node gInitiator;
+Node gResponder;
+BackgroundOperationalKeystore gResponderOperationalKeystore;
+
+CHIP_ERROR LoadKeypair(ByteSpan publicKey, ByteSpan privateKey, P256SerializedKeypair & outKeypair)
+{
+    memcpy(outKeypair.Bytes(), publicKey.data(), publicKey.size());
+    memcpy(outKeypair.Bytes() + publicKey.size(), privateKey.data(), privateKey.size());
+    return outKeypair.SetLength(publicKey.size() + privateKey.size());
+}
+
+CHIP_ERROR InitNode(Node & node, OperationalKeystore * opKeystore)
+{
+    node.storage.ClearStorage();
+    node.groupDataProvider.SetStorageDelegate(&node.storage);
+    node.groupDataProvider.SetSessionKeystore(&node.sessionKeystore);
+    ReturnErrorOnFailure(node.groupDataProvider.Init());
+    ReturnErrorOnFailure(node.opCertStore.Init(&node.storage));
+
+    FabricTable::InitParams initParams;
+    initParams.storage             = &node.storage;
+    initParams.operationalKeystore = opKeystore;
+    initParams.opCertStore         = &node.opCertStore;
+    return node.fabrics.Init(initParams);
+}
+
+CHIP_ERROR InitIpk(Node & node)
+{
+    using KeySet = GroupDataProvider::KeySet;
+
+    const FabricInfo * fabricInfo = node.fabrics.FindFabricWithIndex(node.fabricIndex);
+    VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INTERNAL);
+
+    KeySet ipkKeySet(GroupDataProvider::kIdentityProtectionKeySetId, GroupDataProvider::SecurityPolicy::kTrustFirst, 1);
+    ipkKeySet.epoch_keys[0].start_time = 0;
+    memset(&ipkKeySet.epoch_keys[0].key, 0, sizeof(ipkKeySet.epoch_keys[0].key));
+
+    uint8_t compressedId[sizeof(uint64_t)];
+    MutableByteSpan compressedIdSpan(compressedId);
+    ReturnErrorOnFailure(fabricInfo->GetCompressedFabricIdBytes(compressedIdSpan));
+    return node.groupDataProvider.SetKeySet(node.fabricIndex, compressedIdSpan, ipkKeySet);
+}
+
+CHIP_ERROR InitNodes()
+{
+    P256SerializedKeypair initiatorKeypair;
+    ReturnErrorOnFailure(LoadKeypair(sTestCert_Node01_02_PublicKey, sTestCert_Node01_02_PrivateKey, initiatorKeypair));
+    ReturnErrorOnFailure(InitNode(gInitiator, nullptr));
+    ReturnErrorOnFailure(gInitiator.fabrics.AddNewFabricForTest(
+        ByteSpan(sTestCert_Root01_Chip), ByteSpan(sTestCert_ICA01_Chip), ByteSpan(sTestCert_Node01_02_Chip),
+        ByteSpan(initiatorKeypair.ConstBytes(), initiatorKeypair.Length()), &gInitiator.fabricIndex));
+    ReturnErrorOnFailure(InitIpk(gInitiator));
+
+    // The responder signs with an injected operational key, so that Sigma2 is signed in the background.
+    P256SerializedKeypair responderKeypair;
+    ReturnErrorOnFailure(LoadKeypair(sTestCert_Node01_01_PublicKey, sTestCert_Node01_01_PrivateKey, responderKeypair));
+    auto responderOpKey = Platform::MakeUnique<P256Keypair>();
+    VerifyOrReturnError(responderOpKey, CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(responderOpKey->Deserialize(responderKeypair));
+    gResponderOperationalKeystore.Init(1, std::move(responderOpKey));
+    ReturnErrorOnFailure(InitNode(gResponder, &gResponderOperationalKeystore));
+    ReturnErrorOnFailure(gResponder.fabrics.AddNewFabricForTest(ByteSpan(sTestCert_Root01_Chip), ByteSpan(sTestCert_ICA01_Chip),
+                                                                ByteSpan(sTestCert_Node01_01_Chip), ByteSpan{},
+                                                                &gResponder.fabricIndex));
+    return InitIpk(gResponder);
+}
+
+} // namespace
+
+class BenchmarkCASESession : public Test::LoopbackMessagingContext
+{
+public:
+    static void SetUpTestSuite()
+    {
+        LoopbackMessagingContext::SetUpTestSuite();
+        ASSERT_EQ(DeviceLayer::PlatformMgr().InitChipStack(), CHIP_NO_ERROR);
+        ASSERT_EQ(InitNodes(), CHIP_NO_ERROR);
+        DeviceLayer::SetSystemLayerForTesting(&GetSystemLayer());
+    }
+
+    static void TearDownTestSuite()
+    {
+        DeviceLayer::SetSystemLayerForTesting(nullptr);
+        gInitiator.fabrics.DeleteAllFabrics();
+        gResponder.fabrics.DeleteAllFabrics();
+        gResponderOperationalKeystore.Shutdown();
+        DeviceLayer::PlatformMgr().Shutdown();
+        LoopbackMessagingContext::TearDownTestSuite();
+    }
+
+    void SetUp() override
+    {
+        ConfigInitializeNodes(false);
+        LoopbackMessagingContext::SetUp();
+    }
+
+    // Runs kRounds of kConcurrentHandshakes concurrent handshakes, and returns the time they took.
+    System::Clock::Microseconds64 EstablishSessions();
+};
+
+System::Clock::Microseconds64 BenchmarkCASESession::EstablishSessions()
+{
+    ResponderPool responderPool;
+    EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1,
+                                                                            &responderPool),
+              CHIP_NO_ERROR);
+
+    System::Clock::Microseconds64 elapsed(0);
+    for (size_t round = 0; round < kRounds; round++)
+    {
+        HandshakeDelegate initiatorDelegate;
+        HandshakeDelegate responderDelegate;
+        CASESession * initiators[kConcurrentHandshakes];
+
+        System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        responderPool.mNextSession          = 0;
+        for (size_t i = 0; i < kConcurrentHandshakes; i++)
+        {
+            CASESession * responder = Platform::New<CASESession>();
+            responder->SetGroupDataProvider(&gResponder.groupDataProvider);
+            EXPECT_EQ(responder->PrepareForSessionEstablishment(GetSecureSessionManager(), &gResponder.fabrics, nullptr, nullptr,
+                                                                &responderDelegate, ScopedNodeId(), NullOptional),
+                      CHIP_NO_ERROR);
+            responderPool.mSessions[i] = responder;
+
+            initiators[i] = Platform::New<CASESession>();
+            initiators[i]->SetGroupDataProvider(&gInitiator.groupDataProvider);
+            EXPECT_EQ(initiators[i]->EstablishSession(GetSecureSessionManager(), &gInitiator.fabrics,
+                                                      ScopedNodeId{ kResponderNodeId, gInitiator.fabricIndex },
+                                                      NewUnauthenticatedExchangeToBob(initiators[i]), nullptr, nullptr,
+                                                      &initiatorDelegate, NullOptional),
+                      CHIP_NO_ERROR);
+        }
+
+        // Handling messages schedules the crypto work; its completion is posted back to the Matter thread.
+        auto finished = [&] {
+            size_t initiatorsDone = initiatorDelegate.mNumComplete + initiatorDelegate.mNumErrors;
+            size_t respondersDone = responderDelegate.mNumComplete + responderDelegate.mNumErrors;
+            return initiatorsDone + respondersDone == 2 * kConcurrentHandshakes;
+        };
+        for (size_t i = 0; i < kMaxServiceLoops && !finished(); i++)
+        {
+            DrainAndServiceIO();
+            DeviceLayer::PlatformMgr().ScheduleWork([](intptr_t) { DeviceLayer::PlatformMgr().StopEventLoopTask(); });
+            DeviceLayer::PlatformMgr().RunEventLoop();
+        }
+        elapsed += System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+        EXPECT_EQ(initiatorDelegate.mNumComplete, kConcurrentHandshakes);
+        EXPECT_EQ(responderDelegate.mNumComplete, kConcurrentHandshakes);
+        EXPECT_EQ(initiatorDelegate.mNumErrors, 0u);
+        EXPECT_EQ(responderDelegate.mNumErrors, 0u);
+
+        for (size_t i = 0; i < kConcurrentHandshakes; i++)
+        {
+            Platform::Delete(initiators[i]);
+            Platform::Delete(responderPool.mSessions[i]);
+            responderPool.mSessions[i] = nullptr;
+        }
+        GetSecureSessionManager().ExpireAllSecureSessions();
+        DrainAndServiceIO();
+    }
+
+    EXPECT_EQ(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1),
+              CHIP_NO_ERROR);
+    return elapsed;
+}
+
+TEST_F(BenchmarkCASESession, SessionsPerSecond)
+{
+    constexpr uint64_t kSessionCount = kRounds * kConcurrentHandshakes;
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    // Without background tasks, background work falls back to the Matter thread.
+    ASSERT_EQ(DeviceLayer::PlatformMgr().StopBackgroundEventLoopTask(), CHIP_NO_ERROR);
+#endif
+    System::Clock::Microseconds64 matterThread = EstablishSessions();
+    ChipLogProgress(SecureChannel, "%" PRIu64 " CASE sessions on the Matter thread: %" PRIu64 " us, %" PRIu64 " sessions/s",
+                    kSessionCount, matterThread.count(), kSessionCount * 1000000 / std::max<uint64_t>(matterThread.count(), 1));
+
+#if CHIP_DEVICE_CONFIG_ENABLE_BG_EVENT_PROCESSING
+    ASSERT_EQ(DeviceLayer::PlatformMgr().StartBackgroundEventLoopTask(), CHIP_NO_ERROR);
+    System::Clock::Microseconds64 background = EstablishSessions();
+    ChipLogProgress(SecureChannel,
+                    "%" PRIu64 " CASE sessions on %u background task(s): %" PRIu64 " us, %" PRIu64 " sessions/s", kSessionCount,
+                    static_cast<unsigned>(CHIP_DEVICE_CONFIG_BG_TASK_COUNT), background.count(),
+                    kSessionCount * 1000000 / std::max<uint64_t>(background.count(), 1));
+#endif
+}
@@ -78,6 +78,9 @@ public:
                                           TestCASESecurePairingDelegate & delegateCommissioner);
 
     void SimulateUpdateNOCInvalidatePendingEstablishment();
+    void CancelWhileSendSigma2Pending();
+    void TimeoutWhileHandleSigma2Pending();
+    void ReleaseWhileHandleSigma2Pending();
 };
 
 void TestCASESession::ServiceEvents()
@@ -145,6 +148,7 @@ class TestCASESecurePairingDelegate : public SessionEstablishmentDelegate
 public:
     void OnSessionEstablishmentError(CHIP_ERROR error) override
     {
+        mLastError = error;
         mNumPairingErrors++;
         if (error == CHIP_ERROR_BUSY)
         {
@@ -161,6 +165,7 @@ public:
     SessionHolder & GetSessionHolder() { return mSession; }
 
     SessionHolder mSession;
+    CHIP_ERROR mLastError = CHIP_NO_ERROR;
 
     // TODO: Rename mNumPairing* to mNumEstablishment*
     uint32_t mNumPairingErrors   = 0;
@@ -181,6 +186,7 @@ public:
         mSingleFabricIndex = kUndefinedFabricIndex;
         mKeypair           = nullptr;
     }
+    void SetSupportsSignWithOpKeypairInBackground(bool supported) { mSupportsSignInBackground = supported; }
 
     bool HasPendingOpKeypair() const override { return false; }
     bool HasOpKeypairForFabric(FabricIndex fabricIndex) const override { return mSingleFabricIndex != kUndefinedFabricIndex; }
@@ -200,6 +206,8 @@ public:
 
     void RevertPendingKeypair() override {}
 
+    bool SupportsSignWithOpKeypairInBackground() const override { return mSupportsSignInBackground; }
+
     CHIP_ERROR SignWithOpKeypair(FabricIndex fabricIndex, const ByteSpan & message,
                                  Crypto::P256ECDSASignature & outSignature) const override
     {
@@ -215,6 +223,7 @@ public:
 protected:
     Platform::UniquePtr<P256Keypair> mKeypair;
     FabricIndex mSingleFabricIndex = kUndefinedFabricIndex;
+    bool mSupportsSignInBackground = false;
 };
 
 #if CHIP_CONFIG_SLOW_CRYPTO
@@ -1085,6 +1094,140 @@ TEST_F_FROM_FIXTURE(TestCASESession, SimulateUpdateNOCInvalidatePendingEstablish
 }
 #endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
 
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+TEST_F_FROM_FIXTURE(TestCASESession, CancelWhileSendSigma2Pending)
+{
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegateCommissioner;
+    CASESession pairingCommissioner;
+    pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+
+    TestCASESecurePairingDelegate delegateAccessory;
+    CASESession pairingAccessory;
+    pairingAccessory.SetGroupDataProvider(&gDeviceGroupDataProvider);
+
+    // Sign Sigma2 as background work, so that the accessory waits for it in kSendSigma2Pending.
+    gDeviceOperationalKeystore.SetSupportsSignWithOpKeypairInBackground(true);
+
+    EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1,
+                                                                            &pairingAccessory),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(pairingAccessory.PrepareForSessionEstablishment(sessionManager, &gDeviceFabrics, nullptr, nullptr, &delegateAccessory,
+                                                              ScopedNodeId(), NullOptional),
+              CHIP_NO_ERROR);
+
+    ExchangeContext * contextCommissioner = NewUnauthenticatedExchangeToBob(&pairingCommissioner);
+    EXPECT_EQ(pairingCommissioner.EstablishSession(sessionManager, &gCommissionerFabrics,
+                                                   ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner,
+                                                   nullptr, nullptr, &delegateCommissioner, NullOptional),
+              CHIP_NO_ERROR);
+
+    // Deliver Sigma1, but do not run the scheduled work yet.
+    DrainAndServiceIO();
+    EXPECT_EQ(pairingAccessory.GetState(), CASESession::State::kSendSigma2Pending);
+
+    // Updating the fabric cancels the establishment while the signature is outstanding.
+    gDeviceFabrics.SendUpdateFabricNotificationForTest(gDeviceFabricIndex);
+    EXPECT_EQ(pairingAccessory.GetState(), CASESession::State::kInitialized);
+    EXPECT_EQ(delegateAccessory.mNumPairingErrors, 1u);
+    EXPECT_EQ(delegateAccessory.mLastError, CHIP_ERROR_CANCELLED);
+
+    // The outstanding work must not resume the cancelled session, so Sigma2 is never sent.
+    ServiceEvents();
+    EXPECT_EQ(pairingAccessory.GetState(), CASESession::State::kInitialized);
+    EXPECT_EQ(pairingCommissioner.GetState(), CASESession::State::kSentSigma1);
+    EXPECT_EQ(delegateAccessory.mNumPairingErrors, 1u);
+    EXPECT_EQ(delegateAccessory.mNumPairingComplete, 0u);
+    EXPECT_EQ(delegateCommissioner.mNumPairingComplete, 0u);
+
+    gDeviceOperationalKeystore.SetSupportsSignWithOpKeypairInBackground(false);
+}
+#endif // CONFIG_BUILD_FOR_HOST_UNIT_TEST
+
+TEST_F_FROM_FIXTURE(TestCASESession, TimeoutWhileHandleSigma2Pending)
+{
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegateCommissioner;
+    CASESession pairingCommissioner;
+    pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+
+    TestCASESecurePairingDelegate delegateAccessory;
+    CASESession pairingAccessory;
+    pairingAccessory.SetGroupDataProvider(&gDeviceGroupDataProvider);
+
+    EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1,
+                                                                            &pairingAccessory),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(pairingAccessory.PrepareForSessionEstablishment(sessionManager, &gDeviceFabrics, nullptr, nullptr, &delegateAccessory,
+                                                              ScopedNodeId(), NullOptional),
+              CHIP_NO_ERROR);
+
+    ExchangeContext * contextCommissioner = NewUnauthenticatedExchangeToBob(&pairingCommissioner);
+    EXPECT_EQ(pairingCommissioner.EstablishSession(sessionManager, &gCommissionerFabrics,
+                                                   ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner,
+                                                   nullptr, nullptr, &delegateCommissioner, NullOptional),
+              CHIP_NO_ERROR);
+
+    // Deliver Sigma1 and Sigma2, but do not run the initiator's Sigma2 validation yet.
+    DrainAndServiceIO();
+    EXPECT_EQ(pairingAccessory.GetState(), CASESession::State::kSentSigma2);
+    EXPECT_EQ(pairingCommissioner.GetState(), CASESession::State::kHandleSigma2Pending);
+
+    // Time the exchange out while the validation is outstanding.
+    ExchangeContext * exchange = &pairingCommissioner.mExchangeCtxt.Value().Get();
+    pairingCommissioner.OnResponseTimeout(exchange);
+    exchange->Abort();
+    EXPECT_EQ(pairingCommissioner.GetState(), CASESession::State::kInitialized);
+    EXPECT_EQ(delegateCommissioner.mNumPairingErrors, 1u);
+    EXPECT_EQ(delegateCommissioner.mLastError, CHIP_ERROR_TIMEOUT);
+
+    // The outstanding work must not resume the timed out session, so Sigma3 is never sent.
+    ServiceEvents();
+    EXPECT_EQ(pairingCommissioner.GetState(), CASESession::State::kInitialized);
+    EXPECT_EQ(pairingAccessory.GetState(), CASESession::State::kSentSigma2);
+    EXPECT_EQ(delegateCommissioner.mNumPairingErrors, 1u);
+    EXPECT_EQ(delegateCommissioner.mNumPairingComplete, 0u);
+    EXPECT_EQ(delegateAccessory.mNumPairingComplete, 0u);
+}
+
+TEST_F_FROM_FIXTURE(TestCASESession, ReleaseWhileHandleSigma2Pending)
+{
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegateCommissioner;
+    auto * pairingCommissioner = chip::Platform::New<CASESession>();
+    ASSERT_NE(pairingCommissioner, nullptr);
+    pairingCommissioner->SetGroupDataProvider(&gCommissionerGroupDataProvider);
+
+    TestCASESecurePairingDelegate delegateAccessory;
+    CASESession pairingAccessory;
+    pairingAccessory.SetGroupDataProvider(&gDeviceGroupDataProvider);
+
+    EXPECT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::SecureChannel::MsgType::CASE_Sigma1,
+                                                                            &pairingAccessory),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(pairingAccessory.PrepareForSessionEstablishment(sessionManager, &gDeviceFabrics, nullptr, nullptr, &delegateAccessory,
+                                                              ScopedNodeId(), NullOptional),
+              CHIP_NO_ERROR);
+
+    ExchangeContext * contextCommissioner = NewUnauthenticatedExchangeToBob(pairingCommissioner);
+    EXPECT_EQ(pairingCommissioner->EstablishSession(sessionManager, &gCommissionerFabrics,
+                                                    ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner,
+                                                    nullptr, nullptr, &delegateCommissioner, NullOptional),
+              CHIP_NO_ERROR);
+
+    DrainAndServiceIO();
+    EXPECT_EQ(pairingCommissioner->GetState(), CASESession::State::kHandleSigma2Pending);
+
+    // Destroy the session while the validation is outstanding, as its owner does when giving up on it.
+    chip::Platform::Delete(pairingCommissioner);
+
+    // The outstanding work must not touch the destroyed session.
+    ServiceEvents();
+    EXPECT_EQ(pairingAccessory.GetState(), CASESession::State::kSentSigma2);
+    EXPECT_EQ(delegateCommissioner.mNumPairingComplete, 0u);
+    EXPECT_EQ(delegateAccessory.mNumPairingComplete, 0u);
+}
+
 class ExpectErrorExchangeDelegate : public ExchangeDelegate
 {
 public:
@@ -117,6 +117,10 @@
     "FORBIDDEN: CHIP_SYSTEM_CONFIG_USE_OPEN_THREAD_ENDPOINT && ( CHIP_SYSTEM_CONFIG_USE_NETWORK_FRAMEWORK || CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_LWIP )"
 #endif
 
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL && !CHIP_SYSTEM_CONFIG_USE_SOCKETS
+#error "FORBIDDEN: CHIP_SYSTEM_CONFIG_USE_EPOLL CAN ONLY BE USED WITH SOCKET IMPL"
+#endif
+
 #if CHIP_SYSTEM_CONFIG_MULTICAST_HOMING && !CHIP_SYSTEM_CONFIG_USE_SOCKETS
 #error "FORBIDDEN: CHIP_SYSTEM_CONFIG_MULTICAST_HOMING CAN ONLY BE USED WITH SOCKET IMPL"
 #endif
@@ -512,6 +516,20 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP
+ *
+ *  @brief
+ *      Keep pending timers in a heap indexed by callback (1) instead of a sorted list (0).
+ *
+ *      Starting and cancelling a timer is linear in the number of pending timers with the sorted list and logarithmic with
+ *      the heap, at the cost of a few extra pointers per timer. This matters for configurations where timers are not
+ *      bounded by a small fixed pool, so it defaults to CHIP_SYSTEM_CONFIG_POOL_USE_HEAP.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP
+#define CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
  *
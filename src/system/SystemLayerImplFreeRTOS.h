@@ -56,7 +56,7 @@ private:
     CHIP_ERROR StartPlatformTimer(System::Clock::Timeout aDelay);
 
     TimerPool<TimerList::Node> mTimerPool;
-    TimerList mTimerList;
+    TimerQueue mTimerList;
     bool mHandlingTimerComplete; // true while handling any timer completion
     ObjectLifeCycle mLayerState;
 };
@@ -57,8 +57,16 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
     "Platform events",
 };
 
+static const Label sCounterStrings[chip::System::Stats::kNumCounters] = {
+    "UDP send syscalls",
+    "UDP sent packet buffers",
+    "UDP receive syscalls",
+    "UDP received packets",
+};
+
 count_t sResourcesInUse[kNumEntries];
 count_t sHighWatermarks[kNumEntries];
+counter_value_t sCounters[kNumCounters];
 
 const Label * GetStrings()
 {
@@ -75,6 +83,21 @@ count_t * GetHighWatermarks()
     return sHighWatermarks;
 }
 
+counter_value_t * GetCounters()
+{
+    return sCounters;
+}
+
+const Label * GetCounterStrings()
+{
+    return sCounterStrings;
+}
+
+void ResetCounters()
+{
+    memset(sCounters, 0, sizeof(sCounters));
+}
+
 void UpdateSnapshot(Snapshot & aSnapshot)
 {
     memcpy(&aSnapshot.mResourcesInUse, &sResourcesInUse, sizeof(aSnapshot.mResourcesInUse));
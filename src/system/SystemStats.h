@@ -93,6 +93,24 @@ void UpdateLwipPbufCounts(void);
 typedef const char * Label;
 const Label * GetStrings();
 
+/**
+ * Cumulative event counters, as opposed to the resources in use above. They only ever increase, until reset.
+ */
+enum Counter
+{
+    kInetLayer_UDPSendSyscalls,
+    kInetLayer_UDPSendPacketBuffers,
+    kInetLayer_UDPReceiveSyscalls,
+    kInetLayer_UDPReceivePackets,
+    kNumCounters
+};
+
+typedef uint32_t counter_value_t;
+
+counter_value_t * GetCounters();
+const Label * GetCounterStrings();
+void ResetCounters();
+
 } // namespace Stats
 } // namespace System
 } // namespace chip
@@ -147,6 +165,12 @@ const Label * GetStrings();
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP && LWIP_STATS && MEMP_STATS
 
+#define SYSTEM_STATS_COUNT(counter, count)                                                                                         \
+    do                                                                                                                             \
+    {                                                                                                                              \
+        chip::System::Stats::GetCounters()[counter] += static_cast<chip::System::Stats::counter_value_t>(count);                   \
+    } while (0)
+
 // Additional macros for testing.
 #define SYSTEM_STATS_TEST_IN_USE(entry, expected) (chip::System::Stats::GetResourcesInUse()[entry] == (expected))
 #define SYSTEM_STATS_TEST_HIGH_WATER_MARK(entry, expected) (chip::System::Stats::GetHighWatermarks()[entry] == (expected))
@@ -168,6 +192,8 @@ const Label * GetStrings();
 
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()
 
+#define SYSTEM_STATS_COUNT(counter, count)
+
 #define SYSTEM_STATS_TEST_IN_USE(entry, expected) (true)
 #define SYSTEM_STATS_TEST_HIGH_WATER_MARK(entry, expected) (true)
 #define SYSTEM_STATS_RESET_HIGH_WATER_MARK_FOR_TESTING(entry)
@@ -178,5 +178,245 @@ Clock::Timeout TimerList::GetRemainingTime(TimerCompleteCallback aOnComplete, vo
     return Clock::kZero;
 }
 
+#if CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP
+
+bool TimerHeap::IsEarlier(const Node * a, const Node * b)
+{
+    return (a->AwakenTime() < b->AwakenTime()) || ((a->AwakenTime() == b->AwakenTime()) && (a->mSequence < b->mSequence));
+}
+
+TimerHeap::Node * TimerHeap::Meld(Node * a, Node * b)
+{
+    // Both a and b are detached heap roots; the later one becomes the first child of the earlier one.
+    if (IsEarlier(b, a))
+    {
+        Node * tmp = a;
+        a          = b;
+        b          = tmp;
+    }
+    b->mHeapPrev    = a;
+    b->mHeapSibling = a->mHeapChild;
+    if (a->mHeapChild != nullptr)
+    {
+        a->mHeapChild->mHeapPrev = b;
+    }
+    a->mHeapChild = b;
+    return a;
+}
+
+TimerHeap::Node * TimerHeap::MergePairs(Node * first)
+{
+    VerifyOrReturnValue(first != nullptr, nullptr);
+
+    // First pass: meld siblings pairwise from left to right, collecting the results in reverse order.
+    Node * pairs = nullptr;
+    while (first != nullptr)
+    {
+        Node * a = first;
+        Node * b = a->mHeapSibling;
+        first    = (b != nullptr) ? b->mHeapSibling : nullptr;
+
+        a->mHeapSibling = nullptr;
+        a->mHeapPrev    = nullptr;
+        if (b != nullptr)
+        {
+            b->mHeapSibling = nullptr;
+            b->mHeapPrev    = nullptr;
+            a               = Meld(a, b);
+        }
+        a->mHeapSibling = pairs;
+        pairs           = a;
+    }
+
+    // Second pass: meld the pairs from right to left.
+    Node * result        = pairs;
+    pairs                = pairs->mHeapSibling;
+    result->mHeapSibling = nullptr;
+    while (pairs != nullptr)
+    {
+        Node * next         = pairs->mHeapSibling;
+        pairs->mHeapSibling = nullptr;
+        result              = Meld(result, pairs);
+        pairs               = next;
+    }
+    return result;
+}
+
+size_t TimerHeap::BucketFor(void * appState)
+{
+    static_assert((kBucketCount & (kBucketCount - 1)) == 0, "kBucketCount must be a power of two");
+
+    // App states are aligned pointers, so take the bucket from the well-mixed high bits of a multiplicative hash.
+    const uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(appState)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(hash >> 32) & (kBucketCount - 1);
+}
+
+TimerHeap::Node * TimerHeap::Find(TimerCompleteCallback onComplete, void * appState) const
+{
+    Node * found = nullptr;
+    for (Node * timer = mBuckets[BucketFor(appState)]; timer != nullptr; timer = timer->mBucketNext)
+    {
+        if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState &&
+            (found == nullptr || IsEarlier(timer, found)))
+        {
+            found = timer;
+        }
+    }
+    return found;
+}
+
+void TimerHeap::Unlink(Node * timer)
+{
+    if (timer == mRoot)
+    {
+        mRoot = MergePairs(timer->mHeapChild);
+    }
+    else
+    {
+        if (timer->mHeapPrev->mHeapChild == timer)
+        {
+            timer->mHeapPrev->mHeapChild = timer->mHeapSibling;
+        }
+        else
+        {
+            timer->mHeapPrev->mHeapSibling = timer->mHeapSibling;
+        }
+        if (timer->mHeapSibling != nullptr)
+        {
+            timer->mHeapSibling->mHeapPrev = timer->mHeapPrev;
+        }
+
+        Node * children = MergePairs(timer->mHeapChild);
+        if (children != nullptr)
+        {
+            mRoot = Meld(mRoot, children);
+        }
+    }
+
+    Node ** link = &mBuckets[BucketFor(timer->GetCallback().GetAppState())];
+    while (*link != timer)
+    {
+        VerifyOrDie(*link != nullptr);
+        link = &(*link)->mBucketNext;
+    }
+    *link = timer->mBucketNext;
+
+    timer->mHeapChild   = nullptr;
+    timer->mHeapSibling = nullptr;
+    timer->mHeapPrev    = nullptr;
+    timer->mBucketNext  = nullptr;
+    timer->mNextTimer   = nullptr;
+}
+
+TimerHeap::Node * TimerHeap::Add(Node * add)
+{
+    VerifyOrDie(!Contains(add));
+
+    add->mSequence    = mNextSequence++;
+    add->mHeapChild   = nullptr;
+    add->mHeapSibling = nullptr;
+    add->mHeapPrev    = nullptr;
+    add->mNextTimer   = nullptr;
+    mRoot             = (mRoot == nullptr) ? add : Meld(mRoot, add);
+
+    Node *& bucket   = mBuckets[BucketFor(add->GetCallback().GetAppState())];
+    add->mBucketNext = bucket;
+    bucket           = add;
+
+    return mRoot;
+}
+
+TimerHeap::Node * TimerHeap::Remove(Node * remove)
+{
+    if (remove != nullptr && mRoot != nullptr && Contains(remove))
+    {
+        Unlink(remove);
+    }
+    return mRoot;
+}
+
+TimerHeap::Node * TimerHeap::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = Find(aOnComplete, aAppState);
+    if (timer != nullptr)
+    {
+        Unlink(timer);
+    }
+    return timer;
+}
+
+TimerHeap::Node * TimerHeap::PopEarliest()
+{
+    Node * earliest = mRoot;
+    if (earliest != nullptr)
+    {
+        Unlink(earliest);
+    }
+    return earliest;
+}
+
+TimerHeap::Node * TimerHeap::PopIfEarlier(Clock::Timestamp t)
+{
+    if ((mRoot == nullptr) || !(mRoot->AwakenTime() < t))
+    {
+        return nullptr;
+    }
+    return PopEarliest();
+}
+
+TimerList TimerHeap::ExtractEarlier(Clock::Timestamp t)
+{
+    TimerList out;
+    TimerList::Node * last = nullptr;
+    TimerList::Node * timer;
+    while ((timer = PopIfEarlier(t)) != nullptr)
+    {
+        if (last == nullptr)
+        {
+            out.mEarliestTimer = timer;
+        }
+        else
+        {
+            last->mNextTimer = timer;
+        }
+        last = timer;
+    }
+    return out;
+}
+
+void TimerHeap::Clear()
+{
+    // Every timer is in exactly one bucket; detach them all so that they can be added again.
+    for (Node *& bucket : mBuckets)
+    {
+        while (bucket != nullptr)
+        {
+            Node * timer        = bucket;
+            bucket              = timer->mBucketNext;
+            timer->mHeapChild   = nullptr;
+            timer->mHeapSibling = nullptr;
+            timer->mHeapPrev    = nullptr;
+            timer->mBucketNext  = nullptr;
+            timer->mNextTimer   = nullptr;
+        }
+    }
+    mRoot = nullptr;
+}
+
+Clock::Timeout TimerHeap::GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = Find(aOnComplete, aAppState);
+    VerifyOrReturnValue(timer != nullptr, Clock::kZero);
+
+    Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    if (currentTime < timer->AwakenTime())
+    {
+        return Clock::Timeout(timer->AwakenTime() - currentTime);
+    }
+    return Clock::kZero;
+}
+
+#endif // CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP
+
 } // namespace System
 } // namespace chip
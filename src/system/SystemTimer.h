@@ -116,6 +116,16 @@ public:
             TimerData(systemLayer, awakenTime, onComplete, appState), mNextTimer(nullptr)
         {}
         Node * mNextTimer;
+
+#if CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP
+    private:
+        friend class TimerHeap;
+        Node * mHeapChild   = nullptr; // first child in the pairing heap
+        Node * mHeapSibling = nullptr; // next sibling in the pairing heap
+        Node * mHeapPrev    = nullptr; // previous sibling, or parent for a first child
+        Node * mBucketNext  = nullptr; // next timer in the same callback bucket
+        uint64_t mSequence  = 0;       // insertion order, to break ties between identical awaken times
+#endif // CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP
     };
 
     TimerList() : mEarliestTimer(nullptr) {}
@@ -186,9 +196,125 @@ public:
     Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
 
 private:
+#if CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP
+    friend class TimerHeap;
+#endif
     Node * mEarliestTimer;
 };
 
+#if CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP
+
+/**
+ * Queue of `Timer`s ordered by expiration time, with the same interface as TimerList.
+ *
+ * Timers are kept in a pairing heap, so that adding a timer takes constant time and removing one takes logarithmic
+ * (amortized) time. They are also chained in buckets hashed on their app state, so that looking a timer up by its
+ * callback does not visit every pending timer. As with TimerList, timers with the same expiration time are ordered
+ * by insertion.
+ */
+class TimerHeap
+{
+public:
+    using Node = TimerList::Node;
+
+    static constexpr size_t kBucketCount = 256;
+
+    TimerHeap() = default;
+
+    TimerHeap(const TimerHeap &)             = delete;
+    TimerHeap & operator=(const TimerHeap &) = delete;
+
+    /**
+     * Add a timer to the heap
+     *
+     * @return  The new earliest timer in the heap. If this is the newly added timer, that implies it is earlier
+     *          than any existing timer.
+     */
+    Node * Add(Node * timer);
+
+    /**
+     * Remove the given timer from the heap, if present. It is not an error for the timer not to be present.
+     *
+     * @return  The new earliest timer in the heap, or nullptr if the heap is empty.
+     */
+    Node * Remove(Node * remove);
+
+    /**
+     * Remove the earliest timer with the given properties, if present. It is not an error for no such timer to be present.
+     *
+     * @return  The removed timer, or nullptr if the heap contains no matching timer.
+     */
+    Node * Remove(TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * Remove and return the earliest timer in the heap.
+     *
+     * @return  The earliest timer, or nullptr if the heap is empty.
+     */
+    Node * PopEarliest();
+
+    /**
+     * Remove and return the earliest timer in the heap, provided it expires earlier than the given time @a t.
+     *
+     * @return  The earliest timer expiring before @a t, or nullptr if there is no such timer.
+     */
+    Node * PopIfEarlier(Clock::Timestamp t);
+
+    /**
+     * Get the earliest timer in the heap.
+     *
+     * @return  The earliest timer, or nullptr if there are no timers.
+     */
+    Node * Earliest() const { return mRoot; }
+
+    /**
+     * Test whether there are any timers.
+     */
+    bool Empty() const { return mRoot == nullptr; }
+
+    /**
+     * Remove and return all timers that expire before the given time @a t, as a list ordered by expiration time.
+     */
+    TimerList ExtractEarlier(Clock::Timestamp t);
+
+    /**
+     * Remove all timers.
+     */
+    void Clear();
+
+    /**
+     * Find the earliest timer with the given properties, if present, and return its remaining time
+     *
+     * @return The remaining time on this particular timer or 0 if not found.
+     */
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
+
+private:
+    static bool IsEarlier(const Node * a, const Node * b);
+    static Node * Meld(Node * a, Node * b);
+    static Node * MergePairs(Node * first);
+    static size_t BucketFor(void * appState);
+
+    bool Contains(const Node * timer) const { return (timer == mRoot) || (timer->mHeapPrev != nullptr); }
+    Node * Find(TimerCompleteCallback onComplete, void * appState) const;
+    void Unlink(Node * timer);
+
+    Node * mRoot                  = nullptr;
+    Node * mBuckets[kBucketCount] = {};
+    uint64_t mNextSequence        = 0;
+};
+
+/**
+ * Queue of pending timers used by the System::Layer implementations.
+ */
+using TimerQueue = TimerHeap;
+
+#else
+
+using TimerQueue = TimerList;
+
+#endif // CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP
+
 /**
  * ObjectPool wrapper that keeps System Timer statistics.
  */
@@ -0,0 +1,118 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Timing benchmark for heap allocated <tt>chip::System::PacketBuffer</tt>s
+ *      allocated and freed concurrently by several threads.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+#include <system/SystemPacketBuffer.h>
+
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP && CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <pthread.h>
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP && CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+using ::chip::System::PacketBuffer;
+using ::chip::System::PacketBufferHandle;
+using ::chip::System::SystemClock;
+
+class BenchmarkSystemPacketBuffer : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP && CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+namespace {
+
+constexpr size_t kBenchmarkThreads     = 4;
+constexpr size_t kBenchmarkIterations  = 20000;
+constexpr size_t kBenchmarkBuffersHeld = 8;
+
+struct BenchmarkThreadState
+{
+    uint8_t id;
+    bool ok;
+};
+
+void * AllocFreeLoop(void * context)
+{
+    auto * state = static_cast<BenchmarkThreadState *>(context);
+    state->ok    = true;
+
+    // Hold a few buffers at a time, mixing small (e.g. acks) and full sized messages, as the message layer does.
+    PacketBufferHandle held[kBenchmarkBuffersHeld];
+    for (size_t i = 0; i < kBenchmarkIterations; i++)
+    {
+        PacketBufferHandle & slot = held[i % kBenchmarkBuffersHeld];
+        const size_t size         = (i % 3 == 0) ? PacketBuffer::kMaxSizeWithoutReserve : 64;
+        slot                      = PacketBufferHandle::New(size);
+        if (slot.IsNull() || slot->AvailableDataLength() < size)
+        {
+            state->ok = false;
+            break;
+        }
+        memset(slot->Start(), state->id, size);
+        slot->SetDataLength(size);
+
+        const PacketBufferHandle & previous = held[(i + kBenchmarkBuffersHeld - 1) % kBenchmarkBuffersHeld];
+        if (!previous.IsNull() && (previous->Start()[0] != state->id || previous->Start()[previous->DataLength() - 1] != state->id))
+        {
+            state->ok = false;
+            break;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+TEST_F(BenchmarkSystemPacketBuffer, ConcurrentAllocFree)
+{
+    pthread_t threads[kBenchmarkThreads];
+    BenchmarkThreadState states[kBenchmarkThreads];
+
+    const uint64_t start = SystemClock().GetMonotonicMicroseconds64().count();
+    for (size_t i = 0; i < kBenchmarkThreads; i++)
+    {
+        states[i] = { static_cast<uint8_t>(i + 1), false };
+        ASSERT_EQ(0, pthread_create(&threads[i], nullptr, AllocFreeLoop, &states[i]));
+    }
+    for (size_t i = 0; i < kBenchmarkThreads; i++)
+    {
+        EXPECT_EQ(0, pthread_join(threads[i], nullptr));
+        EXPECT_TRUE(states[i].ok);
+    }
+    const uint64_t end = SystemClock().GetMonotonicMicroseconds64().count();
+
+    ChipLogProgress(Test, "%u threads x %u buffer allocations: %u us", static_cast<unsigned>(kBenchmarkThreads),
+                    static_cast<unsigned>(kBenchmarkIterations), static_cast<unsigned>(end - start));
+}
+
+#endif // CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP && CHIP_SYSTEM_CONFIG_POSIX_LOCKING
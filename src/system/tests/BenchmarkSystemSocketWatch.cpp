@@ -0,0 +1,173 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Timing benchmark of the wakeup latency and CPU cost per socket event of
+ *      a LayerSocketsLoop, at different watched socket counts.
+ *
+ *      The number of sockets a layer can watch is the number of Inet endpoints
+ *      (INET_CONFIG_NUM_TCP_ENDPOINTS + INET_CONFIG_NUM_UDP_ENDPOINTS); larger
+ *      counts are measured at that capacity, so raise those to benchmark them.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemConfig.h>
+#include <system/SystemLayerImpl.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::System;
+
+namespace {
+
+constexpr size_t kSocketCounts[]    = { 1, 8, 32, 64, 256, 1024 };
+constexpr int kEventsPerMeasurement = 200;
+
+struct WatchedPipe
+{
+    int fds[2]             = { kInvalidFd, kInvalidFd };
+    SocketWatchToken token = 0;
+    unsigned callbackCount = 0;
+};
+
+void HandlePipeReadable(SocketEvents events, intptr_t data)
+{
+    auto * pipe = reinterpret_cast<WatchedPipe *>(data);
+    pipe->callbackCount++;
+
+    uint8_t byte;
+    (void) read(pipe->fds[0], &byte, sizeof(byte));
+}
+
+uint64_t CpuTimeMicroseconds()
+{
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<uint64_t>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000u +
+        static_cast<uint64_t>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+class BenchmarkSystemSocketWatch : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override { ASSERT_EQ(mLayer.Init(), CHIP_NO_ERROR); }
+
+    void TearDown() override
+    {
+        UnwatchPipes();
+        mLayer.Shutdown();
+    }
+
+    // Open and watch up to `count` pipes; returns the number actually watched, which is
+    // limited by the socket watch capacity of the layer.
+    size_t WatchPipes(size_t count)
+    {
+        // Pipes are referenced by their callbacks, so they must not move once watched.
+        mPipes.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            WatchedPipe p;
+            if (pipe(p.fds) != 0)
+            {
+                break;
+            }
+            if (mLayer.StartWatchingSocket(p.fds[0], &p.token) != CHIP_NO_ERROR)
+            {
+                close(p.fds[0]);
+                close(p.fds[1]);
+                break;
+            }
+            mPipes.push_back(p);
+            WatchedPipe & watched = mPipes.back();
+            EXPECT_EQ(mLayer.SetCallback(watched.token, HandlePipeReadable, reinterpret_cast<intptr_t>(&watched)), CHIP_NO_ERROR);
+            EXPECT_EQ(mLayer.RequestCallbackOnPendingRead(watched.token), CHIP_NO_ERROR);
+        }
+        return mPipes.size();
+    }
+
+    void UnwatchPipes()
+    {
+        for (auto & p : mPipes)
+        {
+            mLayer.StopWatchingSocket(&p.token);
+            close(p.fds[0]);
+            close(p.fds[1]);
+        }
+        mPipes.clear();
+    }
+
+    void ServiceEvents()
+    {
+        mLayer.PrepareEvents();
+        mLayer.WaitForEvents();
+        mLayer.HandleEvents();
+    }
+
+    LayerImpl mLayer;
+    std::vector<WatchedPipe> mPipes;
+};
+
+TEST_F(BenchmarkSystemSocketWatch, WakeupCostVersusWatchedSockets)
+{
+    for (size_t count : kSocketCounts)
+    {
+        // Counts above the capacity of the layer are measured once, at that capacity.
+        const size_t watched = WatchPipes(count);
+        ASSERT_GT(watched, 0u);
+
+        const Clock::Microseconds64 start = SystemClock().GetMonotonicMicroseconds64();
+        const uint64_t cpuStart           = CpuTimeMicroseconds();
+        for (int i = 0; i < kEventsPerMeasurement; i++)
+        {
+            WatchedPipe & p = mPipes[static_cast<size_t>(i) % watched];
+            ASSERT_EQ(write(p.fds[1], "x", 1), 1);
+            ServiceEvents();
+            ASSERT_EQ(p.callbackCount, static_cast<unsigned>(static_cast<size_t>(i) / watched + 1));
+        }
+        const uint64_t cpuUs     = CpuTimeMicroseconds() - cpuStart;
+        const uint64_t elapsedUs = (SystemClock().GetMonotonicMicroseconds64() - start).count();
+
+        ChipLogProgress(Test, "%u watched sockets%s: %u us/event wall, %u us/event CPU", static_cast<unsigned>(watched),
+                        (watched < count) ? " (layer capacity)" : "", static_cast<unsigned>(elapsedUs / kEventsPerMeasurement),
+                        static_cast<unsigned>(cpuUs / kEventsPerMeasurement));
+
+        UnwatchPipes();
+        if (watched < count)
+        {
+            break;
+        }
+    }
+}
+
+} // namespace
+
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH && !CHIP_SYSTEM_CONFIG_USE_LIBEV
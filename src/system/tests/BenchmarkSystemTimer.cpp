@@ -0,0 +1,127 @@
+/*
+ *
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Timing benchmark comparing the <tt>chip::System</tt> timer queues
+ *      (TimerList and TimerHeap) with many pending timers.
+ */
+
+#include <stdint.h>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemConfig.h>
+#include <system/SystemLayerImpl.h>
+#include <system/SystemTimer.h>
+
+namespace chip {
+namespace System {
+
+class BenchmarkSystemTimer : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(::chip::Platform::MemoryInit(), CHIP_NO_ERROR);
+        mLayer.Init();
+    }
+
+    static void TearDownTestSuite()
+    {
+        mLayer.Shutdown();
+        ::chip::Platform::MemoryShutdown();
+    }
+
+    static LayerImpl mLayer;
+};
+
+LayerImpl BenchmarkSystemTimer::mLayer;
+
+#if CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP
+
+namespace {
+
+struct TimerQueueBenchmarkState
+{
+    static void Callback(Layer * layer, void * state) {}
+};
+
+template <typename Queue>
+void BenchmarkTimerQueue(Layer & layer, const char * name)
+{
+    constexpr size_t kNumTimers = 10000;
+    using Timer                 = TimerList::Node;
+
+    static uint8_t sAppStates[kNumTimers];
+    chip::Platform::ScopedMemoryBuffer<Timer *> timers;
+    ASSERT_TRUE(timers.Calloc(kNumTimers));
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        // Spread over a retransmission-like range of timeouts, in no particular order.
+        timers[i] = chip::Platform::New<Timer>(layer, Clock::Timestamp((i * 7919) % 30000), TimerQueueBenchmarkState::Callback,
+                                               &sAppStates[i]);
+        ASSERT_NE(timers[i], nullptr);
+    }
+
+    Queue queue;
+    uint64_t start = SystemClock().GetMonotonicMicroseconds64().count();
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        queue.Add(timers[i]);
+    }
+    uint64_t added = SystemClock().GetMonotonicMicroseconds64().count();
+    for (size_t i = 0; i < kNumTimers; i += 2)
+    {
+        // Like Layer::CancelTimer, look the timer up by its callback.
+        EXPECT_EQ(queue.Remove(TimerQueueBenchmarkState::Callback, &sAppStates[i]), timers[i]);
+    }
+    uint64_t cancelled = SystemClock().GetMonotonicMicroseconds64().count();
+    size_t expired     = 0;
+    while (queue.PopIfEarlier(Clock::Timestamp(30000)) != nullptr)
+    {
+        expired++;
+    }
+    uint64_t end = SystemClock().GetMonotonicMicroseconds64().count();
+    EXPECT_EQ(expired, kNumTimers / 2);
+
+    ChipLogProgress(Test, "%s with %u timers: start %u us, cancel %u us, expire %u us", name, static_cast<unsigned>(kNumTimers),
+                    static_cast<unsigned>(added - start), static_cast<unsigned>(cancelled - added),
+                    static_cast<unsigned>(end - cancelled));
+
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        chip::Platform::Delete(timers[i]);
+    }
+}
+
+} // namespace
+
+TEST_F(BenchmarkSystemTimer, TimerQueue)
+{
+    BenchmarkTimerQueue<TimerList>(mLayer, "TimerList");
+    BenchmarkTimerQueue<TimerHeap>(mLayer, "TimerHeap");
+}
+
+#endif // CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP
+
+} // namespace System
+} // namespace chip
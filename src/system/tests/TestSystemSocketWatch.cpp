@@ -0,0 +1,226 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for socket watching in a LayerSocketsLoop.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <system/SystemConfig.h>
+#include <system/SystemLayerImpl.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH && !CHIP_SYSTEM_CONFIG_USE_LIBEV
+
+#include <unistd.h>
+
+#include <vector>
+
+using namespace chip;
+using namespace chip::System;
+
+namespace {
+
+struct WatchedPipe
+{
+    int fds[2]                    = { kInvalidFd, kInvalidFd };
+    SocketWatchToken token        = 0;
+    unsigned callbackCount        = 0;
+    LayerSockets * layer          = nullptr;
+    WatchedPipe * stopOnCallback  = nullptr;
+    WatchedPipe * startOnCallback = nullptr;
+};
+
+void HandleReplacementReadable(SocketEvents events, intptr_t data)
+{
+    reinterpret_cast<WatchedPipe *>(data)->callbackCount++;
+}
+
+void HandlePipeReadable(SocketEvents events, intptr_t data)
+{
+    auto * pipe = reinterpret_cast<WatchedPipe *>(data);
+    pipe->callbackCount++;
+
+    uint8_t byte;
+    (void) read(pipe->fds[0], &byte, sizeof(byte));
+
+    if (pipe->stopOnCallback != nullptr)
+    {
+        pipe->layer->StopWatchingSocket(&pipe->stopOnCallback->token);
+    }
+
+    if (pipe->startOnCallback != nullptr)
+    {
+        WatchedPipe * replacement = pipe->startOnCallback;
+        pipe->startOnCallback     = nullptr;
+        EXPECT_EQ(pipe->layer->StartWatchingSocket(replacement->fds[0], &replacement->token), CHIP_NO_ERROR);
+        EXPECT_EQ(pipe->layer->SetCallback(replacement->token, HandleReplacementReadable, reinterpret_cast<intptr_t>(replacement)),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(pipe->layer->RequestCallbackOnPendingRead(replacement->token), CHIP_NO_ERROR);
+    }
+}
+
+class TestSystemSocketWatch : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override { ASSERT_EQ(mLayer.Init(), CHIP_NO_ERROR); }
+
+    void TearDown() override
+    {
+        for (auto & p : mPipes)
+        {
+            if (p.token != mLayer.InvalidSocketWatchToken())
+            {
+                mLayer.StopWatchingSocket(&p.token);
+            }
+            close(p.fds[0]);
+            close(p.fds[1]);
+        }
+        mPipes.clear();
+        mLayer.Shutdown();
+    }
+
+    // Open and watch up to `count` pipes; returns the number actually watched, which is
+    // limited by the socket watch capacity of the layer implementation.
+    size_t WatchPipes(size_t count)
+    {
+        mPipes.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            WatchedPipe p;
+            if (pipe(p.fds) != 0)
+            {
+                break;
+            }
+            p.layer = &mLayer;
+            if (mLayer.StartWatchingSocket(p.fds[0], &p.token) != CHIP_NO_ERROR)
+            {
+                close(p.fds[0]);
+                close(p.fds[1]);
+                break;
+            }
+            mPipes.push_back(p);
+        }
+        for (auto & p : mPipes)
+        {
+            EXPECT_EQ(mLayer.SetCallback(p.token, HandlePipeReadable, reinterpret_cast<intptr_t>(&p)), CHIP_NO_ERROR);
+            EXPECT_EQ(mLayer.RequestCallbackOnPendingRead(p.token), CHIP_NO_ERROR);
+        }
+        return mPipes.size();
+    }
+
+    void ServiceEvents()
+    {
+        mLayer.PrepareEvents();
+        mLayer.WaitForEvents();
+        mLayer.HandleEvents();
+    }
+
+    LayerImpl mLayer;
+    std::vector<WatchedPipe> mPipes;
+};
+
+TEST_F(TestSystemSocketWatch, OnlyReadySocketIsDispatched)
+{
+    size_t watched = WatchPipes(8);
+    ASSERT_GE(watched, 2u);
+
+    WatchedPipe & ready = mPipes[watched / 2];
+    ASSERT_EQ(write(ready.fds[1], "x", 1), 1);
+    ServiceEvents();
+
+    for (auto & p : mPipes)
+    {
+        EXPECT_EQ(p.callbackCount, (&p == &ready) ? 1u : 0u);
+    }
+
+    // The byte has been consumed, so a further pass must not dispatch again.
+    mLayer.StartTimer(Clock::kZero, [](Layer *, void *) {}, nullptr);
+    ServiceEvents();
+    EXPECT_EQ(ready.callbackCount, 1u);
+}
+
+TEST_F(TestSystemSocketWatch, ClearedInterestIsNotDispatched)
+{
+    ASSERT_GE(WatchPipes(2), 2u);
+
+    EXPECT_EQ(mLayer.ClearCallbackOnPendingRead(mPipes[0].token), CHIP_NO_ERROR);
+    ASSERT_EQ(write(mPipes[0].fds[1], "x", 1), 1);
+    ASSERT_EQ(write(mPipes[1].fds[1], "x", 1), 1);
+    ServiceEvents();
+
+    EXPECT_EQ(mPipes[0].callbackCount, 0u);
+    EXPECT_EQ(mPipes[1].callbackCount, 1u);
+
+    // Re-arming delivers the still-pending byte.
+    EXPECT_EQ(mLayer.RequestCallbackOnPendingRead(mPipes[0].token), CHIP_NO_ERROR);
+    ServiceEvents();
+    EXPECT_EQ(mPipes[0].callbackCount, 1u);
+}
+
+TEST_F(TestSystemSocketWatch, StopWatchingFromCallback)
+{
+    ASSERT_GE(WatchPipes(2), 2u);
+
+    // Whichever callback runs first stops watching the other socket, so exactly one callback may run.
+    mPipes[0].stopOnCallback = &mPipes[1];
+    mPipes[1].stopOnCallback = &mPipes[0];
+    ASSERT_EQ(write(mPipes[0].fds[1], "x", 1), 1);
+    ASSERT_EQ(write(mPipes[1].fds[1], "x", 1), 1);
+    ServiceEvents();
+
+    EXPECT_EQ(mPipes[0].callbackCount + mPipes[1].callbackCount, 1u);
+}
+
+TEST_F(TestSystemSocketWatch, ReusedWatchIgnoresStaleEvents)
+{
+    ASSERT_GE(WatchPipes(2), 2u);
+
+    // Whichever callback runs first stops watching the other socket and watches a new one, which may take over the
+    // freed slot. The event already reported for the stopped socket must not reach the new one, which is not readable.
+    WatchedPipe replacement;
+    ASSERT_EQ(pipe(replacement.fds), 0);
+    mPipes[0].stopOnCallback  = &mPipes[1];
+    mPipes[0].startOnCallback = &replacement;
+    mPipes[1].stopOnCallback  = &mPipes[0];
+    mPipes[1].startOnCallback = &replacement;
+    ASSERT_EQ(write(mPipes[0].fds[1], "x", 1), 1);
+    ASSERT_EQ(write(mPipes[1].fds[1], "x", 1), 1);
+    ServiceEvents();
+
+    EXPECT_EQ(mPipes[0].callbackCount + mPipes[1].callbackCount, 1u);
+    EXPECT_EQ(replacement.callbackCount, 0u);
+
+    // The new socket is still watched.
+    ASSERT_EQ(write(replacement.fds[1], "x", 1), 1);
+    ServiceEvents();
+    EXPECT_EQ(replacement.callbackCount, 1u);
+
+    mLayer.StopWatchingSocket(&replacement.token);
+    close(replacement.fds[0]);
+    close(replacement.fds[1]);
+}
+
+} // namespace
+
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH && !CHIP_SYSTEM_CONFIG_USE_LIBEV
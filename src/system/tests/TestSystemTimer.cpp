@@ -31,7 +31,10 @@
 
 #include <lib/core/ErrorStr.h>
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <system/SystemConfig.h>
 #include <system/SystemError.h>
 #include <system/SystemLayerImpl.h>
@@ -564,6 +567,167 @@ TEST_F(TestSystemTimer, CheckTimerPool)
     EXPECT_TRUE(SYSTEM_STATS_TEST_HIGH_WATER_MARK(Stats::kSystemLayer_NumTimers, 4));
 }
 
+#if CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP
+
+// Test TimerHeap against the same sequence of operations as TimerList in CheckTimerPool.
+TEST_F(TestSystemTimer, CheckTimerHeap)
+{
+    using Timer = TimerList::Node;
+    struct TestState
+    {
+        static void Increment(Layer * layer, void * state) {}
+        static void Reset(Layer * layer, void * state) {}
+    };
+    TestState testState;
+
+    using namespace Clock::Literals;
+    struct
+    {
+        Clock::Timestamp awakenTime;
+        TimerCompleteCallback onComplete;
+        Timer * timer;
+    } testTimer[] = {
+        { 111_ms, TestState::Increment }, // 0
+        { 100_ms, TestState::Increment }, // 1
+        { 202_ms, TestState::Reset },     // 2
+        { 303_ms, TestState::Increment }, // 3
+    };
+
+    TimerPool<Timer> pool;
+    for (auto & timer : testTimer)
+    {
+        timer.timer = pool.Create(mLayer, timer.awakenTime, timer.onComplete, &testState);
+        ASSERT_NE(timer.timer, nullptr);
+    }
+
+    TimerHeap heap;
+    EXPECT_EQ(heap.Remove(nullptr), nullptr);
+    EXPECT_EQ(heap.Remove(nullptr, nullptr), nullptr);
+    EXPECT_EQ(heap.PopEarliest(), nullptr);
+    EXPECT_EQ(heap.PopIfEarlier(500_ms), nullptr);
+    EXPECT_EQ(heap.Earliest(), nullptr);
+    EXPECT_TRUE(heap.Empty());
+
+    EXPECT_EQ(heap.Add(testTimer[0].timer), testTimer[0].timer);
+    EXPECT_EQ(heap.PopIfEarlier(10_ms), nullptr);
+    EXPECT_FALSE(heap.Empty());
+    EXPECT_EQ(heap.Add(testTimer[1].timer), testTimer[1].timer);
+    EXPECT_EQ(heap.Add(testTimer[2].timer), testTimer[1].timer);
+    EXPECT_EQ(heap.Add(testTimer[3].timer), testTimer[1].timer);
+    EXPECT_EQ(heap.Earliest(), testTimer[1].timer);
+
+    EXPECT_EQ(heap.Remove(testTimer[1].timer), testTimer[0].timer); // (1 0 2 3) → (0 2 3)
+    EXPECT_EQ(heap.Remove(testTimer[1].timer), testTimer[0].timer); // not present
+    EXPECT_EQ(heap.Remove(TestState::Reset, &testState), testTimer[2].timer); // (0 2 3) → (0 3)
+    EXPECT_EQ(heap.Remove(TestState::Reset, &testState), nullptr);
+
+    // Timers with the same callback are removed in expiration order.
+    EXPECT_EQ(heap.Remove(TestState::Increment, &testState), testTimer[0].timer); // (0 3) → (3)
+    EXPECT_EQ(heap.PopIfEarlier(10_ms), nullptr);
+    EXPECT_EQ(heap.PopIfEarlier(500_ms), testTimer[3].timer);
+    EXPECT_TRUE(heap.Empty());
+
+    EXPECT_EQ(heap.Add(testTimer[3].timer), testTimer[3].timer);
+    EXPECT_EQ(heap.Add(testTimer[2].timer), testTimer[2].timer);
+    heap.Clear();
+    EXPECT_TRUE(heap.Empty());
+    EXPECT_EQ(heap.Remove(TestState::Reset, &testState), nullptr);
+
+    for (auto & timer : testTimer)
+    {
+        heap.Add(timer.timer);
+    }
+    TimerList early = heap.ExtractEarlier(200_ms); // heap: (1 0 2 3) → (2 3) returns: (1 0)
+    EXPECT_EQ(heap.PopEarliest(), testTimer[2].timer);
+    EXPECT_EQ(heap.PopEarliest(), testTimer[3].timer);
+    EXPECT_EQ(heap.PopEarliest(), nullptr);
+    EXPECT_EQ(early.PopEarliest(), testTimer[1].timer);
+    EXPECT_EQ(early.PopEarliest(), testTimer[0].timer);
+    EXPECT_EQ(early.PopEarliest(), nullptr);
+
+    pool.ReleaseAll();
+}
+
+namespace {
+
+struct TimerQueueTestState
+{
+    static void Callback(Layer * layer, void * state) {}
+};
+
+template <typename Queue>
+void CheckTimerQueueOrder(Layer & layer)
+{
+    constexpr size_t kNumTimers = 500;
+    using Timer                 = TimerList::Node;
+
+    // One app state per timer, and a few timers expiring at the same time so that insertion order matters.
+    static uint8_t sAppStates[kNumTimers];
+    chip::Platform::ScopedMemoryBuffer<Timer *> timers;
+    ASSERT_TRUE(timers.Calloc(kNumTimers));
+
+    Queue queue;
+    uint32_t seed = 1;
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        timers[i] =
+            chip::Platform::New<Timer>(layer, Clock::Timestamp((seed >> 16) % 64), TimerQueueTestState::Callback, &sAppStates[i]);
+        ASSERT_NE(timers[i], nullptr);
+        queue.Add(timers[i]);
+    }
+
+    // Cancel every third timer, by callback or directly.
+    for (size_t i = 0; i < kNumTimers; i += 3)
+    {
+        if (i % 2)
+        {
+            EXPECT_EQ(queue.Remove(TimerQueueTestState::Callback, &sAppStates[i]), timers[i]);
+        }
+        else
+        {
+            queue.Remove(timers[i]);
+        }
+        EXPECT_EQ(queue.GetRemainingTime(TimerQueueTestState::Callback, &sAppStates[i]), Clock::kZero);
+    }
+
+    // The remaining timers come out by expiration time, then by insertion order.
+    size_t popped    = 0;
+    Timer * previous = nullptr;
+    Timer * timer;
+    while ((timer = queue.PopEarliest()) != nullptr)
+    {
+        size_t index = static_cast<size_t>(static_cast<uint8_t *>(timer->GetCallback().GetAppState()) - sAppStates);
+        EXPECT_NE(index % 3, 0u);
+        if (previous != nullptr)
+        {
+            EXPECT_FALSE(timer->AwakenTime() < previous->AwakenTime());
+            if (timer->AwakenTime() == previous->AwakenTime())
+            {
+                EXPECT_GT(timer->GetCallback().GetAppState(), previous->GetCallback().GetAppState());
+            }
+        }
+        previous = timer;
+        popped++;
+    }
+    EXPECT_EQ(popped, kNumTimers - (kNumTimers + 2) / 3);
+
+    for (size_t i = 0; i < kNumTimers; i++)
+    {
+        chip::Platform::Delete(timers[i]);
+    }
+}
+
+} // namespace
+
+TEST_F(TestSystemTimer, CheckTimerQueueOrder)
+{
+    CheckTimerQueueOrder<TimerList>(mLayer);
+    CheckTimerQueueOrder<TimerHeap>(mLayer);
+}
+
+#endif // CHIP_SYSTEM_CONFIG_TIMER_QUEUE_USE_HEAP
+
 TEST_F(TestSystemTimer, ExtendTimerToTest)
 {
     if (!LayerEvents<LayerImpl>::HasServiceEvents())
@@ -75,6 +75,12 @@ constexpr MetricKey kMetricDeviceCASESessionSigmaFinished = "core_dev_case_sessi
 // MRP Retry Counter
 constexpr MetricKey kMetricDeviceRMPRetryCount = "core_dev_rmp_retry_count";
 
+// MRP measured round-trip time, in milliseconds
+constexpr MetricKey kMetricDeviceRMPRoundTripTime = "core_dev_rmp_rtt";
+
+// MRP smoothed round-trip time of the session, in milliseconds
+constexpr MetricKey kMetricDeviceRMPSmoothedRoundTripTime = "core_dev_rmp_srtt";
+
 // Subscription setup
 constexpr MetricKey kMetricDeviceSubscriptionSetup = "core_dev_subscription_setup";
 
@@ -55,6 +55,11 @@ CryptoContext::CryptoContext() : mKeyAvailable(false) {}
 
 CryptoContext::~CryptoContext()
 {
+#if CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS
+    mEncryptionCipher.Release();
+    mDecryptionCipher.Release();
+#endif // CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS
+
     if (mKeystore)
     {
         mKeystore->DestroyKey(mEncryptionKey);
@@ -86,6 +91,7 @@ CHIP_ERROR CryptoContext::InitFromSecret(SessionKeystore & keystore, const ByteS
     mKeyAvailable = true;
     mSessionRole  = role;
     mKeystore     = &keystore;
+    InitCiphers();
 
     return CHIP_NO_ERROR;
 }
@@ -111,6 +117,7 @@ CHIP_ERROR CryptoContext::InitFromSecret(Crypto::SessionKeystore & keystore, con
     mKeyAvailable = true;
     mSessionRole  = role;
     mKeystore     = &keystore;
+    InitCiphers();
 
     return CHIP_NO_ERROR;
 }
@@ -128,6 +135,21 @@ CHIP_ERROR CryptoContext::InitFromKeyPair(SessionKeystore & keystore, const Cryp
     return InitFromSecret(keystore, secret.Span(), salt, infoType, role);
 }
 
+void CryptoContext::InitCiphers()
+{
+#if CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS
+    // Encrypt and Decrypt fall back to setting up the cipher for every message if this fails.
+    if (mEncryptionCipher.Init(mEncryptionKey) != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Failed to set up the session encryption cipher");
+    }
+    if (mDecryptionCipher.Init(mDecryptionKey) != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Failed to set up the session decryption cipher");
+    }
+#endif // CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS
+}
+
 #if CHIP_CONFIG_SECURITY_TEST_MODE
 CHIP_ERROR CryptoContext::InitTestMode(Crypto::SessionKeystore & keystore, Crypto::Aes128KeyHandle & i2rKey,
                                        Crypto::Aes128KeyHandle & r2iKey)
@@ -220,8 +242,18 @@ CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, ui
     else
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
-        ReturnErrorOnFailure(
-            AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(), output, tag, taglen));
+#if CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS
+        if (mEncryptionCipher.IsInitialized())
+        {
+            ReturnErrorOnFailure(
+                mEncryptionCipher.Encrypt(input, input_length, AAD, aadLen, nonce.data(), nonce.size(), output, tag, taglen));
+        }
+        else
+#endif // CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS
+        {
+            ReturnErrorOnFailure(AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(),
+                                                 output, tag, taglen));
+        }
     }
 
     mac.SetTag(&header, tag, taglen);
@@ -255,8 +287,18 @@ CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, ui
     else
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
-        ReturnErrorOnFailure(
-            AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mDecryptionKey, nonce.data(), nonce.size(), output));
+#if CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS
+        if (mDecryptionCipher.IsInitialized())
+        {
+            ReturnErrorOnFailure(
+                mDecryptionCipher.Decrypt(input, input_length, AAD, aadLen, tag, taglen, nonce.data(), nonce.size(), output));
+        }
+        else
+#endif // CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS
+        {
+            ReturnErrorOnFailure(AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mDecryptionKey, nonce.data(),
+                                                 nonce.size(), output));
+        }
     }
     return CHIP_NO_ERROR;
 }
@@ -169,6 +169,7 @@ public:
 
 private:
     CHIP_ERROR InitTestMode(Crypto::SessionKeystore & keystore, Crypto::Aes128KeyHandle & i2rKey, Crypto::Aes128KeyHandle & r2iKey);
+    void InitCiphers();
 
     SessionRole mSessionRole;
 
@@ -178,6 +179,12 @@ private:
     Crypto::AttestationChallenge mAttestationChallenge;
     Crypto::SessionKeystore * mKeystore       = nullptr;
     Crypto::SymmetricKeyContext * mKeyContext = nullptr;
+#if CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS
+    // Set up with mEncryptionKey and mDecryptionKey once they are derived. Encrypt and Decrypt are const, but
+    // still update the cipher state.
+    mutable Crypto::Aes128CcmCipher mEncryptionCipher;
+    mutable Crypto::Aes128CcmCipher mDecryptionCipher;
+#endif // CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS
 
     // Use unencrypted header as additional authenticated data (AAD) during encryption and decryption.
     // The encryption operations includes AAD when message authentication tag is generated. This tag
@@ -25,6 +25,7 @@
 #include <ble/Ble.h>
 #include <lib/core/ReferenceCounted.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
+#include <messaging/RoundTripTimeEstimator.h>
 #include <transport/CryptoContext.h>
 #include <transport/Session.h>
 #include <transport/SessionMessageCounter.h>
@@ -172,7 +173,7 @@ public:
         {
         case Transport::Type::kUdp: {
             const ReliableMessageProtocolConfig & remoteMRPConfig = mRemoteSessionParams.GetMRPConfig();
-            return GetRetransmissionTimeout(remoteMRPConfig.mActiveRetransTimeout, remoteMRPConfig.mIdleRetransTimeout,
+            return GetRetransmissionTimeout(GetActiveRetransTimeout(), remoteMRPConfig.mIdleRetransTimeout,
                                             GetLastPeerActivityTime(), remoteMRPConfig.mActiveThresholdTime);
         }
         case Transport::Type::kTcp:
@@ -226,16 +227,7 @@ public:
 
     // Called when AddNOC has gone through sufficient success that we need to switch the
     // session to reflect a new fabric if it was a PASE session
-    CHIP_ERROR AdoptFabricIndex(FabricIndex fabricIndex)
-    {
-        // It's not legal to augment session type for non-PASE
-        if (mSecureSessionType != Type::kPASE)
-        {
-            return CHIP_ERROR_INVALID_ARGUMENT;
-        }
-        SetFabricIndex(fabricIndex);
-        return CHIP_NO_ERROR;
-    }
+    CHIP_ERROR AdoptFabricIndex(FabricIndex fabricIndex);
 
     System::Clock::Timestamp GetLastActivityTime() const { return mLastActivityTime; }
     System::Clock::Timestamp GetLastPeerActivityTime() const { return mLastPeerActivityTime; }
@@ -257,6 +249,21 @@ public:
         mIsCaseCommissioningSession = isCaseCommissioningSession;
     }
 
+    /**
+     * Base retransmission interval for the peer while it is active: the active interval it advertised or, with
+     * CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL, the interval derived from the round-trip times measured on this session.
+     */
+    System::Clock::Milliseconds32 GetActiveRetransTimeout() const
+    {
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+        const ReliableMessageProtocolConfig & remoteMRPConfig = GetRemoteMRPConfig();
+        return mRoundTripTimeEstimator.GetBaseRetransTimeout(remoteMRPConfig.mActiveRetransTimeout,
+                                                             remoteMRPConfig.mIdleRetransTimeout);
+#else
+        return GetRemoteMRPConfig().mActiveRetransTimeout;
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+    }
+
     bool IsPeerActive() const
     {
         return ((System::SystemClock().GetMonotonicTimestamp() - GetLastPeerActivityTime()) <
@@ -265,7 +272,7 @@ public:
 
     System::Clock::Timestamp GetMRPBaseTimeout() const override
     {
-        return IsPeerActive() ? GetRemoteMRPConfig().mActiveRetransTimeout : GetRemoteMRPConfig().mIdleRetransTimeout;
+        return IsPeerActive() ? GetActiveRetransTimeout() : GetRemoteMRPConfig().mIdleRetransTimeout;
     }
 
     CryptoContext & GetCryptoContext() { return mCryptoContext; }
@@ -274,6 +281,11 @@ public:
 
     SessionMessageCounter & GetSessionMessageCounter() { return mSessionMessageCounter; }
 
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+    RoundTripTimeEstimator & GetRoundTripTimeEstimator() { return mRoundTripTimeEstimator; }
+    const RoundTripTimeEstimator & GetRoundTripTimeEstimator() const { return mRoundTripTimeEstimator; }
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+
     // This should be a private API, only meant to be called by SecureSessionTable
     // Session holders to this session may shift to the target session regarding SessionDelegate::GetNewSessionHandlingPolicy.
     // It requires that the target sessoin is also a CASE session, having the same peer and CATs as this session.
@@ -353,6 +365,9 @@ private:
     SessionParameters mRemoteSessionParams;
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
+#if CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
+    RoundTripTimeEstimator mRoundTripTimeEstimator;
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRY_INTERVAL
 };
 
 } // namespace Transport
@@ -0,0 +1,166 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/ScopedNodeId.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Iterators.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Transport {
+
+class SecureSession;
+
+/**
+ * Fixed-capacity open-addressing hash index of SecureSession pointers.
+ *
+ * Entries are stored with the hash of their key; several entries may share a key (e.g. several
+ * sessions to the same peer), so lookups visit every entry whose hash matches and leave the final
+ * key comparison to the caller. Collisions are resolved by linear probing, and removal uses
+ * backward-shift deletion so no tombstones accumulate.
+ *
+ * The index holds at most kMaxEntries entries and is sized to at least twice that, which keeps
+ * probe sequences short and guarantees an insert below that limit always finds a free slot.
+ * Inserting beyond kMaxEntries fails rather than growing the index.
+ */
+template <size_t kMaxEntries>
+class SecureSessionIndex
+{
+public:
+    static constexpr size_t kCapacity = [] {
+        size_t capacity = 1;
+        while (capacity < 2 * kMaxEntries)
+        {
+            capacity <<= 1;
+        }
+        return capacity;
+    }();
+
+    static uint32_t HashLocalSessionId(uint16_t localSessionId) { return Mix(localSessionId); }
+
+    static uint32_t HashPeer(const ScopedNodeId & peer)
+    {
+        const uint64_t nodeId = peer.GetNodeId();
+        return Mix(static_cast<uint32_t>(nodeId) ^ static_cast<uint32_t>(nodeId >> 32) ^
+                   (static_cast<uint32_t>(peer.GetFabricIndex()) << 24));
+    }
+
+    /**
+     * Add an entry for the given session under the given hash.
+     *
+     * @retval CHIP_ERROR_INVALID_ARGUMENT if the session is null.
+     * @retval CHIP_ERROR_NO_MEMORY if the index already holds kMaxEntries entries.
+     */
+    CHECK_RETURN_VALUE
+    CHIP_ERROR Insert(uint32_t hash, SecureSession * session)
+    {
+        VerifyOrReturnError(session != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(mCount < kMaxEntries, CHIP_ERROR_NO_MEMORY);
+
+        size_t i = hash & kMask;
+        while (mSlots[i].mSession != nullptr)
+        {
+            i = (i + 1) & kMask;
+        }
+        mSlots[i].mSession = session;
+        mSlots[i].mHash    = hash;
+        mCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Remove the entry for the given session, which must have been inserted with the given hash.
+     * It is not an error for the session not to be present.
+     */
+    void Remove(uint32_t hash, const SecureSession * session)
+    {
+        size_t i = hash & kMask;
+        while (mSlots[i].mSession != session)
+        {
+            VerifyOrReturn(mSlots[i].mSession != nullptr);
+            i = (i + 1) & kMask;
+        }
+
+        // Shift back any following entries whose probe sequence passes through the freed slot.
+        size_t j = i;
+        while (true)
+        {
+            j = (j + 1) & kMask;
+            if (mSlots[j].mSession == nullptr)
+            {
+                break;
+            }
+            const size_t home = mSlots[j].mHash & kMask;
+            const bool homeInRange = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+            if (!homeInRange)
+            {
+                mSlots[i] = mSlots[j];
+                i         = j;
+            }
+        }
+        mSlots[i] = Slot();
+        mCount--;
+    }
+
+    /**
+     * Call `function(SecureSession *)` for every entry inserted with the given hash. The function
+     * returns Loop::Continue or Loop::Break and must not insert into or remove from this index.
+     */
+    template <typename Function>
+    Loop ForEachWithHash(uint32_t hash, Function && function) const
+    {
+        for (size_t i = hash & kMask; mSlots[i].mSession != nullptr; i = (i + 1) & kMask)
+        {
+            if (mSlots[i].mHash == hash && function(mSlots[i].mSession) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+        }
+        return Loop::Finish;
+    }
+
+    size_t Count() const { return mCount; }
+
+private:
+    static constexpr size_t kMask = kCapacity - 1;
+
+    static uint32_t Mix(uint32_t value)
+    {
+        // Finalizer from MurmurHash3 to spread sequential keys over the low bits used for probing.
+        value ^= value >> 16;
+        value *= 0x85ebca6bu;
+        value ^= value >> 13;
+        value *= 0xc2b2ae35u;
+        value ^= value >> 16;
+        return value;
+    }
+
+    struct Slot
+    {
+        SecureSession * mSession = nullptr;
+        uint32_t mHash           = 0;
+    };
+
+    Slot mSlots[kCapacity];
+    size_t mCount = 0;
+};
+
+} // namespace Transport
+} // namespace chip
@@ -22,6 +22,8 @@
 #include <transport/SecureSession.h>
 #include <transport/SecureSessionTable.h>
 
+#include <limits>
+
 namespace chip {
 namespace Transport {
 
@@ -52,8 +54,8 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
         }
     }
 
-    SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
-                                                   peerSessionId, fabricIndex, config);
+    SecureSession * result = AddToIndexes(mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId,
+                                                                peerCATs, peerSessionId, fabricIndex, config));
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -73,7 +75,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     //
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
-        allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        allocated = AddToIndexes(mEntries.CreateObject(*this, secureSessionType, sessionId.Value()));
     }
     else
     {
@@ -139,6 +141,34 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
     //
     // This will be used by the session eviction algorithm later.
     //
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    //
+    // Count sessions per fabric in a single pass and use the peer index for the per-peer
+    // count, rather than comparing every pair of sessions.
+    //
+    uint16_t numSessionsOnFabric[std::numeric_limits<FabricIndex>::max() + 1] = {};
+    ForEachSession([&numSessionsOnFabric](auto * session) {
+        numSessionsOnFabric[session->GetFabricIndex()]++;
+        return Loop::Continue;
+    });
+
+    ForEachSession([&index, &sortableSessions, &numSessionsOnFabric, this](auto * session) {
+        sortableSessions[index].mSession             = session;
+        sortableSessions[index].mNumMatchingOnFabric = static_cast<uint16_t>(numSessionsOnFabric[session->GetFabricIndex()] - 1);
+        sortableSessions[index].mNumMatchingOnPeer   = 0;
+
+        ForEachSessionWithPeer(session->GetPeer(), [session, index, &sortableSessions](auto * otherSession) {
+            if (session != otherSession)
+            {
+                sortableSessions[index].mNumMatchingOnPeer++;
+            }
+            return Loop::Continue;
+        });
+
+        index++;
+        return Loop::Continue;
+    });
+#else
     ForEachSession([&index, &sortableSessions, this](auto * session) {
         sortableSessions[index].mSession             = session;
         sortableSessions[index].mNumMatchingOnFabric = 0;
@@ -164,6 +194,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         index++;
         return Loop::Continue;
     });
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
 
     auto sortableSessionSpan = Span<SortableSession>(sortableSessions, mEntries.Allocated());
     EvictionPolicyContext policyContext(sortableSessionSpan, sessionEvictionHint);
@@ -216,7 +247,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         if (newCount < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
+            auto * retSession = AddToIndexes(mEntries.CreateObject(*this, secureSessionType, localSessionId));
             VerifyOrDie(session != nullptr);
             return retSession;
         }
@@ -337,9 +368,59 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
     });
 }
 
+void SecureSessionTable::ReleaseSession(SecureSession * session)
+{
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    mLocalSessionIdIndex.Remove(LocalSessionIdIndex::HashLocalSessionId(session->GetLocalSessionId()), session);
+    mPeerIndex.Remove(PeerIndex::HashPeer(session->GetPeer()), session);
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    mEntries.ReleaseObject(session);
+}
+
+void SecureSessionTable::SessionPeerChanged(SecureSession * session, const ScopedNodeId & previousPeer)
+{
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    mPeerIndex.Remove(PeerIndex::HashPeer(previousPeer), session);
+    // The entry just removed frees room for this one, so the insert cannot fail.
+    VerifyOrDie(mPeerIndex.Insert(PeerIndex::HashPeer(session->GetPeer()), session) == CHIP_NO_ERROR);
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+}
+
+SecureSession * SecureSessionTable::AddToIndexes(SecureSession * session)
+{
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    VerifyOrReturnValue(session != nullptr, nullptr);
+
+    // The indexes hold CHIP_CONFIG_SECURE_SESSION_POOL_SIZE entries, which a heap-backed pool or a test table size
+    // may exceed; refuse such sessions rather than leave them unreachable by lookups.
+    CHIP_ERROR err = mLocalSessionIdIndex.Insert(LocalSessionIdIndex::HashLocalSessionId(session->GetLocalSessionId()), session);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = mPeerIndex.Insert(PeerIndex::HashPeer(session->GetPeer()), session);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Secure session index full: %" CHIP_ERROR_FORMAT, err.Format());
+        ReleaseSession(session);
+        return nullptr;
+    }
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    return session;
+}
+
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
     SecureSession * result = nullptr;
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    mLocalSessionIdIndex.ForEachWithHash(LocalSessionIdIndex::HashLocalSessionId(localSessionId), [&](SecureSession * session) {
+        if (session->GetLocalSessionId() == localSessionId)
+        {
+            result = session;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+#else
     mEntries.ForEachActiveObject([&](auto session) {
         if (session->GetLocalSessionId() == localSessionId)
         {
@@ -348,11 +429,32 @@ Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t
         }
         return Loop::Continue;
     });
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    // With the local session ID index each candidate is checked in O(1), and since the table holds far
+    // fewer sessions than there are IDs, a free one is found within a few probes from the hint.
+    for (uint32_t i = 0; i <= kMaxSessionID; i++)
+    {
+        uint16_t candidate = static_cast<uint16_t>(i + mNextSessionId);
+        if (candidate == kUnsecuredSessionId)
+        {
+            continue;
+        }
+        Loop inUse = mLocalSessionIdIndex.ForEachWithHash(LocalSessionIdIndex::HashLocalSessionId(candidate), [&](auto * session) {
+            return (session->GetLocalSessionId() == candidate) ? Loop::Break : Loop::Continue;
+        });
+        if (inUse != Loop::Break)
+        {
+            return MakeOptional<uint16_t>(candidate);
+        }
+    }
+    return NullOptional;
+#else
     uint16_t candidate_base = 0;
     uint64_t candidate_mask = 0;
     for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
@@ -401,6 +503,7 @@ Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
     }
 
     return NullOptional;
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
 }
 
 } // namespace Transport
@@ -22,6 +22,9 @@
 #include <lib/support/SortUtils.h>
 #include <system/TimeSource.h>
 #include <transport/SecureSession.h>
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+#include <transport/SecureSessionIndex.h>
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
 
 namespace chip {
 namespace Transport {
@@ -76,7 +79,7 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session);
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -84,6 +87,26 @@ public:
         return mEntries.ForEachActiveObject(std::forward<Function>(function));
     }
 
+    /**
+     * Call the provided function on every session whose peer matches the given ScopedNodeId.
+     *
+     * The function returns Loop::Continue or Loop::Break. It must not allocate, release or evict sessions,
+     * nor change the peer of any session; use ForEachSession for that.
+     */
+    template <typename Function>
+    Loop ForEachSessionWithPeer(const ScopedNodeId & peer, Function && function)
+    {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+        return mPeerIndex.ForEachWithHash(PeerIndex::HashPeer(peer), [&](SecureSession * session) {
+            return (session->GetPeer() == peer) ? function(session) : Loop::Continue;
+        });
+#else
+        return mEntries.ForEachActiveObject([&](SecureSession * session) {
+            return (session->GetPeer() == peer) ? function(session) : Loop::Continue;
+        });
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    }
+
     /**
      * Get a secure session given its session ID.
      *
@@ -94,6 +117,10 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> FindSecureSessionByLocalKey(uint16_t localSessionId);
 
+    // Must be called by a session in the table whenever its peer (node ID or fabric index) changes, so that peer
+    // lookups keep finding it. This is an internal API, using raw pointer to a session is allowed here.
+    void SessionPeerChanged(SecureSession * session, const ScopedNodeId & previousPeer);
+
     // Select SessionHolders which are pointing to a session with the same peer as the given session. Shift them to the given
     // session.
     // This is an internal API, using raw pointer to a session is allowed here.
@@ -256,9 +283,25 @@ private:
     CHECK_RETURN_VALUE
     Optional<uint16_t> FindUnusedSessionId();
 
+    /**
+     * Register a newly created session (which may be null) with the lookup indexes, if enabled.
+     * If the indexes are full, the session is released.
+     *
+     * @return the session passed in, or nullptr if it could not be indexed
+     */
+    SecureSession * AddToIndexes(SecureSession * session);
+
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
 
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    using LocalSessionIdIndex = SecureSessionIndex<CHIP_CONFIG_SECURE_SESSION_POOL_SIZE>;
+    using PeerIndex           = SecureSessionIndex<CHIP_CONFIG_SECURE_SESSION_POOL_SIZE>;
+
+    LocalSessionIdIndex mLocalSessionIdIndex;
+    PeerIndex mPeerIndex;
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
     size_t GetMaxSessionTableSize() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
@@ -581,8 +581,8 @@ void SessionManager::ExpireAllSecureSessions()
 
 void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Optional<Transport::SecureSession::Type> & type)
 {
-    mSecureSessions.ForEachSession([&node, &type](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == node &&
+    mSecureSessions.ForEachSessionWithPeer(node, [&type](auto session) {
+        if (session->IsActiveSession() &&
             (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             session->MarkAsDefunct();
@@ -593,10 +593,10 @@ void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Opti
 
 void SessionManager::UpdateAllSessionsPeerAddress(const ScopedNodeId & node, const Transport::PeerAddress & addr)
 {
-    mSecureSessions.ForEachSession([&node, &addr](auto session) {
+    mSecureSessions.ForEachSessionWithPeer(node, [&addr](auto session) {
         // Arguably we should only be updating active and defunct sessions, but there is no harm
         // in updating evicted sessions.
-        if (session->GetPeer() == node && Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
+        if (Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
         {
             session->SetPeerAddress(addr);
         }
@@ -1158,6 +1158,7 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
     VerifyOrReturn(taglen == footerLen);
 
     bool decrypted = false;
+    mGroupMessageDecryptStats.mMessages++;
     while (!decrypted && iter->Next(groupContext))
     {
         CryptoContext context(groupContext.keyContext);
@@ -1169,6 +1170,7 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
         }
 
         bool privacy = partialPacketHeader.HasPrivacyFlag();
+        mGroupMessageDecryptStats.mDecryptAttempts++;
         decrypted =
             GroupKeyDecryptAttempt(partialPacketHeader, packetHeaderCopy, payloadHeader, privacy, msgCopy, mac, groupContext);
 
@@ -1186,11 +1188,17 @@ void SessionManager::SecureGroupMessageDispatch(const PacketHeader & partialPack
                 GroupKeyDecryptAttempt(partialPacketHeader, packetHeaderCopy, payloadHeader, false, msgCopy, mac, groupContext);
         }
 #endif // CHIP_CONFIG_PRIVACY_ACCEPT_NONSPEC_SVE2
+
+        if (!decrypted)
+        {
+            mGroupMessageDecryptStats.mDecryptMisses++;
+        }
     }
     iter.Release();
 
     if (!decrypted)
     {
+        mGroupMessageDecryptStats.mUndecryptable++;
         ChipLogError(Inet, "Failed to decrypt group message. Discarding everything");
         return;
     }
@@ -1284,12 +1292,12 @@ Optional<SessionHandle> SessionManager::FindSecureSessionForNode(ScopedNodeId pe
     SecureSession * tcpSession = nullptr;
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
-    mSecureSessions.ForEachSession([&peerNodeId, &type, &mrpSession,
+    mSecureSessions.ForEachSessionWithPeer(peerNodeId, [&type, &mrpSession,
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &tcpSession,
+                                                        &tcpSession,
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &transportPayloadCapability](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == peerNodeId &&
+                                                        &transportPayloadCapability](auto session) {
+        if (session->IsActiveSession() &&
             (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             if (transportPayloadCapability == TransportPayloadCapability::kMRPOrTCPCompatiblePayload ||
@@ -534,6 +534,21 @@ public:
 
     Crypto::SessionKeystore * GetSessionKeystore() const { return mSessionKeystore; }
 
+    /**
+     * Counters for the trial decryption of incoming group messages, which tries every group key whose
+     * session ID matches the message until one succeeds.
+     */
+    struct GroupMessageDecryptStats
+    {
+        uint32_t mMessages        = 0; ///< Group messages for which trial decryption was attempted.
+        uint32_t mDecryptAttempts = 0; ///< Candidate keys tried, over all messages.
+        uint32_t mDecryptMisses   = 0; ///< Candidate keys that failed to decrypt their message.
+        uint32_t mUndecryptable   = 0; ///< Group messages that no candidate key could decrypt.
+    };
+
+    const GroupMessageDecryptStats & GetGroupMessageDecryptStats() const { return mGroupMessageDecryptStats; }
+    void ResetGroupMessageDecryptStats() { mGroupMessageDecryptStats = GroupMessageDecryptStats(); }
+
 private:
     /**
      *    The State of a secure transport object.
@@ -557,6 +572,7 @@ private:
     Transport::SecureSessionTable mSecureSessions;
     State mState; // < Initialization state of the object
     chip::Transport::GroupOutgoingCounters mGroupClientCounter;
+    GroupMessageDecryptStats mGroupMessageDecryptStats;
 
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     OnTCPConnectionReceivedCallback mConnReceivedCb = nullptr;
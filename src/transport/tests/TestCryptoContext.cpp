@@ -21,6 +21,7 @@
 #include <pw_unit_test/framework.h>
 
 #include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/support/CHIPMem.h>
@@ -72,4 +73,131 @@ TEST_F(TestGroupCryptoContext, TestBuildPrivacyNonce)
     }
 }
 
+/* Session Establish Key Info, as used by CryptoContext::InitFromSecret */
+constexpr uint8_t kSEKeysInfo[] = { 0x53, 0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x4b, 0x65, 0x79, 0x73 };
+
+constexpr uint8_t kSharedSecret[] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+                                      0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+                                      0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f };
+constexpr uint8_t kSalt[]         = { 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7 };
+
+constexpr uint16_t kSessionId   = 0x1234;
+constexpr size_t kMaxAADLength = 128;
+constexpr NodeId kNodeId        = 0x0123456789ABCDEF;
+
+class TestSessionCryptoContext : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        ASSERT_EQ(mInitiator.InitFromSecret(mKeystore, ByteSpan(kSharedSecret), ByteSpan(kSalt),
+                                            CryptoContext::SessionInfoType::kSessionEstablishment,
+                                            CryptoContext::SessionRole::kInitiator),
+                  CHIP_NO_ERROR);
+        ASSERT_EQ(mResponder.InitFromSecret(mKeystore, ByteSpan(kSharedSecret), ByteSpan(kSalt),
+                                            CryptoContext::SessionInfoType::kSessionEstablishment,
+                                            CryptoContext::SessionRole::kResponder),
+                  CHIP_NO_ERROR);
+    }
+
+    static void InitMessage(uint32_t messageCounter, PacketHeader & header, CryptoContext::NonceStorage & nonce)
+    {
+        header.SetSessionId(kSessionId).SetMessageCounter(messageCounter);
+        ASSERT_EQ(CryptoContext::BuildNonce(nonce, header.GetSecurityFlags(), messageCounter, kNodeId), CHIP_NO_ERROR);
+    }
+
+    Crypto::DefaultSessionKeystore mKeystore;
+    CryptoContext mInitiator;
+    CryptoContext mResponder;
+};
+
+TEST_F(TestSessionCryptoContext, TestEncryptDecryptMessages)
+{
+    // Several messages of different lengths each way, so that the session ciphers are reused (when
+    // CHIP_CONFIG_SECURE_SESSION_CACHED_CIPHERS is enabled) with different nonces and lengths.
+    for (uint32_t messageCounter = 1; messageCounter <= 16; messageCounter++)
+    {
+        CryptoContext & sender   = (messageCounter % 2) ? mInitiator : mResponder;
+        CryptoContext & receiver = (messageCounter % 2) ? mResponder : mInitiator;
+
+        uint8_t plaintext[64];
+        const size_t length = 1 + (messageCounter * 7) % sizeof(plaintext);
+        for (size_t i = 0; i < length; i++)
+        {
+            plaintext[i] = static_cast<uint8_t>(messageCounter + i);
+        }
+
+        PacketHeader header;
+        CryptoContext::NonceStorage nonce;
+        InitMessage(messageCounter, header, nonce);
+
+        uint8_t ciphertext[sizeof(plaintext)];
+        MessageAuthenticationCode mac;
+        ASSERT_EQ(sender.Encrypt(plaintext, length, ciphertext, nonce, header, mac), CHIP_NO_ERROR);
+        EXPECT_NE(memcmp(ciphertext, plaintext, length), 0);
+
+        uint8_t decrypted[sizeof(plaintext)];
+        ASSERT_EQ(receiver.Decrypt(ciphertext, length, decrypted, nonce, header, mac), CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(decrypted, plaintext, length), 0);
+
+        // A message encrypted with the sending key cannot be decrypted with it.
+        EXPECT_NE(sender.Decrypt(ciphertext, length, decrypted, nonce, header, mac), CHIP_NO_ERROR);
+    }
+}
+
+TEST_F(TestSessionCryptoContext, TestEncryptMatchesSessionKeys)
+{
+    // Messages encrypted by the context decrypt with the plain AES-CCM primitive and the derived session keys.
+    Crypto::Aes128KeyHandle i2rKey;
+    Crypto::Aes128KeyHandle r2iKey;
+    Crypto::AttestationChallenge challenge;
+    ASSERT_EQ(mKeystore.DeriveSessionKeys(ByteSpan(kSharedSecret), ByteSpan(kSalt), ByteSpan(kSEKeysInfo), i2rKey, r2iKey,
+                                          challenge),
+              CHIP_NO_ERROR);
+
+    const uint8_t plaintext[] = { 'H', 'e', 'l', 'l', 'o', ',', ' ', 'M', 'a', 't', 't', 'e', 'r' };
+    uint8_t aad[kMaxAADLength];
+
+    for (uint32_t messageCounter = 1; messageCounter <= 4; messageCounter++)
+    {
+        PacketHeader header;
+        CryptoContext::NonceStorage nonce;
+        InitMessage(messageCounter, header, nonce);
+
+        uint16_t aadLength = 0;
+        ASSERT_EQ(header.Encode(aad, sizeof(aad), &aadLength), CHIP_NO_ERROR);
+
+        uint8_t ciphertext[sizeof(plaintext)];
+        MessageAuthenticationCode mac;
+        ASSERT_EQ(mInitiator.Encrypt(plaintext, sizeof(plaintext), ciphertext, nonce, header, mac), CHIP_NO_ERROR);
+
+        uint8_t decrypted[sizeof(plaintext)];
+        ASSERT_EQ(Crypto::AES_CCM_decrypt(ciphertext, sizeof(ciphertext), aad, aadLength, mac.GetTag(), header.MICTagLength(),
+                                          i2rKey, nonce.data(), nonce.size(), decrypted),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(decrypted, plaintext, sizeof(plaintext)), 0);
+
+        // And the other way around, with a tampered tag rejected.
+        uint8_t reply[sizeof(plaintext)];
+        uint8_t tag[MIC_LENGTH];
+        ASSERT_EQ(Crypto::AES_CCM_encrypt(plaintext, sizeof(plaintext), aad, aadLength, r2iKey, nonce.data(), nonce.size(), reply,
+                                          tag, sizeof(tag)),
+                  CHIP_NO_ERROR);
+        MessageAuthenticationCode replyMac;
+        replyMac.SetTag(&header, tag, sizeof(tag));
+        ASSERT_EQ(mInitiator.Decrypt(reply, sizeof(reply), decrypted, nonce, header, replyMac), CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(decrypted, plaintext, sizeof(plaintext)), 0);
+
+        tag[0] ^= 0x01;
+        replyMac.SetTag(&header, tag, sizeof(tag));
+        EXPECT_NE(mInitiator.Decrypt(reply, sizeof(reply), decrypted, nonce, header, replyMac), CHIP_NO_ERROR);
+    }
+
+    mKeystore.DestroyKey(i2rKey);
+    mKeystore.DestroyKey(r2iKey);
+}
+
 } // namespace
@@ -0,0 +1,132 @@
+/*
+ *    Copyright (c) 2024 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <transport/SecureSessionIndex.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Transport;
+
+using TestIndex = SecureSessionIndex<8>;
+static_assert(TestIndex::kCapacity == 16, "Index capacity must be the next power of two above twice the entry count");
+
+// The index never dereferences the sessions, so distinct addresses are enough.
+uint8_t sSessionStorage[8];
+
+SecureSession * FakeSession(size_t i)
+{
+    return reinterpret_cast<SecureSession *>(&sSessionStorage[i]);
+}
+
+unsigned CountWithHash(const TestIndex & index, uint32_t hash, const SecureSession * expected = nullptr)
+{
+    unsigned count = 0;
+    index.ForEachWithHash(hash, [&](SecureSession * session) {
+        if (expected == nullptr || session == expected)
+        {
+            count++;
+        }
+        return Loop::Continue;
+    });
+    return count;
+}
+
+TEST(TestSecureSessionIndex, TestEntriesSharingAHash)
+{
+    TestIndex index;
+    for (size_t i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(index.Insert(7, FakeSession(i)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(index.Insert(8, FakeSession(3)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Count(), 4u);
+
+    EXPECT_EQ(CountWithHash(index, 7), 3u);
+    EXPECT_EQ(CountWithHash(index, 8), 1u);
+    EXPECT_EQ(CountWithHash(index, 9), 0u);
+
+    index.Remove(7, FakeSession(1));
+    EXPECT_EQ(index.Count(), 3u);
+    EXPECT_EQ(CountWithHash(index, 7), 2u);
+    EXPECT_EQ(CountWithHash(index, 7, FakeSession(1)), 0u);
+    EXPECT_EQ(CountWithHash(index, 8, FakeSession(3)), 1u);
+
+    // Removing an entry that is not present is a no-op.
+    index.Remove(7, FakeSession(1));
+    index.Remove(9, FakeSession(5));
+    EXPECT_EQ(index.Count(), 3u);
+}
+
+TEST(TestSecureSessionIndex, TestRemoveShiftsBackAcrossWrapAround)
+{
+    // Entries whose home slot is the last one wrap around to the start of the index; removing the
+    // entry they probed past must keep them reachable.
+    constexpr uint32_t kLastSlot  = TestIndex::kCapacity - 1;
+    constexpr uint32_t kFirstSlot = TestIndex::kCapacity;
+
+    TestIndex index;
+    EXPECT_EQ(index.Insert(kLastSlot, FakeSession(0)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Insert(kLastSlot | 0x100, FakeSession(1)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Insert(kFirstSlot, FakeSession(2)), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Insert(kLastSlot | 0x200, FakeSession(3)), CHIP_NO_ERROR);
+
+    index.Remove(kLastSlot, FakeSession(0));
+    EXPECT_EQ(CountWithHash(index, kLastSlot), 0u);
+    EXPECT_EQ(CountWithHash(index, kLastSlot | 0x100, FakeSession(1)), 1u);
+    EXPECT_EQ(CountWithHash(index, kFirstSlot, FakeSession(2)), 1u);
+    EXPECT_EQ(CountWithHash(index, kLastSlot | 0x200, FakeSession(3)), 1u);
+
+    index.Remove(kLastSlot | 0x100, FakeSession(1));
+    EXPECT_EQ(CountWithHash(index, kFirstSlot, FakeSession(2)), 1u);
+    EXPECT_EQ(CountWithHash(index, kLastSlot | 0x200, FakeSession(3)), 1u);
+    EXPECT_EQ(index.Count(), 2u);
+}
+
+TEST(TestSecureSessionIndex, TestFullIndex)
+{
+    TestIndex index;
+    for (size_t i = 0; i < 8; i++)
+    {
+        EXPECT_EQ(index.Insert(TestIndex::HashLocalSessionId(static_cast<uint16_t>(i + 1)), FakeSession(i)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(index.Count(), 8u);
+
+    // Inserting beyond the entry limit fails and leaves the index unchanged.
+    EXPECT_EQ(index.Insert(TestIndex::HashLocalSessionId(9), FakeSession(0)), CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(index.Count(), 8u);
+    EXPECT_EQ(CountWithHash(index, TestIndex::HashLocalSessionId(9)), 0u);
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        EXPECT_EQ(CountWithHash(index, TestIndex::HashLocalSessionId(static_cast<uint16_t>(i + 1)), FakeSession(i)), 1u);
+    }
+
+    for (size_t i = 0; i < 8; i += 2)
+    {
+        index.Remove(TestIndex::HashLocalSessionId(static_cast<uint16_t>(i + 1)), FakeSession(i));
+    }
+    for (size_t i = 1; i < 8; i += 2)
+    {
+        EXPECT_EQ(CountWithHash(index, TestIndex::HashLocalSessionId(static_cast<uint16_t>(i + 1)), FakeSession(i)), 1u);
+    }
+    EXPECT_EQ(index.Count(), 4u);
+}
+
+} // namespace
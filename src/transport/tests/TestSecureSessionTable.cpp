@@ -43,6 +43,9 @@ public:
     static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
 
     void ValidateSessionSorting();
+    void ValidatePeerAndLocalSessionIdLookups();
+    void ValidateTableSizeAbovePoolSize();
+    void MeasureLookupCostVersusTableSize();
 
 private:
     struct SessionParameters
@@ -461,5 +464,149 @@ TEST_F(TestSecureSessionTable, ValidateSessionSorting)
     ValidateSessionSorting();
 }
 
+void TestSecureSessionTable::ValidatePeerAndLocalSessionIdLookups()
+{
+    SecureSessionTable table;
+    table.Init();
+
+    const ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                               System::Clock::Milliseconds16(0));
+    const ScopedNodeId peer(2, kFabric1);
+
+    auto first = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    ASSERT_TRUE(first.HasValue());
+    auto second = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    ASSERT_TRUE(second.HasValue());
+    SecureSession * firstSession  = first.Value()->AsSecureSession();
+    SecureSession * secondSession = second.Value()->AsSecureSession();
+    EXPECT_NE(firstSession->GetLocalSessionId(), secondSession->GetLocalSessionId());
+
+    auto found = table.FindSecureSessionByLocalKey(secondSession->GetLocalSessionId());
+    ASSERT_TRUE(found.HasValue());
+    EXPECT_EQ(found.Value()->AsSecureSession(), secondSession);
+
+    auto countPeerSessions = [&table](const ScopedNodeId & node) {
+        unsigned count = 0;
+        table.ForEachSessionWithPeer(node, [&count](auto session) {
+            count++;
+            return Loop::Continue;
+        });
+        return count;
+    };
+
+    // Activating a session changes its peer; peer lookups must follow.
+    EXPECT_EQ(countPeerSessions(peer), 0u);
+    firstSession->Activate(ScopedNodeId(1, kFabric1), peer, CATValues(), 1, config);
+    EXPECT_EQ(countPeerSessions(peer), 1u);
+    secondSession->Activate(ScopedNodeId(1, kFabric1), peer, CATValues(), 2, config);
+    EXPECT_EQ(countPeerSessions(peer), 2u);
+    EXPECT_EQ(countPeerSessions(ScopedNodeId(2, kFabric2)), 0u);
+
+    // Released sessions are no longer found by either key.
+    const uint16_t firstLocalSessionId = firstSession->GetLocalSessionId();
+    found.ClearValue();
+    first.ClearValue();
+    firstSession->MarkForEviction();
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(firstLocalSessionId).HasValue());
+    EXPECT_EQ(countPeerSessions(peer), 1u);
+
+    second.ClearValue();
+    secondSession->MarkForEviction();
+    EXPECT_EQ(countPeerSessions(peer), 0u);
+}
+
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+void TestSecureSessionTable::ValidateTableSizeAbovePoolSize()
+{
+    // A table size above the pool size must fail cleanly once either the pool or the lookup indexes are full.
+    SecureSessionTable table;
+    table.Init();
+    table.SetMaxSessionTableSize(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE + 1);
+
+    Optional<SessionHandle> sessions[CHIP_CONFIG_SECURE_SESSION_POOL_SIZE];
+    for (auto & session : sessions)
+    {
+        session = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+        ASSERT_TRUE(session.HasValue());
+    }
+
+    EXPECT_FALSE(table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId()).HasValue());
+    const ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                               System::Clock::Milliseconds16(0));
+    EXPECT_FALSE(
+        table.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, kMaxSessionID, 1, 2, CATValues(), 3, kFabric1, config)
+            .HasValue());
+    EXPECT_EQ(table.mEntries.Allocated(), static_cast<size_t>(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE));
+
+    // Existing sessions are still found.
+    for (auto & session : sessions)
+    {
+        EXPECT_TRUE(table.FindSecureSessionByLocalKey(session.Value()->AsSecureSession()->GetLocalSessionId()).HasValue());
+        session.ClearValue();
+    }
+}
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
+void TestSecureSessionTable::MeasureLookupCostVersusTableSize()
+{
+    constexpr unsigned kLookups = 100000;
+
+    for (uint32_t tableSize : { 4u, 16u, static_cast<uint32_t>(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE) })
+    {
+        if (tableSize > CHIP_CONFIG_SECURE_SESSION_POOL_SIZE)
+        {
+            continue;
+        }
+
+        SecureSessionTable table;
+        table.Init();
+        table.SetMaxSessionTableSize(tableSize);
+
+        Optional<SessionHandle> sessions[CHIP_CONFIG_SECURE_SESSION_POOL_SIZE];
+        uint16_t localSessionIds[CHIP_CONFIG_SECURE_SESSION_POOL_SIZE];
+        for (uint32_t i = 0; i < tableSize; i++)
+        {
+            sessions[i] = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+            ASSERT_TRUE(sessions[i].HasValue());
+            localSessionIds[i] = sessions[i].Value()->AsSecureSession()->GetLocalSessionId();
+        }
+
+        unsigned hits                             = 0;
+        const System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (unsigned i = 0; i < kLookups; i++)
+        {
+            hits += table.FindSecureSessionByLocalKey(localSessionIds[i % tableSize]).HasValue() ? 1 : 0;
+        }
+        const System::Clock::Microseconds64 elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+        EXPECT_EQ(hits, kLookups);
+
+        ChipLogProgress(Test, "%u sessions: %u ns per FindSecureSessionByLocalKey", static_cast<unsigned>(tableSize),
+                        static_cast<unsigned>(elapsed.count() * 1000 / kLookups));
+
+        // The sessions were never activated, so dropping the handles releases them.
+        for (uint32_t i = 0; i < tableSize; i++)
+        {
+            sessions[i].ClearValue();
+        }
+    }
+}
+
+TEST_F(TestSecureSessionTable, ValidatePeerAndLocalSessionIdLookups)
+{
+    ValidatePeerAndLocalSessionIdLookups();
+}
+
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+TEST_F(TestSecureSessionTable, ValidateTableSizeAbovePoolSize)
+{
+    ValidateTableSizeAbovePoolSize();
+}
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
+TEST_F(TestSecureSessionTable, MeasureLookupCostVersusTableSize)
+{
+    MeasureLookupCostVersusTableSize();
+}
+
 } // namespace Transport
 } // namespace chip
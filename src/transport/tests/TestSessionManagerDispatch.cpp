@@ -599,10 +599,20 @@ TEST_F(TestSessionManagerDispatch, TestSessionManagerDispatch)
         chip::System::PacketBufferHandle msg =
             chip::MessagePacketBuffer::NewWithData(reinterpret_cast<const uint8_t *>(privacy), testEntry.privacyLength);
 
-        const PeerAddress peerAddress = AddressFromString(testEntry.peerAddr);
+        const PeerAddress peerAddress                              = AddressFromString(testEntry.peerAddr);
+        const SessionManager::GroupMessageDecryptStats statsBefore = sessionManager.GetGroupMessageDecryptStats();
         sessionManager.OnMessageReceived(peerAddress, std::move(msg));
         EXPECT_EQ(callback.NumMessagesReceived(), testEntry.expectedMessageCount);
 
+        // A delivered group message was decrypted by exactly one of the candidate keys.
+        const SessionManager::GroupMessageDecryptStats & stats = sessionManager.GetGroupMessageDecryptStats();
+        if (stats.mMessages != statsBefore.mMessages && testEntry.expectedMessageCount > 0)
+        {
+            EXPECT_EQ(stats.mUndecryptable, statsBefore.mUndecryptable);
+            EXPECT_EQ((stats.mDecryptAttempts - statsBefore.mDecryptAttempts) - (stats.mDecryptMisses - statsBefore.mDecryptMisses),
+                      1u);
+        }
+
         if ((testEntry.expectedMessageCount == 0) && (callback.NumMessagesReceived() == 0))
         {
             ChipLogProgress(Test, "::: TestSessionManagerDispatch[%d] PASS (negative test case)", i);